@@ -0,0 +1,280 @@
+/**
+ * @file benchmark_io.c
+ * @brief Compare reader I/O backends: mmap, pread and io_uring
+ *
+ * Also reports reader open latency with and without the speculative
+ * footer tail read, and with a warm metadata cache.
+ *
+ * Usage:
+ *   benchmark_io                 # generates a test file in the temp dir
+ *   benchmark_io file.parquet    # benchmarks an existing file
+ *
+ * Results reflect the page cache state of the file. For cold-cache numbers
+ * drop caches between runs (e.g. echo 3 > /proc/sys/vm/drop_caches).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <sys/stat.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <carquet/carquet.h>
+
+#define WARMUP_ITERATIONS 1
+#define BENCH_ITERATIONS 5
+#define NUM_ROWS 4000000
+#define NUM_COLUMNS 8
+#define OPEN_ITERATIONS 200
+
+typedef struct {
+    const char* name;
+    bool use_mmap;
+    carquet_io_backend_t backend;
+} backend_config_t;
+
+static double get_time_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static long get_file_size(const char* filename) {
+    struct stat st;
+    if (stat(filename, &st) == 0) {
+        return (long)st.st_size;
+    }
+    return 0;
+}
+
+static const char* get_temp_dir(void) {
+#ifdef _WIN32
+    const char* tmp = getenv("TEMP");
+    return tmp ? tmp : ".";
+#else
+    const char* tmp = getenv("TMPDIR");
+    return tmp ? tmp : "/tmp";
+#endif
+}
+
+static int write_test_file(const char* filename) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+
+    carquet_schema_t* schema = carquet_schema_create(&err);
+    if (!schema) return -1;
+    for (int c = 0; c < NUM_COLUMNS; c++) {
+        char name[16];
+        snprintf(name, sizeof(name), "col%d", c);
+        if (carquet_schema_add_column(schema, name, CARQUET_PHYSICAL_INT64, NULL,
+                                      CARQUET_REPETITION_REQUIRED, 0) != CARQUET_OK) {
+            carquet_schema_free(schema);
+            return -1;
+        }
+    }
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_ZSTD;
+    opts.row_group_size = 500000;
+
+    carquet_writer_t* writer = carquet_writer_create(filename, schema, &opts, &err);
+    if (!writer) {
+        carquet_schema_free(schema);
+        return -1;
+    }
+
+    const int rows_per_group = 500000;
+    int64_t* values = malloc(rows_per_group * sizeof(int64_t));
+    carquet_status_t status = values ? CARQUET_OK : CARQUET_ERROR_OUT_OF_MEMORY;
+    uint32_t state = 42;
+    for (int start = 0; status == CARQUET_OK && start < NUM_ROWS; start += rows_per_group) {
+        for (int c = 0; status == CARQUET_OK && c < NUM_COLUMNS; c++) {
+            for (int i = 0; i < rows_per_group; i++) {
+                state = state * 1103515245u + 12345u;
+                values[i] = (int64_t)(state >> 8);
+            }
+            status = carquet_writer_write_batch(writer, c, values, rows_per_group, NULL, NULL);
+        }
+        if (status == CARQUET_OK && start + rows_per_group < NUM_ROWS) {
+            status = carquet_writer_new_row_group(writer);
+        }
+    }
+
+    free(values);
+    carquet_schema_free(schema);
+    if (status != CARQUET_OK) {
+        carquet_writer_abort(writer);
+        return -1;
+    }
+    return carquet_writer_close(writer) == CARQUET_OK ? 0 : -1;
+}
+
+static double benchmark_read(const char* filename, const backend_config_t* backend,
+                             int64_t* rows_out, bool* active) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+
+    double start = get_time_ms();
+
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.use_mmap = backend->use_mmap;
+    opts.io_backend = backend->backend;
+
+    carquet_reader_t* reader = carquet_reader_open(filename, &opts, &err);
+    if (!reader) return -1;
+
+    *active = backend->backend == CARQUET_IO_BACKEND_IO_URING
+                  ? carquet_reader_is_io_uring(reader)
+                  : carquet_reader_is_mmap(reader) == backend->use_mmap;
+
+    carquet_batch_reader_config_t config;
+    carquet_batch_reader_config_init(&config);
+    config.batch_size = 262144;
+
+    int64_t total_rows = 0;
+    carquet_batch_reader_t* batch_reader = carquet_batch_reader_create(reader, &config, &err);
+    if (batch_reader) {
+        carquet_row_batch_t* batch = NULL;
+        volatile int64_t checksum = 0;
+
+        while (carquet_batch_reader_next(batch_reader, &batch) == CARQUET_OK && batch) {
+            total_rows += carquet_row_batch_num_rows(batch);
+
+            const void* data;
+            const uint8_t* nulls;
+            int64_t count;
+            if (carquet_row_batch_column(batch, 0, &data, &nulls, &count) == CARQUET_OK && data) {
+                checksum += ((const int64_t*)data)[0];
+            }
+
+            carquet_row_batch_free(batch);
+            batch = NULL;
+        }
+        (void)checksum;
+        carquet_batch_reader_free(batch_reader);
+    }
+
+    carquet_reader_close(reader);
+
+    *rows_out = total_rows;
+    return get_time_ms() - start;
+}
+
+/* Average time of carquet_reader_open + close, in microseconds */
+static double benchmark_open(const char* filename, size_t footer_read_size,
+                             carquet_metadata_cache_t* cache) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.footer_read_size = footer_read_size;
+    opts.metadata_cache = cache;
+
+    double start = get_time_ms();
+    for (int i = 0; i < OPEN_ITERATIONS; i++) {
+        carquet_reader_t* reader = carquet_reader_open(filename, &opts, &err);
+        if (!reader) return -1;
+        carquet_reader_close(reader);
+    }
+    return (get_time_ms() - start) * 1000.0 / OPEN_ITERATIONS;
+}
+
+int main(int argc, char** argv) {
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    printf("Carquet I/O Backend Benchmark\n");
+    printf("=============================\n");
+
+    char filename[512];
+    bool generated = false;
+    if (argc > 1) {
+        snprintf(filename, sizeof(filename), "%s", argv[1]);
+    } else {
+        snprintf(filename, sizeof(filename), "%s/benchmark_io_carquet.parquet", get_temp_dir());
+        printf("Generating %d rows x %d INT64 columns (zstd)...\n", NUM_ROWS, NUM_COLUMNS);
+        if (write_test_file(filename) != 0) {
+            fprintf(stderr, "Failed to write %s\n", filename);
+            return 1;
+        }
+        generated = true;
+    }
+
+    long file_size = get_file_size(filename);
+    printf("File: %s (%.2f MB)\n\n", filename, file_size / (1024.0 * 1024.0));
+
+    backend_config_t backends[] = {
+        {"mmap",     true,  CARQUET_IO_BACKEND_DEFAULT},
+        {"pread",    false, CARQUET_IO_BACKEND_DEFAULT},
+        {"io_uring", false, CARQUET_IO_BACKEND_IO_URING},
+    };
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        int64_t rows = 0;
+        bool active = false;
+
+        for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+            benchmark_read(filename, &backends[b], &rows, &active);
+        }
+
+        double sum = 0;
+        bool failed = false;
+        for (int i = 0; i < BENCH_ITERATIONS; i++) {
+            double t = benchmark_read(filename, &backends[b], &rows, &active);
+            if (t < 0) {
+                failed = true;
+                break;
+            }
+            sum += t;
+        }
+
+        if (failed) {
+            printf("  %-9s failed to open file\n", backends[b].name);
+            continue;
+        }
+
+        double avg = sum / BENCH_ITERATIONS;
+        printf("  %-9s %8.2f ms  %8.2f MB/s  %8.2f M rows/sec%s\n",
+               backends[b].name, avg,
+               (file_size / (1024.0 * 1024.0)) / (avg / 1000.0),
+               (rows / avg) / 1000.0,
+               active ? "" : "  (unavailable, fell back)");
+        printf("CSV:io,%s,%lld,%.2f,%ld\n",
+               backends[b].name, (long long)rows, avg, file_size);
+    }
+
+    /* Open latency: one tail read vs. length-then-footer reads, then
+     * reopening with the footer already in a metadata cache */
+    printf("\nOpen latency (pread, %d opens):\n", OPEN_ITERATIONS);
+    carquet_metadata_cache_t* cache = carquet_metadata_cache_create(64 * 1024 * 1024, NULL);
+    const size_t tails[3] = { 64 * 1024, 0, 64 * 1024 };
+    const char* tail_names[3] = { "tail-64k", "two-reads", "cached" };
+    for (int t = 0; t < 3; t++) {
+        double us = benchmark_open(filename, tails[t], t == 2 ? cache : NULL);
+        if (us < 0) {
+            printf("  %-9s failed to open file\n", tail_names[t]);
+            continue;
+        }
+        printf("  %-9s %8.2f us/open\n", tail_names[t], us);
+        printf("CSV:open,%s,%.2f\n", tail_names[t], us);
+    }
+    carquet_metadata_cache_free(cache);
+
+    if (generated) {
+        remove(filename);
+    }
+
+    printf("\nBenchmark complete.\n");
+    return 0;
+}
@@ -177,6 +177,26 @@ static void fuzz_parquet_metadata(const uint8_t* data, size_t size) {
 
     parquet_file_metadata_free(&metadata);
     carquet_arena_destroy(&arena);
+
+    /* Lazy mode: index the column chunks, then decode them on demand */
+    if (carquet_arena_init(&arena) != CARQUET_OK) return;
+    memset(&metadata, 0, sizeof(metadata));
+
+    status = parquet_parse_file_metadata_lazy(data, size, &arena, &metadata, &err);
+    if (status == CARQUET_OK) {
+        for (int32_t i = 0; i < metadata.num_row_groups && i < 10; i++) {
+            for (int32_t c = 0; c < metadata.row_groups[i].num_columns && c < 100; c++) {
+                const parquet_column_chunk_t* chunk =
+                    parquet_row_group_column(&metadata, i, c, &err);
+                if (chunk) {
+                    (void)chunk->metadata.data_page_offset;
+                }
+            }
+        }
+    }
+
+    parquet_file_metadata_free(&metadata);
+    carquet_arena_destroy(&arena);
 }
 
 /**
@@ -201,6 +221,47 @@ static void fuzz_parquet_page_header(const uint8_t* data, size_t size) {
     }
 }
 
+/**
+ * Test mode 5: Page index (ColumnIndex / OffsetIndex) parsing
+ */
+static void fuzz_parquet_page_index(const uint8_t* data, size_t size) {
+    carquet_arena_t arena;
+    if (carquet_arena_init(&arena) != CARQUET_OK) return;
+
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    parquet_column_index_t column_index;
+    if (parquet_parse_column_index(data, size, &arena, &column_index, &err) == CARQUET_OK) {
+        for (int32_t i = 0; i < column_index.num_pages; i++) {
+            (void)column_index.null_pages[i];
+            (void)column_index.min_value_lens[i];
+            (void)column_index.max_value_lens[i];
+        }
+    }
+
+    parquet_offset_index_t offset_index;
+    if (parquet_parse_offset_index(data, size, &arena, &offset_index, &err) == CARQUET_OK) {
+        for (int32_t i = 0; i < offset_index.num_pages; i++) {
+            (void)offset_index.page_locations[i].first_row_index;
+        }
+    }
+
+    carquet_arena_destroy(&arena);
+}
+
+/**
+ * Test mode 6: Bloom filter header parsing
+ */
+static void fuzz_parquet_bloom_filter_header(const uint8_t* data, size_t size) {
+    parquet_bloom_filter_header_t header;
+    size_t bytes_read = 0;
+    carquet_error_t err = CARQUET_ERROR_INIT;
+
+    if (parquet_parse_bloom_filter_header(data, size, &header, &bytes_read, &err) == CARQUET_OK) {
+        (void)header.num_bytes;
+        (void)header.algorithm;
+    }
+}
+
 int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
     if (size < 2) {
         return 0;
@@ -209,7 +270,7 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
     (void)carquet_init();
 
     /* First byte selects test mode */
-    uint8_t mode = data[0] % 5;
+    uint8_t mode = data[0] % 7;
     const uint8_t* payload = data + 1;
     size_t payload_size = size - 1;
 
@@ -229,6 +290,12 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
         case 4:
             fuzz_parquet_page_header(payload, payload_size);
             break;
+        case 5:
+            fuzz_parquet_page_index(payload, payload_size);
+            break;
+        case 6:
+            fuzz_parquet_bloom_filter_header(payload, payload_size);
+            break;
     }
 
     return 0;
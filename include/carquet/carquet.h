@@ -102,7 +102,8 @@
  * @section memory Memory Management
  *
  * - All returned pointers remain valid until their parent object is freed
- * - Batch data pointers are valid until carquet_row_batch_free() is called
+ * - Batch data pointers are valid until carquet_row_batch_free() is called,
+ *   or until the batch is refilled by carquet_batch_reader_next_into()
  * - Schema pointers from readers are valid until the reader is closed
  * - Use carquet_set_allocator() to provide custom memory allocation
  *
@@ -453,6 +454,12 @@ typedef struct carquet_row_batch carquet_row_batch_t;
 /** @brief Batch reader for efficient columnar reading */
 typedef struct carquet_batch_reader carquet_batch_reader_t;
 
+/** @brief Shared cache of parsed file metadata */
+typedef struct carquet_metadata_cache carquet_metadata_cache_t;
+
+/** @brief Record-by-record reader of a nested (LIST/MAP) column */
+typedef struct carquet_nested_reader carquet_nested_reader_t;
+
 /* ============================================================================
  * Schema API
  * ============================================================================
@@ -772,6 +779,14 @@ int32_t carquet_schema_node_type_length(const carquet_schema_node_t* node);
  * 4. Close with carquet_reader_close()
  */
 
+/**
+ * @brief I/O backend used to read column data.
+ */
+typedef enum carquet_io_backend {
+    CARQUET_IO_BACKEND_DEFAULT = 0,  /**< mmap if use_mmap is set, otherwise pread */
+    CARQUET_IO_BACKEND_IO_URING      /**< Asynchronous reads through io_uring (Linux) */
+} carquet_io_backend_t;
+
 /**
  * @brief Configuration options for file reading.
  */
@@ -816,6 +831,111 @@ typedef struct carquet_reader_options {
      * Default: 0 (auto)
      */
     int32_t num_threads;
+
+    /**
+     * @brief Maximum gap in bytes for coalescing column chunk reads.
+     *
+     * Without mmap, each column chunk is fetched with a single read and its
+     * pages are parsed from memory. The batch reader additionally merges the
+     * projected chunks of a row group into as few reads as possible: chunks
+     * separated by at most this many bytes are fetched together (the gap is
+     * read and discarded). Set to a negative value to read each chunk
+     * separately.
+     *
+     * Default: 1048576 (1 MB)
+     */
+    int64_t coalesce_gap;
+
+    /**
+     * @brief Bytes read from the end of the file when opening it.
+     *
+     * Without mmap, the reader fetches this much of the file tail in a
+     * single read and parses the footer from it when it fits; only larger
+     * footers need a second read. Keeps open latency at one round trip for
+     * typical files on remote or high-latency storage. Values below 8 read
+     * just the footer length and magic first.
+     *
+     * Default: 65536 (64 KB)
+     */
+    size_t footer_read_size;
+
+    /**
+     * @brief Decode column chunk metadata on demand.
+     *
+     * When enabled, opening a file decodes the schema and row group
+     * headers but only indexes where each column chunk's metadata sits in
+     * the footer. A chunk is decoded the first time its column is read or
+     * its statistics are queried. For very wide files read with a narrow
+     * projection, open time and metadata memory then follow the columns
+     * used rather than the width of the schema. With a metadata_cache,
+     * chunks decoded later count towards the cache's size limit.
+     *
+     * Default: false
+     */
+    bool lazy_metadata;
+
+    /**
+     * @brief I/O backend for column data.
+     *
+     * CARQUET_IO_BACKEND_IO_URING keeps many reads in flight per row group
+     * (see io_queue_depth), which helps on NVMe and other devices that need
+     * a deep queue. It takes precedence over use_mmap. When io_uring is not
+     * compiled in or not permitted by the kernel, the reader falls back to
+     * the default backend.
+     *
+     * Default: CARQUET_IO_BACKEND_DEFAULT
+     */
+    carquet_io_backend_t io_backend;
+
+    /**
+     * @brief Maximum number of reads in flight with the io_uring backend.
+     *
+     * Set to 0 for the maximum supported depth (128).
+     *
+     * Default: 32
+     */
+    int32_t io_queue_depth;
+
+    /**
+     * @brief Cap on resident memory of the file mapping (mmap only).
+     *
+     * Column readers read ahead of the page they are on (MADV_WILLNEED,
+     * up to 64 MB per chunk) and release bytes they have passed
+     * (MADV_DONTNEED). When non-zero, the read-ahead of all column readers
+     * of this reader together is limited to this many bytes, which bounds
+     * the mapped footprint when scanning very large files. Released pages
+     * stay valid and are faulted back in if touched again.
+     *
+     * Set to 0 for no cap.
+     *
+     * Default: 0
+     */
+    size_t mmap_max_resident;
+
+    /**
+     * @brief Cache of parsed footers shared between readers (optional).
+     *
+     * When set, opening a file whose footer is already in the cache skips
+     * reading and decoding it: the reader shares the cached metadata and
+     * schema. Files opened by path are identified by path, size and
+     * modification time; other open functions need metadata_cache_key.
+     * The cache must outlive every reader opened with it.
+     *
+     * Default: NULL (no caching)
+     */
+    carquet_metadata_cache_t* metadata_cache;
+
+    /**
+     * @brief Caller-supplied identity of the file contents (optional).
+     *
+     * Used instead of the path and modification time as the cache key,
+     * together with the file size. The caller must use a new key whenever
+     * the contents behind it may have changed (e.g. include an object
+     * version or ETag). Only read while opening.
+     *
+     * Default: NULL
+     */
+    const char* metadata_cache_key;
 } carquet_reader_options_t;
 
 /**
@@ -916,6 +1036,79 @@ carquet_reader_t* carquet_reader_open_buffer(
     const carquet_reader_options_t* options,
     carquet_error_t* error);
 
+/**
+ * @brief Completion callback for asynchronous source reads.
+ *
+ * @param[in] user_data Value passed to read_at_async
+ * @param[in] status CARQUET_OK if all requested bytes were read
+ */
+typedef void (*carquet_read_callback_t)(void* user_data, carquet_status_t status);
+
+/**
+ * @brief Custom byte source for carquet_reader_open_source().
+ *
+ * Lets the reader pull Parquet bytes from caches, object stores or any
+ * other random-access storage without materializing the whole file. The
+ * reader fetches the footer, then whole column chunks (the batch reader
+ * merges nearby chunks of a row group into single requests, see
+ * carquet_reader_options_t.coalesce_gap), so a high-latency source sees a
+ * few large reads rather than one per page.
+ *
+ * Callbacks may be invoked concurrently from several threads (parallel
+ * column reading, batch reader read-ahead) and must be thread-safe.
+ */
+typedef struct carquet_input_source {
+    /** Opaque pointer passed to every callback. */
+    void* ctx;
+
+    /** Total size of the data in bytes, or a negative value on error. */
+    int64_t (*size)(void* ctx);
+
+    /**
+     * Read exactly `length` bytes at `offset` into `buffer`.
+     * Return CARQUET_OK, or an error status (e.g. CARQUET_ERROR_FILE_READ).
+     */
+    carquet_status_t (*read_at)(void* ctx, int64_t offset, void* buffer, size_t length);
+
+    /**
+     * Optional. Start reading exactly `length` bytes at `offset` into
+     * `buffer` and return without waiting. `callback(user_data, status)`
+     * must be called exactly once when the read finishes, from any thread
+     * (possibly before read_at_async returns). Return an error status,
+     * without calling the callback, if the read could not be started.
+     *
+     * When set, all reads of a coalesced plan are started before the
+     * reader waits for any of them.
+     */
+    carquet_status_t (*read_at_async)(void* ctx, int64_t offset, void* buffer, size_t length,
+                                      carquet_read_callback_t callback, void* user_data);
+
+    /** Optional. Called once when the reader no longer needs the source. */
+    void (*release)(void* ctx);
+} carquet_input_source_t;
+
+/**
+ * @brief Open a Parquet file from a custom byte source.
+ *
+ * The source struct is copied. The reader takes ownership of the source:
+ * release (if set) is called when the reader is closed, or before this
+ * function returns if opening fails.
+ *
+ * use_mmap and io_backend are ignored; all reads go through the source.
+ *
+ * @param[in] source Byte source (size and read_at are required)
+ * @param[in] options Reader options (may be NULL)
+ * @param[out] error Error information (may be NULL)
+ * @return Reader handle, or NULL on error
+ *
+ * @note Thread-safe: Yes
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1)
+carquet_reader_t* carquet_reader_open_source(
+    const carquet_input_source_t* source,
+    const carquet_reader_options_t* options,
+    carquet_error_t* error);
+
 /**
  * @brief Close a reader and release all resources.
  *
@@ -995,6 +1188,20 @@ int32_t carquet_reader_num_columns(const carquet_reader_t* reader);
 CARQUET_API CARQUET_PURE CARQUET_NONNULL(1)
 bool carquet_reader_is_mmap(const carquet_reader_t* reader);
 
+/**
+ * @brief Check if reader is using the io_uring backend.
+ *
+ * False when io_uring was not requested or was unavailable and the reader
+ * fell back to the default backend.
+ *
+ * @param[in] reader File reader
+ * @return true if io_uring is active, false otherwise
+ *
+ * @note Thread-safe: Yes (read-only)
+ */
+CARQUET_API CARQUET_PURE CARQUET_NONNULL(1)
+bool carquet_reader_is_io_uring(const carquet_reader_t* reader);
+
 /**
  * @brief Check if zero-copy reading is possible for a column.
  *
@@ -1077,6 +1284,82 @@ carquet_column_reader_t* carquet_reader_get_column(
     int32_t column_index,
     carquet_error_t* error);
 
+/* ============================================================================
+ * Metadata Cache API
+ * ============================================================================
+ *
+ * A process-wide cache of parsed footers (file metadata plus schema) for
+ * services that open the same files over and over. Pass it to readers via
+ * carquet_reader_options_t.metadata_cache. Entries are immutable and
+ * reference counted: readers of the same file share one copy, and an
+ * evicted entry is freed when its last reader closes.
+ */
+
+/**
+ * @brief Cache statistics.
+ */
+typedef struct carquet_metadata_cache_stats {
+    int64_t hits;       /**< Opens served from the cache */
+    int64_t misses;     /**< Opens that parsed the footer */
+    int64_t evictions;  /**< Entries dropped to stay within the budget */
+    int64_t entries;    /**< Entries currently cached */
+    size_t bytes;       /**< Memory held by cached entries */
+} carquet_metadata_cache_stats_t;
+
+/**
+ * @brief Create a metadata cache.
+ *
+ * Least recently used entries are evicted once the memory held by cached
+ * entries exceeds max_bytes. Footers larger than max_bytes are never
+ * cached.
+ *
+ * @param[in] max_bytes Memory budget in bytes (must be > 0)
+ * @param[out] error Error information (may be NULL)
+ * @return Cache handle, or NULL on error
+ *
+ * @note Thread-safe: Yes. The cache may be shared by any number of readers
+ *       opened concurrently from different threads.
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT
+carquet_metadata_cache_t* carquet_metadata_cache_create(
+    size_t max_bytes,
+    carquet_error_t* error);
+
+/**
+ * @brief Free a metadata cache.
+ *
+ * All readers opened with the cache must be closed first.
+ *
+ * @param[in] cache Cache to free (may be NULL)
+ */
+CARQUET_API
+void carquet_metadata_cache_free(carquet_metadata_cache_t* cache);
+
+/**
+ * @brief Drop all entries from the cache.
+ *
+ * Entries still used by open readers stay valid until those readers close.
+ *
+ * @param[in] cache Metadata cache
+ *
+ * @note Thread-safe: Yes
+ */
+CARQUET_API CARQUET_NONNULL(1)
+void carquet_metadata_cache_clear(carquet_metadata_cache_t* cache);
+
+/**
+ * @brief Get cache statistics.
+ *
+ * @param[in] cache Metadata cache
+ * @param[out] stats Output statistics
+ *
+ * @note Thread-safe: Yes
+ */
+CARQUET_API CARQUET_NONNULL(1, 2)
+void carquet_metadata_cache_get_stats(
+    carquet_metadata_cache_t* cache,
+    carquet_metadata_cache_stats_t* stats);
+
 /* ============================================================================
  * Column Reader API
  * ============================================================================
@@ -1110,6 +1393,10 @@ carquet_column_reader_t* carquet_reader_get_column(
  * - DOUBLE: double (8 bytes per value)
  * - BYTE_ARRAY: carquet_byte_array_t (pointer + length)
  * - FIXED_LEN_BYTE_ARRAY: uint8_t[type_length]
+ *
+ * BYTE_ARRAY values point into memory owned by the reader (the file mapping
+ * or the decoded pages of the batch). They stay valid until the next read,
+ * skip or seek on this column reader, or until it is freed.
  */
 CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1)
 int64_t carquet_column_read_batch(
@@ -1119,11 +1406,48 @@ int64_t carquet_column_read_batch(
     int16_t* def_levels,
     int16_t* rep_levels);
 
+/**
+ * @brief Read a batch of values spaced out to their rows, with a validity bitmap.
+ *
+ * Unlike carquet_column_read_batch(), which packs the present values at the
+ * front of the buffer, value i of the batch is written to slot i of values
+ * and null slots are zeroed, as Arrow and NumPy style consumers lay out
+ * nullable columns. Bit i of validity (LSB first) is set when value i is
+ * present. Optional columns with max_def_level 1 decode their definition
+ * levels straight into the bitmap and 4- and 8-byte values are spread to
+ * their slots with SIMD expand kernels.
+ *
+ * The first call switches the reader to spaced output for good: later
+ * carquet_column_read_batch() calls also return spaced values. Only flat
+ * columns (max_rep_level 0) can be read spaced.
+ *
+ * @param[in] reader Column reader
+ * @param[out] values Output buffer for max_values values, sized as for
+ *             carquet_column_read_batch()
+ * @param[in] max_values Maximum number of values to read
+ * @param[out] validity Bitmap of at least (max_values + 7) / 8 bytes; bits
+ *             past the last value read are unspecified
+ * @param[out] null_count Number of nulls read (may be NULL)
+ * @return Number of values read (0 at end of column), or negative on error
+ *         or for a repeated column
+ *
+ * @note Thread-safe: No
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 2, 4)
+int64_t carquet_column_read_spaced(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t* null_count);
+
 /**
  * @brief Skip values in a column without reading them.
  *
  * Efficiently skips over values in the column stream. This is faster than
- * reading and discarding values.
+ * reading and discarding values: pages that lie entirely within the skipped
+ * range are stepped over by their headers without being decompressed, and
+ * a skip that ends inside a page decodes only the values after it.
  *
  * @param[in] reader Column reader
  * @param[in] num_values Number of values to skip
@@ -1136,6 +1460,32 @@ int64_t carquet_column_skip(
     carquet_column_reader_t* reader,
     int64_t num_values);
 
+/**
+ * @brief Position a column reader at a row of its row group.
+ *
+ * If the column chunk has an OffsetIndex (see write_page_index), the reader
+ * jumps straight to the page holding the row: pages in between are neither
+ * fetched nor decompressed, and afterwards the reader fetches pages one at
+ * a time instead of the whole chunk. Without an OffsetIndex the reader
+ * skips values from its current position (or from the start of the chunk
+ * when seeking backwards).
+ *
+ * The next read returns the values of `row` onwards. Seeking to the row
+ * group's row count positions the reader at the end.
+ *
+ * @param[in] reader Column reader
+ * @param[in] row Row index, relative to the row group
+ * @param[out] error Error information (can be NULL)
+ * @return CARQUET_OK on success
+ *
+ * @note Thread-safe: No
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1)
+carquet_status_t carquet_column_seek_row(
+    carquet_column_reader_t* reader,
+    int64_t row,
+    carquet_error_t* error);
+
 /**
  * @brief Check if there are more values to read.
  *
@@ -1168,6 +1518,125 @@ int64_t carquet_column_remaining(const carquet_column_reader_t* reader);
 CARQUET_API
 void carquet_column_reader_free(carquet_column_reader_t* reader);
 
+/* ============================================================================
+ * Nested Column API
+ * ============================================================================
+ *
+ * A nested reader reads one leaf column of a row group whole records at a
+ * time and rebuilds its nesting from the repetition and definition levels
+ * (Dremel assembly) into Arrow-style list arrays: for each repeated level,
+ * offsets into the next level and a validity bitmap, then the leaf values
+ * spaced one per element slot.
+ *
+ * LIST fields (three-level or legacy repeated fields) have one repeated
+ * level per list; a MAP is a list of key_value entries whose key and value
+ * columns are read with one nested reader each and share their offsets.
+ * Nulls of optional groups between the innermost list and the leaf are
+ * folded into the leaf validity.
+ */
+
+/**
+ * @brief Offsets and validity of one repeated level of a nested batch.
+ */
+typedef struct carquet_list_level {
+    /** Schema element of the level: the LIST/MAP group, or the repeated
+     *  field itself when it has no annotated parent (legacy lists) */
+    int32_t schema_element;
+    int64_t length;             /**< Number of lists */
+    int64_t null_count;         /**< Number of null lists */
+    /** length + 1 offsets: list i spans slots [offsets[i], offsets[i + 1])
+     *  of the next level (or of the values for the innermost level) */
+    const int32_t* offsets;
+    const uint8_t* validity;    /**< Bit i (LSB first) set if list i is not null */
+} carquet_list_level_t;
+
+/**
+ * @brief One batch of records of a nested column.
+ *
+ * All pointers are owned by the nested reader and stay valid until its next
+ * carquet_nested_reader_next() call or until it is freed.
+ */
+typedef struct carquet_nested_batch {
+    int64_t num_rows;           /**< Records in the batch */
+    int32_t num_levels;         /**< Repeated levels (the column's max_rep_level) */
+    /** Outermost first; levels[0] has one list per record */
+    const carquet_list_level_t* levels;
+    int64_t num_values;         /**< Element slots of the innermost lists */
+    int64_t null_count;         /**< Null elements */
+    /** num_values values laid out as for carquet_column_read_batch(), with
+     *  zeroed placeholders for null elements */
+    const void* values;
+    const uint8_t* validity;    /**< Bit i (LSB first) set if value i is not null */
+} carquet_nested_batch_t;
+
+/**
+ * @brief Create a nested reader for a column of a row group.
+ *
+ * Works for any leaf column; a flat column reads as zero levels with one
+ * value per record.
+ *
+ * @param[in] reader File reader
+ * @param[in] row_group_index Row group index
+ * @param[in] column_index Leaf column index
+ * @param[out] error Error information (may be NULL)
+ * @return Nested reader, or NULL on error
+ *
+ * @note Thread-safe: Yes (multiple nested readers can be used concurrently)
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1)
+carquet_nested_reader_t* carquet_nested_reader_create(
+    carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_error_t* error);
+
+/**
+ * @brief Read and assemble the next records of a nested column.
+ *
+ * Reads up to max_rows whole records. A record that spans pages is read
+ * to its end, so every batch holds complete lists and its offsets start
+ * at 0.
+ *
+ * @param[in] nested Nested reader
+ * @param[in] max_rows Maximum number of records to read (> 0)
+ * @param[out] batch Assembled records; num_rows is 0 at the end of the column
+ * @param[out] error Error information (may be NULL)
+ * @return CARQUET_OK on success
+ *
+ * @note Thread-safe: No
+ *
+ * @code{.c}
+ * // tags: optional list<int32>
+ * carquet_nested_batch_t batch;
+ * while (carquet_nested_reader_next(nested, 1024, &batch, &err) == CARQUET_OK &&
+ *        batch.num_rows > 0) {
+ *     const carquet_list_level_t* tags = &batch.levels[0];
+ *     const int32_t* values = batch.values;
+ *     for (int64_t row = 0; row < batch.num_rows; row++) {
+ *         for (int32_t i = tags->offsets[row]; i < tags->offsets[row + 1]; i++) {
+ *             // values[i], null unless batch.validity has bit i set
+ *         }
+ *     }
+ * }
+ * @endcode
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 3)
+carquet_status_t carquet_nested_reader_next(
+    carquet_nested_reader_t* nested,
+    int64_t max_rows,
+    carquet_nested_batch_t* batch,
+    carquet_error_t* error);
+
+/**
+ * @brief Free a nested reader.
+ *
+ * @param[in] nested Nested reader to free (may be NULL)
+ *
+ * @note Thread-safe: Yes (for different reader instances)
+ */
+CARQUET_API
+void carquet_nested_reader_free(carquet_nested_reader_t* nested);
+
 /* ============================================================================
  * Batch Reader API
  * ============================================================================
@@ -1236,6 +1705,46 @@ typedef struct carquet_batch_reader_config {
      * @brief Number of column names.
      */
     int32_t num_column_names;
+
+    /**
+     * @brief Number of row groups to read ahead in the background.
+     *
+     * While row group N is being consumed, a background thread opens row
+     * groups N+1 .. N+prefetch_depth: it reads their projected column
+     * chunks and decompresses the first page of each column. Each slot
+     * holds roughly one projected row group in memory.
+     *
+     * Set to 0 to disable read-ahead.
+     *
+     * Default: 0
+     */
+    int32_t prefetch_depth;
+
+    /**
+     * @brief Return dictionary-encoded columns as indices.
+     *
+     * When set, a column whose pages in the batch are all dictionary
+     * encoded comes back as int32 indices into its dictionary instead of
+     * materialized values; see carquet_row_batch_column_dictionary().
+     * Columns that are not dictionary encoded (or that fall back to
+     * another encoding within the batch) are materialized as usual.
+     * BOOLEAN columns are always materialized.
+     *
+     * Default: false
+     */
+    bool read_dictionary;
+
+    /**
+     * @brief Lay batches out as Apache Arrow expects.
+     *
+     * When set, null bitmaps hold validity bits (set = present, as in
+     * Arrow) and are NULL for REQUIRED columns, and BYTE_ARRAY columns also
+     * get Arrow offsets and a contiguous character buffer, so that
+     * carquet_row_batch_export_arrow() hands every buffer over as is.
+     *
+     * Default: false
+     */
+    bool arrow_layout;
 } carquet_batch_reader_config_t;
 
 /**
@@ -1306,6 +1815,53 @@ carquet_status_t carquet_batch_reader_next(
     carquet_batch_reader_t* batch_reader,
     carquet_row_batch_t** batch);
 
+/**
+ * @brief Create an empty row batch for carquet_batch_reader_next_into().
+ *
+ * @param[out] error Error information (may be NULL)
+ * @return Row batch with no rows or columns, or NULL on error. Free it
+ *         with carquet_row_batch_free().
+ *
+ * @note Thread-safe: Yes
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT
+carquet_row_batch_t* carquet_row_batch_create(carquet_error_t* error);
+
+/**
+ * @brief Read the next batch of rows into a caller-owned batch.
+ *
+ * Like carquet_batch_reader_next(), but refills batch instead of
+ * allocating a new one. The column buffers of its previous contents go
+ * back to a buffer pool owned by the batch reader. The new contents take
+ * their buffers from the same pool. Buffers are pooled by power-of-two
+ * size class, so a scan that reuses one batch stops allocating memory
+ * after its first batches. The batch can hold rows from any reader, and
+ * it may be freed before or after the batch reader.
+ *
+ * Pointers obtained from the batch's previous contents become invalid.
+ * Do not pass a batch handed over by carquet_row_batch_export_arrow().
+ *
+ * @param[in] batch_reader Batch reader
+ * @param[in,out] batch Batch to refill (from carquet_row_batch_create()
+ *                or carquet_batch_reader_next())
+ * @return CARQUET_OK on success, CARQUET_ERROR_END_OF_DATA when finished
+ *         (the batch is then empty)
+ *
+ * @note Thread-safe: No
+ *
+ * @code{.c}
+ * carquet_row_batch_t* batch = carquet_row_batch_create(&err);
+ * while (carquet_batch_reader_next_into(batch_reader, batch) == CARQUET_OK) {
+ *     // Process batch...
+ * }
+ * carquet_row_batch_free(batch);
+ * @endcode
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 2)
+carquet_status_t carquet_batch_reader_next_into(
+    carquet_batch_reader_t* batch_reader,
+    carquet_row_batch_t* batch);
+
 /**
  * @brief Free a batch reader.
  *
@@ -1349,17 +1905,23 @@ int32_t carquet_row_batch_num_columns(const carquet_row_batch_t* batch);
  * @param[in] batch Row batch
  * @param[in] column_index Column index within the batch (0 to num_columns-1)
  * @param[out] data Pointer to column data (type depends on physical type)
- * @param[out] null_bitmap Null bitmap (1 bit per value, set = not null) or NULL
+ * @param[out] null_bitmap Null bitmap (1 bit per value) or NULL
  * @param[out] num_values Number of values in the column
  * @return CARQUET_OK on success
  *
  * @note Thread-safe: Yes (read-only)
  *
+ * Value i of data belongs to row (entry) i; null entries hold zeroed
+ * placeholders.
+ *
  * @par Null Bitmap Format
- * The null bitmap uses 1 bit per value, with bit i set if value i is NOT null.
- * Use the following to check if value i is null:
+ * The null bitmap uses 1 bit per value, with bit i set if value i is null.
+ * With carquet_batch_reader_config_t::arrow_layout the polarity is Arrow's
+ * instead: bit i is set if value i is present, and REQUIRED columns have
+ * no bitmap. Use the following to check if value i is null:
  * @code{.c}
- * bool is_null = null_bitmap && !(null_bitmap[i / 8] & (1 << (i % 8)));
+ * bool is_null = null_bitmap && (null_bitmap[i / 8] & (1 << (i % 8)));          // default
+ * bool is_null = null_bitmap && !(null_bitmap[i / 8] & (1 << (i % 8)));         // arrow_layout
  * @endcode
  */
 CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 3, 4, 5)
@@ -1370,6 +1932,120 @@ carquet_status_t carquet_row_batch_column(
     const uint8_t** null_bitmap,
     int64_t* num_values);
 
+/**
+ * @brief Get the dictionary of a column read as indices.
+ *
+ * With carquet_batch_reader_config_t::read_dictionary set, the data of a
+ * dictionary-encoded column (see carquet_row_batch_column()) holds int32
+ * indices into the dictionary returned here. The dictionary is laid out
+ * like materialized column data: fixed-size values, or carquet_byte_array_t
+ * for BYTE_ARRAY. It is owned by the batch reader and stays valid until
+ * the reader moves to another row group or is freed.
+ *
+ * @param[in] batch Row batch
+ * @param[in] column_index Column index within the batch (0 to num_columns-1)
+ * @param[out] dictionary Dictionary values, or NULL if the column holds
+ *             materialized values
+ * @param[out] dictionary_size Number of dictionary entries
+ * @param[out] dictionary_changed True if this is the first batch of the
+ *             column to use this dictionary
+ * @return CARQUET_OK on success
+ *
+ * @note Thread-safe: Yes (read-only)
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 3, 4, 5)
+carquet_status_t carquet_row_batch_column_dictionary(
+    const carquet_row_batch_t* batch,
+    int32_t column_index,
+    const void** dictionary,
+    int32_t* dictionary_size,
+    bool* dictionary_changed);
+
+/* ============================================================================
+ * Arrow C Data Interface
+ * ============================================================================
+ *
+ * Row batches can be handed to Arrow-based engines through the Arrow C Data
+ * Interface (https://arrow.apache.org/docs/format/CDataInterface.html).
+ * The structures below are the interface's ABI; the guard lets them coexist
+ * with other headers that define them.
+ */
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+/**
+ * @brief Export a row batch as an Arrow struct array.
+ *
+ * Fills array with a struct array of one child per batch column, and
+ * schema with its type. Column buffers are handed over without copying
+ * where the layouts agree: fixed-width values always, and with
+ * carquet_batch_reader_config_t::arrow_layout also validity bitmaps and
+ * BYTE_ARRAY offsets and bytes. Otherwise the Arrow buffers are built
+ * during the export. BOOLEAN values are packed into bits. Columns read
+ * as dictionary indices become dictionary-encoded arrays with a copy of
+ * their dictionary.
+ *
+ * Physical types map to Arrow formats "b", "i", "l", "f", "g", "z"
+ * (or "u" for UTF-8 strings), "w:12" for INT96 and "w:N" for
+ * FIXED_LEN_BYTE_ARRAY.
+ *
+ * On success the batch belongs to the exported array. It is freed when
+ * the array and all children moved out of it have been released. Do not
+ * call carquet_row_batch_free() on it. The schema is independent of the
+ * batch. Values that point into a memory-mapped file require the file
+ * reader to stay open until the array is released. Without arrow_layout,
+ * export a batch before the next carquet_batch_reader_next() call,
+ * because its BYTE_ARRAY views point into the reader's pages.
+ *
+ * @param[in] batch Row batch (taken over on success)
+ * @param[out] array Arrow array to fill
+ * @param[out] schema Arrow schema to fill
+ * @return CARQUET_OK on success. CARQUET_ERROR_NOT_IMPLEMENTED if a
+ *         column is repeated (lists are not assembled). CARQUET_ERROR_INVALID_STATE
+ *         if the columns differ in length. On failure the batch is still
+ *         the caller's.
+ *
+ * @note Thread-safe: No (for the same batch). Released arrays may be
+ *       released from any thread.
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 2, 3)
+carquet_status_t carquet_row_batch_export_arrow(
+    carquet_row_batch_t* batch,
+    struct ArrowArray* array,
+    struct ArrowSchema* schema);
+
 /**
  * @brief Free a row batch.
  *
@@ -1442,6 +2118,8 @@ typedef enum carquet_compare_op {
  * @brief Check if a row group might contain values matching a predicate.
  *
  * Uses min/max statistics to determine if a row group can be safely skipped.
+ * For CARQUET_COMPARE_EQ the column chunk's bloom filter, if it has one, is
+ * consulted as well (see carquet_reader_bloom_filter_check()).
  * A return of might_match=true does not guarantee matches exist, only that
  * they cannot be ruled out based on statistics.
  *
@@ -1505,6 +2183,95 @@ int32_t carquet_reader_filter_row_groups(
     int32_t* matching_indices,
     int32_t max_indices);
 
+/**
+ * @brief Check a value against a column chunk's bloom filter.
+ *
+ * The filter is read from the file on first use and cached in the reader
+ * until it is closed. Values are given as for the predicate functions:
+ * the native value for numeric types, the raw bytes (no length prefix) for
+ * BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY. Files written with
+ * write_bloom_filters carry a filter for every non-BOOLEAN column.
+ *
+ * If the chunk has no filter, or it cannot be used (unsupported algorithm,
+ * corrupt data, a zero or NaN floating-point value), might_contain is set
+ * to true: only a definite "absent" is ever reported.
+ *
+ * @param[in] reader File reader
+ * @param[in] row_group_index Row group index
+ * @param[in] column_index Column index
+ * @param[in] value Value to look for
+ * @param[in] value_size Size of value in bytes
+ * @param[out] might_contain Set to false if the value is certainly absent
+ * @return CARQUET_OK on success, or an error for an invalid index
+ *
+ * @note Thread-safe: Yes (the filter cache is locked)
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 4, 6)
+carquet_status_t carquet_reader_bloom_filter_check(
+    const carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    const void* value,
+    int32_t value_size,
+    bool* might_contain);
+
+/**
+ * @brief A range of rows within a row group.
+ */
+typedef struct carquet_row_range {
+    int64_t first_row;      /**< First row, relative to the row group */
+    int64_t num_rows;       /**< Number of rows in the range */
+} carquet_row_range_t;
+
+/**
+ * @brief Find the rows of a row group whose pages might match a predicate.
+ *
+ * Evaluates the predicate against the per-page min/max values of the
+ * column's ColumnIndex and maps the surviving pages to row ranges through
+ * its OffsetIndex. Consecutive matching pages are merged into one range.
+ * Files written with write_page_index carry both indexes.
+ *
+ * If the column has no usable page index, the whole row group is returned
+ * as a single range. If there are more ranges than max_ranges, the last
+ * range is widened to cover the rest (still a superset of the matches).
+ *
+ * Combine with carquet_column_seek_row() to read only the matching pages.
+ *
+ * @param[in] reader File reader
+ * @param[in] row_group_index Row group index
+ * @param[in] column_index Column index
+ * @param[in] op Comparison operator
+ * @param[in] value Value to compare against
+ * @param[in] value_size Size of value in bytes
+ * @param[out] ranges Output row ranges, in row order
+ * @param[in] max_ranges Capacity of ranges
+ * @return Number of ranges (0 if no page can match), or negative on error
+ *
+ * @note Thread-safe: Yes
+ *
+ * @code{.c}
+ * carquet_row_range_t ranges[64];
+ * int32_t n = carquet_reader_filter_pages(
+ *     reader, rg, 0, CARQUET_COMPARE_EQ, &key, sizeof(key), ranges, 64);
+ *
+ * for (int32_t i = 0; i < n; i++) {
+ *     if (carquet_column_seek_row(col, ranges[i].first_row, &err) != CARQUET_OK) break;
+ *     int64_t got = carquet_column_read_batch(col, values, ranges[i].num_rows, NULL, NULL);
+ *     // ...
+ * }
+ * @endcode
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1, 5, 7)
+int32_t carquet_reader_filter_pages(
+    carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_compare_op_t op,
+    const void* value,
+    int32_t value_size,
+    carquet_row_range_t* ranges,
+    int32_t max_ranges);
+
 /* ============================================================================
  * Writer API
  * ============================================================================
@@ -1581,6 +2348,11 @@ typedef struct carquet_writer_options {
     /**
      * @brief Write bloom filters for membership testing.
      *
+     * Each non-BOOLEAN column chunk gets a split-block bloom filter sized
+     * for its distinct values at a 1% false positive rate (at most 1 MiB),
+     * written after the row group. Readers use them to skip row groups
+     * on equality predicates.
+     *
      * Default: false
      */
     bool write_bloom_filters;
@@ -1670,6 +2442,29 @@ carquet_writer_t* carquet_writer_create_file(
     const carquet_writer_options_t* options,
     carquet_error_t* error);
 
+/**
+ * @brief Set the value encoding of a column's data pages.
+ *
+ * Columns are written PLAIN by default. BYTE_STREAM_SPLIT is accepted for
+ * FLOAT and DOUBLE columns: it stores each byte position of the values as
+ * its own stream, which usually compresses much better for floating point
+ * data. The encoding applies to row groups started after this call, so set
+ * it before the first write to cover the whole file.
+ *
+ * @param[in] writer File writer
+ * @param[in] column_index Column index (0-based)
+ * @param[in] encoding CARQUET_ENCODING_PLAIN or CARQUET_ENCODING_BYTE_STREAM_SPLIT
+ * @return CARQUET_OK on success, CARQUET_ERROR_INVALID_ENCODING if the
+ *         encoding is not supported for the column's type
+ *
+ * @note Thread-safe: No
+ */
+CARQUET_API CARQUET_WARN_UNUSED_RESULT CARQUET_NONNULL(1)
+carquet_status_t carquet_writer_set_column_encoding(
+    carquet_writer_t* writer,
+    int32_t column_index,
+    carquet_encoding_t encoding);
+
 /**
  * @brief Write a batch of values to a column.
  *
@@ -7,6 +7,7 @@
  * - Dictionary gather operations
  * - Null bitmap construction
  * - Compression/decompression
+ * - Bloom filter probes and inserts
  * - SIMD dispatch overhead
  *
  * Usage:
@@ -43,6 +44,18 @@ extern int64_t carquet_dispatch_count_non_nulls(const int16_t* def_levels, int64
 extern void carquet_dispatch_build_null_bitmap(const int16_t* def_levels, int64_t count,
                                                 int16_t max_def, uint8_t* bitmap);
 
+/* Bloom filter internal functions */
+extern carquet_bloom_filter_t* carquet_bloom_filter_create(size_t num_bytes);
+extern void carquet_bloom_filter_destroy(carquet_bloom_filter_t* filter);
+extern void carquet_bloom_filter_insert_hash(carquet_bloom_filter_t* filter, uint64_t hash);
+extern void carquet_bloom_filter_insert_hashes(carquet_bloom_filter_t* filter,
+                                                const uint64_t* hashes, int64_t count);
+extern bool carquet_bloom_filter_check_hash(const carquet_bloom_filter_t* filter, uint64_t hash);
+extern void carquet_bloom_filter_check_hashes(const carquet_bloom_filter_t* filter,
+                                               const uint64_t* hashes, int64_t count,
+                                               uint8_t* out_bitmap);
+extern uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
+
 /* LZ4 internal functions */
 extern int carquet_lz4_compress(const uint8_t* src, size_t src_len,
                                  uint8_t* dst, size_t dst_capacity);
@@ -522,6 +535,117 @@ static void run_compression_benchmarks(size_t size, int64_t iterations) {
     free(decompressed);
 }
 
+/* ============================================================================
+ * Bloom Filter Micro-benchmark
+ * ============================================================================ */
+
+NOINLINE static void bench_bloom_insert_single(carquet_bloom_filter_t* filter,
+                                               const uint64_t* hashes, int64_t count,
+                                               int64_t iterations) {
+    printf("  Insert (one by one):     ");
+    fflush(stdout);
+
+    BENCH_START();
+    for (int64_t iter = 0; iter < iterations; iter++) {
+        for (int64_t i = 0; i < count; i++) {
+            carquet_bloom_filter_insert_hash(filter, hashes[i]);
+        }
+    }
+    double elapsed = BENCH_END();
+
+    double ns_per_value = elapsed / (iterations * count);
+    printf("%.2f ns/key, %.2f M keys/sec\n", ns_per_value, 1e9 / ns_per_value / 1e6);
+}
+
+NOINLINE static void bench_bloom_insert_batch(carquet_bloom_filter_t* filter,
+                                              const uint64_t* hashes, int64_t count,
+                                              int64_t iterations) {
+    printf("  Insert (batch):          ");
+    fflush(stdout);
+
+    BENCH_START();
+    for (int64_t iter = 0; iter < iterations; iter++) {
+        carquet_bloom_filter_insert_hashes(filter, hashes, count);
+    }
+    double elapsed = BENCH_END();
+
+    double ns_per_value = elapsed / (iterations * count);
+    printf("%.2f ns/key, %.2f M keys/sec\n", ns_per_value, 1e9 / ns_per_value / 1e6);
+}
+
+NOINLINE static void bench_bloom_check_single(const carquet_bloom_filter_t* filter,
+                                              const uint64_t* hashes, int64_t count,
+                                              int64_t iterations) {
+    printf("  Probe (one by one):      ");
+    fflush(stdout);
+
+    int64_t hits = 0;
+    BENCH_START();
+    for (int64_t iter = 0; iter < iterations; iter++) {
+        for (int64_t i = 0; i < count; i++) {
+            hits += carquet_bloom_filter_check_hash(filter, hashes[i]);
+        }
+    }
+    double elapsed = BENCH_END();
+    g_sink = hits;
+
+    double ns_per_value = elapsed / (iterations * count);
+    printf("%.2f ns/key, %.2f M keys/sec\n", ns_per_value, 1e9 / ns_per_value / 1e6);
+}
+
+NOINLINE static void bench_bloom_check_batch(const carquet_bloom_filter_t* filter,
+                                             const uint64_t* hashes, int64_t count,
+                                             uint8_t* bitmap, int64_t iterations) {
+    printf("  Probe (batch):           ");
+    fflush(stdout);
+
+    BENCH_START();
+    for (int64_t iter = 0; iter < iterations; iter++) {
+        carquet_bloom_filter_check_hashes(filter, hashes, count, bitmap);
+        g_sink = bitmap[count / 16];
+    }
+    double elapsed = BENCH_END();
+
+    double ns_per_value = elapsed / (iterations * count);
+    printf("%.2f ns/key, %.2f M keys/sec\n", ns_per_value, 1e9 / ns_per_value / 1e6);
+}
+
+static void run_bloom_benchmark_sized(int64_t count, int64_t iterations, size_t filter_bytes) {
+    carquet_bloom_filter_t* filter = carquet_bloom_filter_create(filter_bytes);
+    uint64_t* hashes = malloc((size_t)count * sizeof(uint64_t));
+    uint8_t* bitmap = malloc((size_t)(count + 7) / 8);
+    if (!filter || !hashes || !bitmap) {
+        carquet_bloom_filter_destroy(filter);
+        free(hashes);
+        free(bitmap);
+        return;
+    }
+
+    for (int64_t i = 0; i < count; i++) {
+        hashes[i] = carquet_xxhash64(&i, sizeof(i), 0);
+    }
+
+    printf("\nFilter size: %.2f MB\n", (double)filter_bytes / (1024.0 * 1024.0));
+
+    bench_bloom_insert_single(filter, hashes, count, iterations);
+    bench_bloom_insert_batch(filter, hashes, count, iterations);
+    bench_bloom_check_single(filter, hashes, count, iterations);
+    bench_bloom_check_batch(filter, hashes, count, bitmap, iterations);
+
+    carquet_bloom_filter_destroy(filter);
+    free(hashes);
+    free(bitmap);
+}
+
+static void run_bloom_benchmarks(int64_t count, int64_t iterations) {
+    printf("\n=== Bloom Filter Benchmarks ===\n");
+    printf("Keys: %ld, Iterations: %ld\n", (long)count, (long)iterations);
+
+    /* Cache-resident filter, then one that misses to memory on most probes */
+    run_bloom_benchmark_sized(count, iterations, 128 * 1024);
+    run_bloom_benchmark_sized(count, iterations, 64 * 1024 * 1024);
+}
+
 /* ============================================================================
  * Dispatch Overhead Benchmark
  * ============================================================================ */
@@ -578,7 +702,7 @@ static void print_usage(const char* prog) {
     printf("Usage: %s [options]\n\n", prog);
     printf("Options:\n");
     printf("  --component NAME   Component to benchmark:\n");
-    printf("                     rle, gather, null, compression, dispatch, all\n");
+    printf("                     rle, gather, null, compression, bloom, dispatch, all\n");
     printf("  --count N          Number of values (default: 1000000)\n");
     printf("  --iterations N     Number of iterations (default: 100)\n");
     printf("  -h, --help         Show this help\n");
@@ -622,6 +746,9 @@ int main(int argc, char** argv) {
     if (strcmp(component, "compression") == 0 || strcmp(component, "all") == 0) {
         run_compression_benchmarks(1024 * 1024, iterations / 10);  /* 1MB blocks */
     }
+    if (strcmp(component, "bloom") == 0 || strcmp(component, "all") == 0) {
+        run_bloom_benchmarks(count, iterations);
+    }
     if (strcmp(component, "dispatch") == 0 || strcmp(component, "all") == 0) {
         run_dispatch_overhead_benchmark(iterations * 10000);
     }
@@ -10,27 +10,28 @@
 #include <stddef.h>
 #include <zstd.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 /*
- * Thread-local storage compatibility:
- * - __thread requires macOS 10.7+ / iOS 9.0+
- * - For older targets, use pthread-based TLS
+ * Thread-local decompression contexts. Pages are decompressed concurrently
+ * by OpenMP workers and by the batch reader's read-ahead thread, so a shared
+ * context is never safe. On POSIX a pthread key frees each thread's context
+ * when the thread exits (read-ahead threads are short-lived).
  */
-#if defined(__APPLE__)
-#include <AvailabilityMacros.h>
-#if defined(MAC_OS_X_VERSION_MIN_REQUIRED) && MAC_OS_X_VERSION_MIN_REQUIRED < 1070
-#define CARQUET_USE_PTHREAD_TLS 1
-#endif
+#ifdef _WIN32
+
+#ifdef _MSC_VER
+static __declspec(thread) ZSTD_DCtx* tls_dctx = NULL;
+#else
+static __thread ZSTD_DCtx* tls_dctx = NULL;
 #endif
 
-/* Thread-local decompression contexts for parallel column reading */
-#ifdef _OPENMP
+static ZSTD_DCtx* get_dctx(void) {
+    if (!tls_dctx) {
+        tls_dctx = ZSTD_createDCtx();
+    }
+    return tls_dctx;
+}
 
-#if defined(CARQUET_USE_PTHREAD_TLS)
-/* Use pthread TLS for older macOS (< 10.7) */
+#else
 #include <pthread.h>
 
 static pthread_key_t tls_dctx_key;
@@ -58,33 +59,7 @@ static ZSTD_DCtx* get_dctx(void) {
     return dctx;
 }
 
-#else
-/* Use thread-local storage for modern systems */
-#ifdef _MSC_VER
-static __declspec(thread) ZSTD_DCtx* tls_dctx = NULL;
-#else
-static __thread ZSTD_DCtx* tls_dctx = NULL;
-#endif
-
-static ZSTD_DCtx* get_dctx(void) {
-    if (!tls_dctx) {
-        tls_dctx = ZSTD_createDCtx();
-    }
-    return tls_dctx;
-}
-#endif /* CARQUET_USE_PTHREAD_TLS */
-
-#else
-/* No OpenMP - use global context */
-static ZSTD_DCtx* global_dctx = NULL;
-
-static ZSTD_DCtx* get_dctx(void) {
-    if (!global_dctx) {
-        global_dctx = ZSTD_createDCtx();
-    }
-    return global_dctx;
-}
-#endif /* _OPENMP */
+#endif /* _WIN32 */
 
 int carquet_zstd_decompress(
     const uint8_t* src,
@@ -458,7 +458,8 @@ void carquet_bit_writer_write_bits(carquet_bit_writer_t* writer,
     writer->buffer |= (uint64_t)(value & mask) << writer->buffer_bits;
     writer->buffer_bits += num_bits;
 
-    if (writer->buffer_bits >= 56) {
+    /* Keep room for the next write of up to 32 bits */
+    if (writer->buffer_bits > 32) {
         flush_buffer(writer);
     }
 }
@@ -493,3 +494,102 @@ void carquet_bit_writer_flush(carquet_bit_writer_t* writer) {
 size_t carquet_bit_writer_bytes_written(const carquet_bit_writer_t* writer) {
     return writer->byte_pos;
 }
+
+/* ============================================================================
+ * Bitmaps
+ * ============================================================================
+ */
+
+void carquet_bitmap_fill(uint8_t* bitmap, int64_t offset, int64_t count, bool value) {
+    if (count <= 0) {
+        return;
+    }
+
+    /* Leading bits up to a byte boundary */
+    int shift = (int)(offset % 8);
+    if (shift != 0) {
+        int n = count < 8 - shift ? (int)count : 8 - shift;
+        uint8_t mask = (uint8_t)(((1u << n) - 1) << shift);
+        uint8_t* byte = bitmap + offset / 8;
+        *byte = value ? (uint8_t)(*byte | mask) : (uint8_t)(*byte & ~mask);
+        offset += n;
+        count -= n;
+    }
+
+    /* Whole bytes, then the trailing bits */
+    memset(bitmap + offset / 8, value ? 0xFF : 0x00, (size_t)(count / 8));
+    offset += count & ~(int64_t)7;
+    if (count % 8) {
+        uint8_t mask = (uint8_t)((1u << (count % 8)) - 1);
+        uint8_t* byte = bitmap + offset / 8;
+        *byte = value ? (uint8_t)(*byte | mask) : (uint8_t)(*byte & ~mask);
+    }
+}
+
+/* Up to 8 bits of src starting at bit offset, without reading past them */
+static inline uint8_t load_bits8(const uint8_t* src, int64_t offset, int n) {
+    const uint8_t* p = src + offset / 8;
+    int shift = (int)(offset % 8);
+    uint32_t bits = (uint32_t)p[0] >> shift;
+    if (shift + n > 8) {
+        bits |= (uint32_t)p[1] << (8 - shift);
+    }
+    return (uint8_t)(bits & ((1u << n) - 1));
+}
+
+int64_t carquet_bitmap_copy(uint8_t* dst, int64_t dst_offset,
+                            const uint8_t* src, int64_t src_offset, int64_t count) {
+    int64_t set = 0;
+
+    /* Both sides byte aligned: whole bytes are copied as is */
+    if (((dst_offset | src_offset) & 7) == 0 && count >= 8) {
+        size_t bytes = (size_t)(count / 8);
+        const uint8_t* from = src + src_offset / 8;
+        memcpy(dst + dst_offset / 8, from, bytes);
+        for (size_t i = 0; i < bytes; i++) {
+            set += carquet_popcount32(from[i]);
+        }
+        dst_offset += (int64_t)bytes * 8;
+        src_offset += (int64_t)bytes * 8;
+        count -= (int64_t)bytes * 8;
+    }
+
+    /* Otherwise fill one destination byte (or the part of it) at a time */
+    while (count > 0) {
+        int shift = (int)(dst_offset % 8);
+        int n = count < 8 - shift ? (int)count : 8 - shift;
+        uint8_t bits = load_bits8(src, src_offset, n);
+        uint8_t mask = (uint8_t)(((1u << n) - 1) << shift);
+        uint8_t* byte = dst + dst_offset / 8;
+        *byte = (uint8_t)((*byte & ~mask) | (bits << shift));
+        set += carquet_popcount32(bits);
+        dst_offset += n;
+        src_offset += n;
+        count -= n;
+    }
+    return set;
+}
+
+int64_t carquet_bitmap_count(const uint8_t* bitmap, int64_t offset, int64_t count) {
+    int64_t set = 0;
+
+    /* Up to the first byte boundary, then whole bytes, then the rest */
+    int head = (int)((8 - offset % 8) % 8);
+    if (head > count) {
+        head = (int)count;
+    }
+    if (head > 0) {
+        set += carquet_popcount32(load_bits8(bitmap, offset, head));
+        offset += head;
+        count -= head;
+    }
+    const uint8_t* bytes = bitmap + offset / 8;
+    int64_t whole = count / 8;
+    for (int64_t i = 0; i < whole; i++) {
+        set += carquet_popcount32(bytes[i]);
+    }
+    if (count % 8) {
+        set += carquet_popcount32(load_bits8(bitmap, offset + whole * 8, (int)(count % 8)));
+    }
+    return set;
+}
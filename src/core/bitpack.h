@@ -328,6 +328,30 @@ void carquet_bit_writer_flush(carquet_bit_writer_t* writer);
  */
 size_t carquet_bit_writer_bytes_written(const carquet_bit_writer_t* writer);
 
+/* ============================================================================
+ * Bitmaps
+ * ============================================================================
+ */
+
+/**
+ * Set or clear bits [offset, offset + count) of a bitmap (LSB first).
+ */
+void carquet_bitmap_fill(uint8_t* bitmap, int64_t offset, int64_t count, bool value);
+
+/**
+ * Copy count bits from src at bit src_offset to dst at bit dst_offset,
+ * leaving the other bits of dst unchanged.
+ *
+ * @return Number of set bits copied
+ */
+int64_t carquet_bitmap_copy(uint8_t* dst, int64_t dst_offset,
+                            const uint8_t* src, int64_t src_offset, int64_t count);
+
+/**
+ * Count the set bits among bits [offset, offset + count) of a bitmap.
+ */
+int64_t carquet_bitmap_count(const uint8_t* bitmap, int64_t offset, int64_t count);
+
 #ifdef __cplusplus
 }
 #endif
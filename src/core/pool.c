@@ -0,0 +1,104 @@
+/**
+ * @file pool.c
+ * @brief Size-class buffer pool implementation
+ */
+
+#include "pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Helpers
+ * ============================================================================
+ */
+
+#define POOL_MAX_BLOCK ((size_t)1 << (CARQUET_POOL_MIN_CLASS + CARQUET_POOL_NUM_CLASSES - 1))
+
+static inline size_t class_size(int c) {
+    return (size_t)1 << (c + CARQUET_POOL_MIN_CLASS);
+}
+
+/* Smallest class whose blocks hold size bytes (size <= POOL_MAX_BLOCK) */
+static int class_for_size(size_t size) {
+    int c = 0;
+    while (class_size(c) < size) {
+        c++;
+    }
+    return c;
+}
+
+/* Largest class whose size capacity covers, or -1 if below the first */
+static int class_for_capacity(size_t capacity) {
+    int c = -1;
+    while (c + 1 < CARQUET_POOL_NUM_CLASSES && class_size(c + 1) <= capacity) {
+        c++;
+    }
+    return c;
+}
+
+/* ============================================================================
+ * Pool Operations
+ * ============================================================================
+ */
+
+void carquet_buffer_pool_init(carquet_buffer_pool_t* pool) {
+    memset(pool->free_blocks, 0, sizeof(pool->free_blocks));
+    carquet_mutex_init(&pool->mutex);
+}
+
+void carquet_buffer_pool_destroy(carquet_buffer_pool_t* pool) {
+    for (int c = 0; c < CARQUET_POOL_NUM_CLASSES; c++) {
+        void* block = pool->free_blocks[c];
+        while (block) {
+            void* next;
+            memcpy(&next, block, sizeof(next));
+            free(block);
+            block = next;
+        }
+        pool->free_blocks[c] = NULL;
+    }
+    carquet_mutex_destroy(&pool->mutex);
+}
+
+void* carquet_buffer_pool_acquire(carquet_buffer_pool_t* pool, size_t size, size_t* capacity) {
+    if (!pool || size > POOL_MAX_BLOCK) {
+        *capacity = size;
+        return malloc(size > 0 ? size : 1);
+    }
+
+    /* A block one class up is fine too: it saves a malloc when sizes
+     * shrink (the last batch of a row group) */
+    int c = class_for_size(size);
+    void* block = NULL;
+    carquet_mutex_lock(&pool->mutex);
+    for (int k = c; k <= c + 1 && k < CARQUET_POOL_NUM_CLASSES && !block; k++) {
+        block = pool->free_blocks[k];
+        if (block) {
+            memcpy(&pool->free_blocks[k], block, sizeof(void*));
+            c = k;
+        }
+    }
+    carquet_mutex_unlock(&pool->mutex);
+
+    if (!block) {
+        block = malloc(class_size(c));
+    }
+    *capacity = block ? class_size(c) : 0;
+    return block;
+}
+
+void carquet_buffer_pool_release(carquet_buffer_pool_t* pool, void* block, size_t capacity) {
+    if (!block) {
+        return;
+    }
+    int c = pool ? class_for_capacity(capacity) : -1;
+    if (c < 0 || capacity > POOL_MAX_BLOCK) {
+        free(block);
+        return;
+    }
+
+    carquet_mutex_lock(&pool->mutex);
+    memcpy(block, &pool->free_blocks[c], sizeof(void*));
+    pool->free_blocks[c] = block;
+    carquet_mutex_unlock(&pool->mutex);
+}
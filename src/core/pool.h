@@ -0,0 +1,76 @@
+/**
+ * @file pool.h
+ * @brief Size-class buffer pool
+ *
+ * A buffer pool keeps released heap blocks on free lists by power-of-two
+ * size class and hands them out again, so code that allocates buffers of
+ * the same sizes over and over (e.g. the column buffers of successive row
+ * batches) stops going to the heap once the pool is warm. Blocks are plain
+ * malloc() blocks: one that never comes back can be released with free().
+ */
+
+#ifndef CARQUET_CORE_POOL_H
+#define CARQUET_CORE_POOL_H
+
+#include "thread.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Constants
+ * ============================================================================
+ */
+
+#define CARQUET_POOL_MIN_CLASS 6       /* 64 bytes */
+#define CARQUET_POOL_NUM_CLASSES 25    /* 64 bytes .. 1 GB */
+
+/* ============================================================================
+ * Types
+ * ============================================================================
+ */
+
+/**
+ * Buffer pool. Free blocks of class c hold at least 2^(c + MIN_CLASS)
+ * bytes and are linked through their first word. Safe to share between
+ * threads.
+ */
+typedef struct carquet_buffer_pool {
+    void* free_blocks[CARQUET_POOL_NUM_CLASSES];
+    carquet_mutex_t mutex;
+} carquet_buffer_pool_t;
+
+/* ============================================================================
+ * Pool Operations
+ * ============================================================================
+ */
+
+void carquet_buffer_pool_init(carquet_buffer_pool_t* pool);
+
+/**
+ * Free every block held by the pool.
+ */
+void carquet_buffer_pool_destroy(carquet_buffer_pool_t* pool);
+
+/**
+ * Get a block of at least size bytes; *capacity gets its real size.
+ * Sizes are rounded up to their class, so the block can go back to the
+ * pool. With a NULL pool this is malloc(size).
+ *
+ * @return The block (contents undefined), or NULL on failure
+ */
+void* carquet_buffer_pool_acquire(carquet_buffer_pool_t* pool, size_t size, size_t* capacity);
+
+/**
+ * Give back a block of capacity bytes obtained from malloc(). Blocks too
+ * small or too large to pool, and any block with a NULL pool, are freed.
+ */
+void carquet_buffer_pool_release(carquet_buffer_pool_t* pool, void* block, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CARQUET_CORE_POOL_H */
@@ -0,0 +1,105 @@
+/**
+ * @file thread.c
+ * @brief Minimal portable threading primitives implementation
+ */
+
+#include "thread.h"
+#include <stdlib.h>
+
+/* ============================================================================
+ * Threads
+ * ============================================================================
+ */
+
+typedef struct thread_start {
+    carquet_thread_fn fn;
+    void* arg;
+} thread_start_t;
+
+#ifdef _WIN32
+
+static DWORD WINAPI thread_trampoline(LPVOID param) {
+    thread_start_t start = *(thread_start_t*)param;
+    free(param);
+    start.fn(start.arg);
+    return 0;
+}
+
+#else
+
+static void* thread_trampoline(void* param) {
+    thread_start_t start = *(thread_start_t*)param;
+    free(param);
+    start.fn(start.arg);
+    return NULL;
+}
+
+#endif
+
+carquet_status_t carquet_thread_create(carquet_thread_t* thread,
+                                       carquet_thread_fn fn, void* arg) {
+    thread_start_t* start = malloc(sizeof(thread_start_t));
+    if (!start) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    start->fn = fn;
+    start->arg = arg;
+
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, thread_trampoline, start, 0, NULL);
+    if (*thread == NULL) {
+        free(start);
+        return CARQUET_ERROR_INTERNAL;
+    }
+#else
+    if (pthread_create(thread, NULL, thread_trampoline, start) != 0) {
+        free(start);
+        return CARQUET_ERROR_INTERNAL;
+    }
+#endif
+    return CARQUET_OK;
+}
+
+void carquet_thread_join(carquet_thread_t thread) {
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+/* ============================================================================
+ * Mutexes and Condition Variables
+ * ============================================================================
+ */
+
+#ifdef _WIN32
+
+void carquet_mutex_init(carquet_mutex_t* mutex) { InitializeCriticalSection(mutex); }
+void carquet_mutex_destroy(carquet_mutex_t* mutex) { DeleteCriticalSection(mutex); }
+void carquet_mutex_lock(carquet_mutex_t* mutex) { EnterCriticalSection(mutex); }
+void carquet_mutex_unlock(carquet_mutex_t* mutex) { LeaveCriticalSection(mutex); }
+
+void carquet_cond_init(carquet_cond_t* cond) { InitializeConditionVariable(cond); }
+void carquet_cond_destroy(carquet_cond_t* cond) { (void)cond; }
+void carquet_cond_wait(carquet_cond_t* cond, carquet_mutex_t* mutex) {
+    SleepConditionVariableCS(cond, mutex, INFINITE);
+}
+void carquet_cond_broadcast(carquet_cond_t* cond) { WakeAllConditionVariable(cond); }
+
+#else
+
+void carquet_mutex_init(carquet_mutex_t* mutex) { pthread_mutex_init(mutex, NULL); }
+void carquet_mutex_destroy(carquet_mutex_t* mutex) { pthread_mutex_destroy(mutex); }
+void carquet_mutex_lock(carquet_mutex_t* mutex) { pthread_mutex_lock(mutex); }
+void carquet_mutex_unlock(carquet_mutex_t* mutex) { pthread_mutex_unlock(mutex); }
+
+void carquet_cond_init(carquet_cond_t* cond) { pthread_cond_init(cond, NULL); }
+void carquet_cond_destroy(carquet_cond_t* cond) { pthread_cond_destroy(cond); }
+void carquet_cond_wait(carquet_cond_t* cond, carquet_mutex_t* mutex) {
+    pthread_cond_wait(cond, mutex);
+}
+void carquet_cond_broadcast(carquet_cond_t* cond) { pthread_cond_broadcast(cond); }
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file thread.h
+ * @brief Minimal portable threading primitives
+ *
+ * Thin wrappers over pthreads (POSIX) and Win32 threads, used for
+ * background work that outlives a single call (e.g. row group read-ahead)
+ * where OpenMP parallel regions do not fit.
+ */
+
+#ifndef CARQUET_CORE_THREAD_H
+#define CARQUET_CORE_THREAD_H
+
+#include <carquet/error.h>
+#include <stdbool.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Types
+ * ============================================================================
+ */
+
+#ifdef _WIN32
+typedef HANDLE carquet_thread_t;
+typedef CRITICAL_SECTION carquet_mutex_t;
+typedef CONDITION_VARIABLE carquet_cond_t;
+#else
+typedef pthread_t carquet_thread_t;
+typedef pthread_mutex_t carquet_mutex_t;
+typedef pthread_cond_t carquet_cond_t;
+#endif
+
+typedef void (*carquet_thread_fn)(void* arg);
+
+/* ============================================================================
+ * Threads
+ * ============================================================================
+ */
+
+/**
+ * Start a thread running fn(arg).
+ */
+carquet_status_t carquet_thread_create(carquet_thread_t* thread,
+                                       carquet_thread_fn fn, void* arg);
+
+/**
+ * Wait for a thread to finish.
+ */
+void carquet_thread_join(carquet_thread_t thread);
+
+/* ============================================================================
+ * Mutexes and Condition Variables
+ * ============================================================================
+ */
+
+void carquet_mutex_init(carquet_mutex_t* mutex);
+void carquet_mutex_destroy(carquet_mutex_t* mutex);
+void carquet_mutex_lock(carquet_mutex_t* mutex);
+void carquet_mutex_unlock(carquet_mutex_t* mutex);
+
+void carquet_cond_init(carquet_cond_t* cond);
+void carquet_cond_destroy(carquet_cond_t* cond);
+void carquet_cond_wait(carquet_cond_t* cond, carquet_mutex_t* mutex);
+void carquet_cond_broadcast(carquet_cond_t* cond);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CARQUET_CORE_THREAD_H */
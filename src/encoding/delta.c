@@ -14,6 +14,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* From simd/dispatch.c */
+extern void carquet_dispatch_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                          uint32_t* values);
+extern void carquet_dispatch_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial);
+extern void carquet_dispatch_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial);
+
 /* ============================================================================
  * Constants
  * ============================================================================
@@ -35,21 +41,15 @@ typedef struct {
 
     int32_t block_size;
     int32_t mini_blocks_per_block;
+    int32_t mini_block_size;
     int32_t total_values;
-    int32_t values_decoded;
 
     int64_t first_value;
-    int64_t last_value;
 
     /* Current block state */
     int64_t min_delta;
     uint8_t bit_widths[DELTA_MINI_BLOCKS];
     int32_t current_mini_block;
-    int32_t values_in_mini_block;
-
-    /* Mini-block buffer */
-    int64_t mini_block_values[DELTA_MINI_BLOCK_SIZE];
-    int32_t mini_block_pos;
 } delta_decoder_t;
 
 /* ============================================================================
@@ -112,8 +112,10 @@ static carquet_status_t delta_decoder_init(delta_decoder_t* dec,
     if (dec->block_size <= 0 || dec->block_size > DELTA_BLOCK_SIZE) {
         return CARQUET_ERROR_DECODE;
     }
-    /* mini_block_size = block_size / mini_blocks_per_block must fit in buffer */
-    if (dec->block_size / dec->mini_blocks_per_block > DELTA_MINI_BLOCK_SIZE) {
+    /* mini_block_size = block_size / mini_blocks_per_block must fit in buffer,
+     * and whole groups of 8 keep every mini-block byte aligned */
+    dec->mini_block_size = dec->block_size / dec->mini_blocks_per_block;
+    if (dec->mini_block_size > DELTA_MINI_BLOCK_SIZE || dec->mini_block_size % 8 != 0) {
         return CARQUET_ERROR_DECODE;
     }
 
@@ -129,9 +131,7 @@ static carquet_status_t delta_decoder_init(delta_decoder_t* dec,
     dec->first_value = zigzag_decode64(val);
     dec->pos += bytes;
 
-    dec->last_value = dec->first_value;
     dec->current_mini_block = dec->mini_blocks_per_block; /* Force block read */
-    dec->mini_block_pos = DELTA_MINI_BLOCK_SIZE; /* Force mini-block read */
 
     return CARQUET_OK;
 }
@@ -159,85 +159,91 @@ static carquet_status_t delta_decoder_read_block(delta_decoder_t* dec) {
     return CARQUET_OK;
 }
 
-static carquet_status_t delta_decoder_read_mini_block(delta_decoder_t* dec) {
+/**
+ * Step over the next mini-block, reading a new block header first if the
+ * current block is used up. Returns its bit width and packed bytes.
+ */
+static carquet_status_t delta_decoder_next_mini_block(delta_decoder_t* dec,
+                                                      int* bit_width,
+                                                      const uint8_t** packed) {
     if (dec->current_mini_block >= dec->mini_blocks_per_block) {
         carquet_status_t status = delta_decoder_read_block(dec);
         if (status != CARQUET_OK) return status;
     }
 
-    int bit_width = dec->bit_widths[dec->current_mini_block];
-    int mini_block_size = dec->block_size / dec->mini_blocks_per_block;
+    *bit_width = dec->bit_widths[dec->current_mini_block++];
+    if (*bit_width > 64) {
+        return CARQUET_ERROR_DECODE;
+    }
 
-    if (bit_width == 0) {
-        /* All deltas are min_delta */
-        for (int i = 0; i < mini_block_size; i++) {
-            dec->mini_block_values[i] = dec->min_delta;
-        }
-    } else if (bit_width <= 32) {
-        /* Unpack bit-packed deltas (32-bit) */
-        size_t packed_size = (mini_block_size * bit_width + 7) / 8;
-        if (dec->pos + packed_size > dec->size) {
-            return CARQUET_ERROR_DECODE;
-        }
+    /* mini_block_size is a multiple of 8, so this is exact */
+    size_t packed_size = (size_t)dec->mini_block_size * (size_t)*bit_width / 8;
+    if (packed_size > dec->size - dec->pos) {
+        return CARQUET_ERROR_DECODE;
+    }
+    *packed = dec->data + dec->pos;
+    dec->pos += packed_size;
+    return CARQUET_OK;
+}
 
-        uint32_t unpacked[DELTA_MINI_BLOCK_SIZE];
-        carquet_bitunpack_32(dec->data + dec->pos, mini_block_size, bit_width, unpacked);
+/**
+ * Unpack the next mini-block as 32-bit deltas with min_delta applied.
+ * INT32 columns are reconstructed modulo 2^32, so only the low 32 bits of
+ * each delta matter.
+ */
+static carquet_status_t delta_decoder_unpack_i32(delta_decoder_t* dec, int32_t* deltas) {
+    int bit_width;
+    const uint8_t* packed;
+    carquet_status_t status = delta_decoder_next_mini_block(dec, &bit_width, &packed);
+    if (status != CARQUET_OK) return status;
 
-        for (int i = 0; i < mini_block_size; i++) {
-            /* Use unsigned addition to avoid overflow UB */
-            dec->mini_block_values[i] = (int64_t)((uint64_t)dec->min_delta + (uint64_t)unpacked[i]);
-        }
+    int n = dec->mini_block_size;
+    uint32_t min_delta = (uint32_t)dec->min_delta;
+    uint32_t* out = (uint32_t*)deltas;
 
-        dec->pos += packed_size;
-    } else {
-        /* Unpack 64-bit values (stored as little-endian bytes) */
-        int bytes_per_value = (bit_width + 7) / 8;
-        size_t packed_size = mini_block_size * bytes_per_value;
-        if (dec->pos + packed_size > dec->size) {
-            return CARQUET_ERROR_DECODE;
+    if (bit_width <= 32) {
+        carquet_dispatch_bitunpack_32(packed, n, bit_width, out);
+        for (int i = 0; i < n; i++) {
+            out[i] += min_delta;
         }
-
-        for (int i = 0; i < mini_block_size; i++) {
-            uint64_t val = 0;
-            for (int b = 0; b < bytes_per_value; b++) {
-                val |= (uint64_t)dec->data[dec->pos++] << (b * 8);
-            }
-            /* Use unsigned addition to avoid overflow UB */
-            dec->mini_block_values[i] = (int64_t)((uint64_t)dec->min_delta + val);
+    } else {
+        /* Wider deltas are bit-packed the same way, just not in groups
+         * the 32-bit kernels handle */
+        carquet_bit_reader_t reader;
+        carquet_bit_reader_init(&reader, packed, (size_t)n * (size_t)bit_width / 8);
+        for (int i = 0; i < n; i++) {
+            out[i] = (uint32_t)carquet_bit_reader_read_bits64(&reader, bit_width) + min_delta;
         }
     }
-
-    dec->current_mini_block++;
-    dec->mini_block_pos = 0;
-    dec->values_in_mini_block = mini_block_size;
-
     return CARQUET_OK;
 }
 
-static carquet_status_t delta_decoder_next(delta_decoder_t* dec, int64_t* value) {
-    if (dec->values_decoded >= dec->total_values) {
-        return CARQUET_ERROR_END_OF_DATA;
-    }
+/**
+ * Unpack the next mini-block as 64-bit deltas with min_delta applied.
+ */
+static carquet_status_t delta_decoder_unpack_i64(delta_decoder_t* dec, int64_t* deltas) {
+    int bit_width;
+    const uint8_t* packed;
+    carquet_status_t status = delta_decoder_next_mini_block(dec, &bit_width, &packed);
+    if (status != CARQUET_OK) return status;
 
-    /* First value is special */
-    if (dec->values_decoded == 0) {
-        *value = dec->first_value;
-        dec->values_decoded++;
-        return CARQUET_OK;
-    }
+    int n = dec->mini_block_size;
+    uint64_t min_delta = (uint64_t)dec->min_delta;
 
-    /* Read from mini-block */
-    if (dec->mini_block_pos >= dec->values_in_mini_block) {
-        carquet_status_t status = delta_decoder_read_mini_block(dec);
-        if (status != CARQUET_OK) return status;
+    /* Use unsigned addition to avoid overflow UB */
+    if (bit_width <= 32) {
+        uint32_t unpacked[DELTA_MINI_BLOCK_SIZE];
+        carquet_dispatch_bitunpack_32(packed, n, bit_width, unpacked);
+        for (int i = 0; i < n; i++) {
+            deltas[i] = (int64_t)(min_delta + unpacked[i]);
+        }
+    } else {
+        carquet_bit_reader_t reader;
+        carquet_bit_reader_init(&reader, packed, (size_t)n * (size_t)bit_width / 8);
+        for (int i = 0; i < n; i++) {
+            deltas[i] = (int64_t)(min_delta + carquet_bit_reader_read_bits64(&reader, bit_width));
+        }
     }
-
-    int64_t delta = dec->mini_block_values[dec->mini_block_pos++];
-    /* Use unsigned addition to avoid overflow UB, then reinterpret as signed */
-    dec->last_value = (int64_t)((uint64_t)dec->last_value + (uint64_t)delta);
-    *value = dec->last_value;
-    dec->values_decoded++;
-
     return CARQUET_OK;
 }
 
@@ -246,6 +252,13 @@ static carquet_status_t delta_decoder_next(delta_decoder_t* dec, int64_t* value)
  * ============================================================================
  */
 
+/*
+ * Both decoders work a mini-block at a time: its deltas are unpacked straight
+ * into the output and turned into values by a prefix sum seeded with the
+ * previous value. Only a final, partially wanted mini-block goes through a
+ * scratch buffer.
+ */
+
 carquet_status_t carquet_delta_decode_int32(
     const uint8_t* data,
     size_t data_size,
@@ -259,13 +272,36 @@ carquet_status_t carquet_delta_decode_int32(
         return status;
     }
 
-    for (int32_t i = 0; i < num_values; i++) {
-        int64_t val;
-        status = delta_decoder_next(&dec, &val);
-        if (status != CARQUET_OK) {
-            return status;
+    if (num_values > 0) {
+        if (num_values > dec.total_values) {
+            return CARQUET_ERROR_END_OF_DATA;
+        }
+
+        values[0] = (int32_t)dec.first_value;
+        int32_t decoded = 1;
+
+        while (decoded < num_values) {
+            int32_t* out = values + decoded;
+            int32_t wanted = num_values - decoded;
+            int32_t scratch[DELTA_MINI_BLOCK_SIZE];
+
+            if (wanted < dec.mini_block_size) {
+                out = scratch;
+            } else {
+                wanted = dec.mini_block_size;
+            }
+
+            status = delta_decoder_unpack_i32(&dec, out);
+            if (status != CARQUET_OK) {
+                return status;
+            }
+            carquet_dispatch_prefix_sum_i32(out, wanted, values[decoded - 1]);
+
+            if (out == scratch) {
+                memcpy(values + decoded, scratch, (size_t)wanted * sizeof(int32_t));
+            }
+            decoded += wanted;
         }
-        values[i] = (int32_t)val;
     }
 
     if (bytes_consumed) {
@@ -288,10 +324,35 @@ carquet_status_t carquet_delta_decode_int64(
         return status;
     }
 
-    for (int32_t i = 0; i < num_values; i++) {
-        status = delta_decoder_next(&dec, &values[i]);
-        if (status != CARQUET_OK) {
-            return status;
+    if (num_values > 0) {
+        if (num_values > dec.total_values) {
+            return CARQUET_ERROR_END_OF_DATA;
+        }
+
+        values[0] = dec.first_value;
+        int32_t decoded = 1;
+
+        while (decoded < num_values) {
+            int64_t* out = values + decoded;
+            int32_t wanted = num_values - decoded;
+            int64_t scratch[DELTA_MINI_BLOCK_SIZE];
+
+            if (wanted < dec.mini_block_size) {
+                out = scratch;
+            } else {
+                wanted = dec.mini_block_size;
+            }
+
+            status = delta_decoder_unpack_i64(&dec, out);
+            if (status != CARQUET_OK) {
+                return status;
+            }
+            carquet_dispatch_prefix_sum_i64(out, wanted, values[decoded - 1]);
+
+            if (out == scratch) {
+                memcpy(values + decoded, scratch, (size_t)wanted * sizeof(int64_t));
+            }
+            decoded += wanted;
         }
     }
 
@@ -387,16 +448,8 @@ static carquet_status_t delta_encoder_flush_block(delta_encoder_t* enc) {
         }
 
         bit_widths[mb] = (uint8_t)bit_width_required(max_val);
-        if (bit_widths[mb] > 0) {
-            /* Calculate bytes needed for this mini-block */
-            if (bit_widths[mb] <= 32) {
-                /* Bitpacked: mini_block_size values * bit_width / 8 */
-                packed_bytes_needed += (size_t)mini_block_size * bit_widths[mb] / 8;
-            } else {
-                /* Byte-by-byte: mini_block_size values * bytes_per_value */
-                packed_bytes_needed += (size_t)mini_block_size * ((bit_widths[mb] + 7) / 8);
-            }
-        }
+        /* Bitpacked: mini_block_size values * bit_width / 8 */
+        packed_bytes_needed += (size_t)mini_block_size * bit_widths[mb] / 8;
     }
 
     /* Check capacity: min_delta varint (max 10) + bit_widths + packed data */
@@ -434,21 +487,18 @@ static carquet_status_t delta_encoder_flush_block(delta_encoder_t* enc) {
             enc->pos += carquet_bitpack_32(to_pack, mini_block_size,
                                             bit_widths[mb], enc->data + enc->pos);
         } else {
-            /* For bit widths > 32, pack directly as bytes (little-endian) */
-            int bytes_per_value = (bit_widths[mb] + 7) / 8;
-            for (int i = start; i < end; i++) {
+            /* Wider bit widths are bit-packed the same way, through the
+             * 64-bit bit writer (padding values are zero) */
+            size_t packed_size = (size_t)mini_block_size * bit_widths[mb] / 8;
+            carquet_bit_writer_t writer;
+            carquet_bit_writer_init(&writer, enc->data + enc->pos, packed_size);
+            for (int i = start; i < start + mini_block_size; i++) {
                 /* Use unsigned subtraction to avoid overflow UB */
-                uint64_t adjusted = (uint64_t)enc->deltas[i] - (uint64_t)min_delta;
-                for (int b = 0; b < bytes_per_value; b++) {
-                    enc->data[enc->pos++] = (uint8_t)(adjusted >> (b * 8));
-                }
-            }
-            /* Pad with zeros */
-            for (int i = end - start; i < mini_block_size; i++) {
-                for (int b = 0; b < bytes_per_value; b++) {
-                    enc->data[enc->pos++] = 0;
-                }
+                uint64_t adjusted = i < end ? (uint64_t)enc->deltas[i] - (uint64_t)min_delta : 0;
+                carquet_bit_writer_write_bits64(&writer, adjusted, bit_widths[mb]);
             }
+            carquet_bit_writer_flush(&writer);
+            enc->pos += packed_size;
         }
     }
 
@@ -488,8 +538,9 @@ carquet_status_t carquet_delta_encode_int32(
 
     /* Encode remaining values */
     for (int32_t i = 1; i < num_values; i++) {
-        /* Use unsigned subtraction to avoid overflow UB, then reinterpret as signed */
-        int64_t delta = (int64_t)((uint64_t)(int64_t)values[i] - (uint64_t)enc.last_value);
+        /* Deltas wrap at 32 bits, so no mini-block needs more than 32 bits
+         * (readers that decode INT32 in 32-bit arithmetic reject wider ones) */
+        int64_t delta = (int32_t)((uint32_t)values[i] - (uint32_t)enc.last_value);
         enc.deltas[enc.delta_count++] = delta;
         enc.last_value = values[i];
 
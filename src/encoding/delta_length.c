@@ -111,6 +111,58 @@ carquet_status_t carquet_delta_length_decode(
     return CARQUET_OK;
 }
 
+/**
+ * Decode DELTA_LENGTH_BYTE_ARRAY encoded data as offsets into the encoded
+ * bytes, which already hold the values back to back.
+ *
+ * @param data Input buffer containing encoded data
+ * @param data_size Size of input buffer
+ * @param num_values Number of values to decode
+ * @param offsets Output: num_values + 1 offsets; value i spans
+ *                [offsets[i], offsets[i + 1]) of *chars
+ * @param chars Output: start of the concatenated values inside data
+ * @param bytes_consumed Output: number of input bytes consumed (optional)
+ * @return Status code
+ */
+carquet_status_t carquet_delta_length_decode_offsets(
+    const uint8_t* data,
+    size_t data_size,
+    int32_t num_values,
+    int32_t* offsets,
+    const uint8_t** chars,
+    size_t* bytes_consumed) {
+
+    if (!data || !offsets || !chars || num_values <= 0) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Lengths land one slot up and are summed into offsets in place */
+    size_t lengths_consumed = 0;
+    carquet_status_t status = carquet_delta_decode_int32(
+        data, data_size, offsets + 1, num_values, &lengths_consumed);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    size_t available = data_size - lengths_consumed;
+    size_t total = 0;
+    offsets[0] = 0;
+    for (int32_t i = 1; i <= num_values; i++) {
+        if (offsets[i] < 0 || (size_t)offsets[i] > available - total) {
+            return CARQUET_ERROR_DECODE;
+        }
+        total += (size_t)offsets[i];
+        offsets[i] = (int32_t)total;
+    }
+
+    *chars = data + lengths_consumed;
+    if (bytes_consumed) {
+        *bytes_consumed = lengths_consumed + total;
+    }
+
+    return CARQUET_OK;
+}
+
 /* ============================================================================
  * DELTA_LENGTH_BYTE_ARRAY Encoder
  * ============================================================================
@@ -198,6 +198,112 @@ carquet_status_t carquet_delta_strings_decode(
     return CARQUET_OK;
 }
 
+/**
+ * Decode DELTA_BYTE_ARRAY encoded data into one contiguous buffer of the
+ * rebuilt values plus offsets into it.
+ *
+ * @param data Input buffer containing encoded data
+ * @param data_size Size of input buffer
+ * @param num_values Number of values to decode
+ * @param offsets Output: num_values + 1 offsets; value i spans
+ *                [offsets[i], offsets[i + 1]) of *chars
+ * @param chars In/out: malloc'd value buffer, grown as needed
+ * @param chars_capacity In/out: capacity of *chars
+ * @param bytes_consumed Output: number of input bytes consumed (optional)
+ * @return Status code
+ */
+carquet_status_t carquet_delta_strings_decode_offsets(
+    const uint8_t* data,
+    size_t data_size,
+    int32_t num_values,
+    int32_t* offsets,
+    uint8_t** chars,
+    size_t* chars_capacity,
+    size_t* bytes_consumed) {
+
+    if (!data || !offsets || !chars || !chars_capacity || num_values <= 0) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    int32_t* prefix_lengths = malloc(num_values * sizeof(int32_t));
+    if (!prefix_lengths) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* Prefix lengths, then suffix lengths one slot up in offsets */
+    size_t pos = 0;
+    size_t consumed = 0;
+    carquet_status_t status = carquet_delta_decode_int32(
+        data, data_size, prefix_lengths, num_values, &consumed);
+    if (status == CARQUET_OK) {
+        pos += consumed;
+        status = carquet_delta_decode_int32(
+            data + pos, data_size - pos, offsets + 1, num_values, &consumed);
+    }
+    if (status != CARQUET_OK) {
+        free(prefix_lengths);
+        return status;
+    }
+    pos += consumed;
+
+    /* Each prefix comes from the value before it, so it can be no longer */
+    size_t total_suffix_size = 0;
+    size_t total_size = 0;
+    int32_t prev_len = 0;
+    for (int32_t i = 0; i < num_values; i++) {
+        int32_t prefix_len = prefix_lengths[i];
+        int32_t suffix_len = offsets[i + 1];
+        if (prefix_len < 0 || suffix_len < 0 || prefix_len > prev_len ||
+            suffix_len > INT32_MAX - prefix_len) {
+            free(prefix_lengths);
+            return CARQUET_ERROR_DECODE;
+        }
+        prev_len = prefix_len + suffix_len;
+        total_suffix_size += (size_t)suffix_len;
+        total_size += (size_t)prev_len;
+    }
+    if (total_suffix_size > data_size - pos || total_size > INT32_MAX) {
+        free(prefix_lengths);
+        return CARQUET_ERROR_DECODE;
+    }
+
+    if (total_size > *chars_capacity || !*chars) {
+        size_t capacity = total_size > 0 ? total_size : 1;
+        uint8_t* grown = realloc(*chars, capacity);
+        if (!grown) {
+            free(prefix_lengths);
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+        *chars = grown;
+        *chars_capacity = capacity;
+    }
+
+    /* Rebuild the values back to back */
+    const uint8_t* suffix_data = data + pos;
+    uint8_t* out = *chars;
+    size_t offset = 0;
+    for (int32_t i = 0; i < num_values; i++) {
+        int32_t prefix_len = prefix_lengths[i];
+        int32_t suffix_len = offsets[i + 1];
+        offsets[i] = (int32_t)offset;
+        if (prefix_len > 0) {
+            memcpy(out + offset, out + offsets[i - 1], (size_t)prefix_len);
+        }
+        memcpy(out + offset + prefix_len, suffix_data, (size_t)suffix_len);
+        suffix_data += suffix_len;
+        offset += (size_t)prefix_len + (size_t)suffix_len;
+    }
+    offsets[num_values] = (int32_t)offset;
+
+    free(prefix_lengths);
+
+    if (bytes_consumed) {
+        *bytes_consumed = pos + total_suffix_size;
+    }
+
+    return CARQUET_OK;
+}
+
 /* ============================================================================
  * DELTA_BYTE_ARRAY Encoder
  * ============================================================================
@@ -460,3 +460,65 @@ int64_t carquet_decode_plain(
             return -1;
     }
 }
+
+int64_t carquet_skip_plain(
+    const uint8_t* input,
+    size_t input_size,
+    carquet_physical_type_t type,
+    int32_t type_length,
+    int64_t count) {
+
+    if (count < 0) {
+        return -1;
+    }
+
+    size_t width;
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN:
+            if (count % 8 != 0) {
+                return -1;
+            }
+            width = 0;
+            break;
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_FLOAT:
+            width = 4;
+            break;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE:
+            width = 8;
+            break;
+        case CARQUET_PHYSICAL_INT96:
+            width = 12;
+            break;
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            if (type_length <= 0) {
+                return -1;
+            }
+            width = (size_t)type_length;
+            break;
+        case CARQUET_PHYSICAL_BYTE_ARRAY: {
+            size_t pos = 0;
+            for (int64_t i = 0; i < count; i++) {
+                if (pos + 4 > input_size) {
+                    return -1;
+                }
+                int32_t len = carquet_read_i32_le(input + pos);
+                pos += 4;
+                if (len < 0 || (size_t)len > input_size - pos) {
+                    return -1;
+                }
+                pos += (size_t)len;
+            }
+            return (int64_t)pos;
+        }
+        default:
+            return -1;
+    }
+
+    size_t bytes = width ? (size_t)count * width : (size_t)count / 8;
+    if (bytes > input_size) {
+        return -1;
+    }
+    return (int64_t)bytes;
+}
@@ -223,6 +223,27 @@ int64_t carquet_decode_plain(
     void* output,
     int64_t count);
 
+/**
+ * Skip PLAIN encoded values without decoding them.
+ *
+ * Fixed-width types are skipped by pointer arithmetic; BYTE_ARRAY walks
+ * the length prefixes. BOOLEAN values are bit-packed, so count must be a
+ * multiple of 8.
+ *
+ * @param input Input data
+ * @param input_size Size of input data
+ * @param type Physical type
+ * @param type_length Type length (for fixed arrays)
+ * @param count Number of values to skip
+ * @return Number of bytes skipped, or -1 on error
+ */
+int64_t carquet_skip_plain(
+    const uint8_t* input,
+    size_t input_size,
+    carquet_physical_type_t type,
+    int32_t type_length,
+    int64_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,13 @@
 #include "core/bitpack.h"
 #include <string.h>
 
+/* From simd/dispatch.c */
+extern void carquet_dispatch_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                          uint32_t* values);
+
+/* Values unpacked per call when narrowing bit-packed levels to int16 */
+#define RLE_LEVEL_CHUNK 256
+
 #if defined(__SSE2__)
 #include <emmintrin.h>
 #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
@@ -38,6 +45,17 @@ static int read_varint(const uint8_t* data, size_t size, size_t* pos, uint32_t*
     return -1;  /* Truncated or overflow */
 }
 
+/* Unpack whole groups of 8. A lone group, which is what writers flushing
+ * every 8 values produce, is not worth the dispatch. */
+static inline void unpack_groups(const uint8_t* input, int64_t count, int bit_width,
+                                 uint32_t* output) {
+    if (count == 8) {
+        carquet_bitunpack8_32(input, bit_width, output);
+    } else {
+        carquet_dispatch_bitunpack_32(input, count, bit_width, output);
+    }
+}
+
 static bool start_new_run(carquet_rle_decoder_t* dec) {
     if (dec->pos >= dec->size) {
         return false;
@@ -196,7 +214,28 @@ int64_t carquet_rle_decoder_get_batch(
             dec->run_remaining -= to_fill;
 
         } else {
-            /* Bit-packed run */
+            /* Bit-packed run: unpack whole groups straight into the output */
+            if (dec->bitpack_pos >= dec->bitpack_count) {
+                int64_t direct = count - read;
+                if (direct > dec->run_remaining) {
+                    direct = dec->run_remaining;
+                }
+                direct &= ~(int64_t)7;
+
+                if (direct > 0) {
+                    size_t bytes = (size_t)(direct / 8) * (size_t)dec->bit_width;
+                    if (bytes > dec->size - dec->pos) {
+                        dec->status = CARQUET_ERROR_INVALID_RLE;
+                        break;
+                    }
+                    unpack_groups(dec->data + dec->pos, direct, dec->bit_width, output + read);
+                    dec->pos += bytes;
+                    dec->run_remaining -= direct;
+                    read += direct;
+                }
+            }
+
+            /* Partial group at the end of the request */
             while (read < count && dec->run_remaining > 0) {
                 if (dec->bitpack_pos >= dec->bitpack_count) {
                     if (!fill_bitpack_buffer(dec)) {
@@ -217,11 +256,92 @@ int64_t carquet_rle_decoder_get_batch(
     return read;
 }
 
-int64_t carquet_rle_decoder_skip(
+int64_t carquet_rle_decoder_get_bitmap(
     carquet_rle_decoder_t* dec,
-    int64_t count) {
+    uint8_t* bitmap,
+    int64_t offset,
+    int64_t count,
+    int64_t* set_count) {
+
+    int64_t read = 0;
+    int64_t set = 0;
+
+    while (read < count && carquet_rle_decoder_has_next(dec)) {
+        if (dec->run_remaining <= 0) {
+            if (!start_new_run(dec)) {
+                break;
+            }
+        }
+
+        int64_t n = count - read;
+        if (n > dec->run_remaining) {
+            n = dec->run_remaining;
+        }
+
+        if (dec->in_rle_run) {
+            carquet_bitmap_fill(bitmap, offset + read, n, dec->rle_value != 0);
+            set += dec->rle_value != 0 ? n : 0;
+            dec->run_remaining -= n;
+            read += n;
+            continue;
+        }
+
+        /* Values left over from a group unpacked by an earlier call */
+        while (n > 0 && dec->bitpack_pos < dec->bitpack_count) {
+            uint32_t bit = dec->bitpack_buffer[dec->bitpack_pos++];
+            carquet_bitmap_fill(bitmap, offset + read, 1, bit != 0);
+            set += bit;
+            dec->run_remaining--;
+            read++;
+            n--;
+        }
+
+        /* Whole groups: each is one byte holding its 8 values as bits */
+        int64_t groups = n / 8;
+        if (groups > 0) {
+            if ((size_t)groups > dec->size - dec->pos) {
+                dec->status = CARQUET_ERROR_INVALID_RLE;
+                break;
+            }
+            set += carquet_bitmap_copy(bitmap, offset + read, dec->data + dec->pos, 0, groups * 8);
+            dec->pos += (size_t)groups;
+            dec->run_remaining -= groups * 8;
+            read += groups * 8;
+            n -= groups * 8;
+        }
+
+        /* Part of the group at the end of the request */
+        if (n > 0) {
+            if (!fill_bitpack_buffer(dec)) {
+                break;
+            }
+            for (int64_t i = 0; i < n; i++) {
+                uint32_t bit = dec->bitpack_buffer[dec->bitpack_pos++];
+                carquet_bitmap_fill(bitmap, offset + read + i, 1, bit != 0);
+                set += bit;
+            }
+            dec->run_remaining -= n;
+            read += n;
+        }
+    }
+
+    *set_count = set;
+    return read;
+}
+
+/**
+ * Skip up to count values. If matches is non-NULL, also count the skipped
+ * values equal to match; otherwise whole bit-packed groups are stepped over
+ * without unpacking them.
+ */
+static int64_t skip_values(
+    carquet_rle_decoder_t* dec,
+    int64_t count,
+    uint32_t match,
+    int64_t* matches) {
 
     int64_t skipped = 0;
+    int64_t matched = 0;
 
     while (skipped < count && carquet_rle_decoder_has_next(dec)) {
         if (dec->run_remaining <= 0) {
@@ -237,32 +357,79 @@ int64_t carquet_rle_decoder_skip(
 
         if (dec->in_rle_run) {
             /* Easy - just reduce count */
+            if (dec->rle_value == match) {
+                matched += to_skip;
+            }
             skipped += to_skip;
             dec->run_remaining -= to_skip;
-        } else {
-            /* Need to actually advance through bit-packed data */
-            while (to_skip > 0 && dec->run_remaining > 0) {
-                if (dec->bitpack_pos >= dec->bitpack_count) {
-                    if (!fill_bitpack_buffer(dec)) {
-                        break;
-                    }
-                }
+            continue;
+        }
+
+        /* Drain the values already unpacked from the current group */
+        int64_t buffered = dec->bitpack_count - dec->bitpack_pos;
+        if (buffered > to_skip) buffered = to_skip;
+        for (int64_t i = 0; matches && i < buffered; i++) {
+            matched += dec->bitpack_buffer[dec->bitpack_pos + i] == match;
+        }
+        dec->bitpack_pos += (int)buffered;
+        dec->run_remaining -= buffered;
+        skipped += buffered;
+        to_skip -= buffered;
+
+        /* Whole groups: 8 values take exactly bit_width bytes */
+        if (!matches && to_skip >= 8) {
+            int64_t groups = to_skip / 8;
+            if ((size_t)groups * (size_t)dec->bit_width > dec->size - dec->pos) {
+                dec->status = CARQUET_ERROR_INVALID_RLE;
+                break;
+            }
+            dec->pos += (size_t)groups * (size_t)dec->bit_width;
+            dec->run_remaining -= groups * 8;
+            skipped += groups * 8;
+            to_skip -= groups * 8;
+        }
 
-                int64_t can_skip = dec->bitpack_count - dec->bitpack_pos;
-                if (can_skip > to_skip) can_skip = to_skip;
-                if (can_skip > dec->run_remaining) can_skip = dec->run_remaining;
+        /* Unpack the group holding the remainder (or every group, when
+         * counting matches) */
+        while (to_skip > 0 && dec->run_remaining > 0) {
+            if (!fill_bitpack_buffer(dec)) {
+                break;
+            }
 
-                dec->bitpack_pos += (int)can_skip;
-                dec->run_remaining -= can_skip;
-                skipped += can_skip;
-                to_skip -= can_skip;
+            int64_t can_skip = to_skip < 8 ? to_skip : 8;
+            for (int64_t i = 0; matches && i < can_skip; i++) {
+                matched += dec->bitpack_buffer[i] == match;
             }
+            dec->bitpack_pos = (int)can_skip;
+            dec->run_remaining -= can_skip;
+            skipped += can_skip;
+            to_skip -= can_skip;
+        }
+        if (to_skip > 0) {
+            break;
         }
     }
 
+    if (matches) {
+        *matches = matched;
+    }
     return skipped;
 }
 
+int64_t carquet_rle_decoder_skip(
+    carquet_rle_decoder_t* dec,
+    int64_t count) {
+    return skip_values(dec, count, 0, NULL);
+}
+
+int64_t carquet_rle_decoder_skip_count(
+    carquet_rle_decoder_t* dec,
+    int64_t count,
+    uint32_t value,
+    int64_t* matches) {
+    return skip_values(dec, count, value, matches);
+}
+
 /* ============================================================================
  * RLE Encoder
  * ============================================================================
@@ -512,53 +679,54 @@ int64_t carquet_rle_decode_levels(
             count += to_fill;
 
         } else {
-            /* Bit-packed run: decode 8 values at a time */
-            int num_groups = (int)(header >> 1);
-            int64_t run_length = (int64_t)num_groups * 8;
-            if (run_length == 0) continue;
-
+            /* Bit-packed run: unpack a chunk of groups, then narrow to int16 */
+            int64_t groups_left = (int64_t)(header >> 1);
             size_t bytes_per_group = (size_t)bit_width;
 
-            for (int g = 0; g < num_groups && count < max_values; g++) {
-                if (pos + bytes_per_group > input_size) break;
+            while (groups_left > 0 && count < max_values) {
+                int64_t groups = groups_left;
+                if (groups > RLE_LEVEL_CHUNK / 8) {
+                    groups = RLE_LEVEL_CHUNK / 8;
+                }
+                if (groups > (max_values - count + 7) / 8) {
+                    groups = (max_values - count + 7) / 8;
+                }
+                if ((size_t)groups * bytes_per_group > input_size - pos) {
+                    groups = (int64_t)((input_size - pos) / bytes_per_group);
+                }
+                if (groups == 0) break;
 
-                /* Unpack 8 values */
-                uint32_t temp[8];
-                carquet_bitunpack8_32(input + pos, bit_width, temp);
-                pos += bytes_per_group;
+                uint32_t temp[RLE_LEVEL_CHUNK];
+                unpack_groups(input + pos, groups * 8, bit_width, temp);
+                pos += (size_t)groups * bytes_per_group;
+                groups_left -= groups;
 
-                /* Convert to int16_t and store */
-                int64_t to_store = 8;
+                int64_t to_store = groups * 8;
                 if (count + to_store > max_values) {
                     to_store = max_values - count;
                 }
 
+                int16_t* dst = output + count;
+                int64_t i = 0;
 #if defined(__SSE2__)
-                if (to_store == 8) {
-                    /* SSE2: load 2x4 int32_t, pack-saturate to 8 int16_t */
-                    __m128i v0 = _mm_loadu_si128((const __m128i*)temp);
-                    __m128i v1 = _mm_loadu_si128((const __m128i*)(temp + 4));
-                    __m128i packed = _mm_packs_epi32(v0, v1);
-                    _mm_storeu_si128((__m128i*)(output + count), packed);
-                    count += 8;
-                    continue;
+                /* SSE2: load 2x4 int32_t, pack-saturate to 8 int16_t */
+                for (; i + 8 <= to_store; i += 8) {
+                    __m128i v0 = _mm_loadu_si128((const __m128i*)(temp + i));
+                    __m128i v1 = _mm_loadu_si128((const __m128i*)(temp + i + 4));
+                    _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(v0, v1));
                 }
 #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
-                if (to_store == 8) {
-                    /* NEON: load 8 uint32_t, narrow to int16_t */
-                    uint32x4_t v0 = vld1q_u32(temp);
-                    uint32x4_t v1 = vld1q_u32(temp + 4);
-                    int16x4_t n0 = vmovn_s32(vreinterpretq_s32_u32(v0));
-                    int16x4_t n1 = vmovn_s32(vreinterpretq_s32_u32(v1));
-                    int16x8_t result = vcombine_s16(n0, n1);
-                    vst1q_s16(output + count, result);
-                    count += 8;
-                    continue;
+                /* NEON: load 8 uint32_t, narrow to int16_t */
+                for (; i + 8 <= to_store; i += 8) {
+                    int16x4_t n0 = vmovn_s32(vreinterpretq_s32_u32(vld1q_u32(temp + i)));
+                    int16x4_t n1 = vmovn_s32(vreinterpretq_s32_u32(vld1q_u32(temp + i + 4)));
+                    vst1q_s16(dst + i, vcombine_s16(n0, n1));
                 }
 #endif
-                for (int64_t i = 0; i < to_store; i++) {
-                    output[count++] = (int16_t)temp[i];
+                for (; i < to_store; i++) {
+                    dst[i] = (int16_t)temp[i];
                 }
+                count += to_store;
             }
         }
     }
@@ -105,6 +105,45 @@ int64_t carquet_rle_decoder_skip(
     carquet_rle_decoder_t* dec,
     int64_t count);
 
+/**
+ * Skip values in the decoder, counting how many of them equal a value.
+ *
+ * Used to skip definition levels while tracking how many of the skipped
+ * entries were non-null.
+ *
+ * @param dec Decoder
+ * @param count Number of values to skip
+ * @param value Value to count
+ * @param matches Output: number of skipped values equal to value
+ * @return Number of values actually skipped
+ */
+int64_t carquet_rle_decoder_skip_count(
+    carquet_rle_decoder_t* dec,
+    int64_t count,
+    uint32_t value,
+    int64_t* matches);
+
+/**
+ * Get values of a 1-bit stream as bits of a bitmap (LSB first).
+ *
+ * Used to decode definition levels with a max level of 1 straight into a
+ * validity bitmap: RLE runs fill whole bytes and bit-packed runs, which
+ * already have the bitmap's layout, are copied as bits.
+ *
+ * @param dec Decoder (bit_width must be 1)
+ * @param bitmap Output bitmap
+ * @param offset Bit of bitmap that receives the first value
+ * @param count Maximum values to get
+ * @param set_count Output: number of values equal to 1
+ * @return Number of values actually read
+ */
+int64_t carquet_rle_decoder_get_bitmap(
+    carquet_rle_decoder_t* dec,
+    uint8_t* bitmap,
+    int64_t offset,
+    int64_t count,
+    int64_t* set_count);
+
 /**
  * Get decoder error status.
  */
@@ -35,6 +35,13 @@ static const uint32_t SALT[8] = {
 /* xxHash64 function declaration (from xxhash.c) */
 extern uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
 
+/* Batched block operations (from simd/dispatch.c) */
+extern void carquet_dispatch_bloom_insert_hashes(uint8_t* blocks, size_t num_blocks,
+                                                  const uint64_t* hashes, int64_t count);
+extern void carquet_dispatch_bloom_check_hashes(const uint8_t* blocks, size_t num_blocks,
+                                                 const uint64_t* hashes, int64_t count,
+                                                 uint8_t* out_bitmap);
+
 /* ============================================================================
  * Bloom Filter Structure
  * ============================================================================
@@ -53,10 +60,11 @@ struct carquet_bloom_filter {
  */
 
 /**
- * Generate block index from hash.
+ * Generate block index from hash: the top 32 bits scaled onto the block
+ * count, as the spec requires for filters written by other implementations.
  */
 static inline size_t bloom_filter_block_index(uint64_t hash, size_t num_blocks) {
-    return (size_t)((hash >> 32) % num_blocks);
+    return (size_t)(((hash >> 32) * (uint64_t)num_blocks) >> 32);
 }
 
 /**
@@ -233,11 +241,50 @@ void carquet_bloom_filter_insert_bytes(carquet_bloom_filter_t* filter,
     carquet_bloom_filter_insert_hash(filter, hash);
 }
 
+/**
+ * Insert many precomputed hashes. Same result as inserting them one by one,
+ * but the block masks are computed with SIMD where available.
+ */
+void carquet_bloom_filter_insert_hashes(carquet_bloom_filter_t* filter,
+                                         const uint64_t* hashes,
+                                         int64_t count) {
+    if (!filter || !filter->data || !hashes || count <= 0) {
+        return;
+    }
+
+    carquet_dispatch_bloom_insert_hashes(filter->data, filter->num_blocks, hashes, count);
+}
+
 /* ============================================================================
  * Bloom Filter Check Operations
  * ============================================================================
  */
 
+/**
+ * Probe many precomputed hashes. Bit i of out_bitmap (LSB first, (count + 7)
+ * / 8 bytes, all written) is set if hashes[i] might be in the filter.
+ */
+void carquet_bloom_filter_check_hashes(const carquet_bloom_filter_t* filter,
+                                        const uint64_t* hashes,
+                                        int64_t count,
+                                        uint8_t* out_bitmap) {
+    if (!hashes || !out_bitmap || count <= 0) {
+        return;
+    }
+
+    if (!filter || !filter->data) {
+        /* Assume present if no filter */
+        memset(out_bitmap, 0xFF, (size_t)((count + 7) / 8));
+        if (count % 8) {
+            out_bitmap[count / 8] = (uint8_t)((1U << (count % 8)) - 1);
+        }
+        return;
+    }
+
+    carquet_dispatch_bloom_check_hashes(filter->data, filter->num_blocks,
+                                        hashes, count, out_bitmap);
+}
+
 bool carquet_bloom_filter_check_hash(const carquet_bloom_filter_t* filter,
                                       uint64_t hash) {
     if (!filter || !filter->data) {
@@ -6,6 +6,9 @@
  * - ColumnIndex: min/max values and null counts for each page
  * - OffsetIndex: file offset, compressed/uncompressed size for each page
  *
+ * This file builds and serializes them on the write path; the reader parses
+ * them with parquet_parse_column_index()/parquet_parse_offset_index().
+ *
  * Reference: https://parquet.apache.org/docs/file-format/
  */
 
@@ -18,50 +21,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-/* ============================================================================
- * ColumnIndex Structure
- * ============================================================================
- */
-
-typedef struct carquet_column_index {
-    int32_t num_pages;
-
-    /* Per-page null counts */
-    int64_t* null_counts;
-
-    /* Per-page min/max values (packed binary) */
-    uint8_t** min_values;
-    int32_t* min_value_lens;
-    uint8_t** max_values;
-    int32_t* max_value_lens;
-
-    /* Per-page null page flags */
-    bool* null_pages;
-
-    /* Boundary order for efficient range queries */
-    int32_t boundary_order;  /* 0=UNORDERED, 1=ASCENDING, 2=DESCENDING */
-} carquet_column_index_t;
-
-/* ============================================================================
- * OffsetIndex Structure
- * ============================================================================
- */
-
-typedef struct carquet_page_location {
-    int64_t offset;             /* File offset of page */
-    int32_t compressed_size;    /* Compressed page size */
-    int64_t first_row_index;    /* Index of first row in page */
-} carquet_page_location_t;
-
-typedef struct carquet_offset_index {
-    int32_t num_pages;
-    carquet_page_location_t* page_locations;
-
-    /* Optional: uncompressed page sizes */
-    bool has_uncompressed_sizes;
-    int32_t* uncompressed_page_sizes;
-} carquet_offset_index_t;
-
 /* ============================================================================
  * Forward Declarations
  * ============================================================================
@@ -380,6 +339,21 @@ carquet_status_t carquet_offset_index_add_page(
     return CARQUET_OK;
 }
 
+/**
+ * Shift every recorded page offset by delta. Column writers record offsets
+ * relative to their chunk until the chunk's position in the file is known.
+ */
+void carquet_offset_index_shift(
+    carquet_offset_index_builder_t* builder,
+    int64_t delta) {
+
+    if (!builder) return;
+
+    for (int32_t i = 0; i < builder->num_pages; i++) {
+        builder->offsets[i] += delta;
+    }
+}
+
 /* ============================================================================
  * Serialization to Thrift
  * ============================================================================
@@ -0,0 +1,394 @@
+/**
+ * @file arrow_export.c
+ * @brief Export of row batches through the Arrow C Data Interface
+ *
+ * A batch becomes a struct array with one child per column. Buffers whose
+ * layout already matches Arrow's are handed over; the rest are built here.
+ * The arrays of one export share an owner that frees the batch and the
+ * built buffers once the last of them is released, so children moved out
+ * by the consumer outlive their parent.
+ */
+
+#include <carquet/carquet.h>
+#include "reader_internal.h"
+#include "core/thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Shared Ownership
+ * ============================================================================
+ */
+
+typedef struct export_owner {
+    carquet_mutex_t mutex;
+    int64_t refs;                   /* Arrays (or schemas) not yet released */
+    carquet_row_batch_t* batch;     /* Freed with the owner; NULL for schemas */
+    void** blocks;                  /* Memory allocated for the export */
+    int32_t num_blocks;
+    int32_t blocks_capacity;
+} export_owner_t;
+
+static export_owner_t* owner_create(void) {
+    export_owner_t* owner = calloc(1, sizeof(export_owner_t));
+    if (owner) {
+        carquet_mutex_init(&owner->mutex);
+    }
+    return owner;
+}
+
+static void owner_destroy(export_owner_t* owner) {
+    if (!owner) return;
+    for (int32_t i = 0; i < owner->num_blocks; i++) {
+        free(owner->blocks[i]);
+    }
+    free(owner->blocks);
+    carquet_row_batch_free(owner->batch);
+    carquet_mutex_destroy(&owner->mutex);
+    free(owner);
+}
+
+static void owner_release(export_owner_t* owner) {
+    carquet_mutex_lock(&owner->mutex);
+    int64_t refs = --owner->refs;
+    carquet_mutex_unlock(&owner->mutex);
+    if (refs == 0) {
+        owner_destroy(owner);
+    }
+}
+
+/** Make block (malloc'd) part of the export; frees it on failure. */
+static void* owner_adopt(export_owner_t* owner, void* block) {
+    if (!block) {
+        return NULL;
+    }
+    if (owner->num_blocks == owner->blocks_capacity) {
+        int32_t new_cap = owner->blocks_capacity ? owner->blocks_capacity * 2 : 16;
+        void** grown = realloc(owner->blocks, (size_t)new_cap * sizeof(void*));
+        if (!grown) {
+            free(block);
+            return NULL;
+        }
+        owner->blocks = grown;
+        owner->blocks_capacity = new_cap;
+    }
+    owner->blocks[owner->num_blocks++] = block;
+    return block;
+}
+
+static void* owner_alloc(export_owner_t* owner, size_t size) {
+    return owner_adopt(owner, calloc(1, size > 0 ? size : 1));
+}
+
+static char* owner_strdup(export_owner_t* owner, const char* text) {
+    size_t len = text ? strlen(text) : 0;
+    char* copy = owner_alloc(owner, len + 1);
+    if (copy && len > 0) {
+        memcpy(copy, text, len);
+    }
+    return copy;
+}
+
+static void release_array(struct ArrowArray* array) {
+    for (int64_t i = 0; i < array->n_children; i++) {
+        struct ArrowArray* child = array->children[i];
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    if (array->dictionary && array->dictionary->release) {
+        array->dictionary->release(array->dictionary);
+    }
+    owner_release((export_owner_t*)array->private_data);
+    array->release = NULL;
+}
+
+static void release_schema(struct ArrowSchema* schema) {
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        struct ArrowSchema* child = schema->children[i];
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    if (schema->dictionary && schema->dictionary->release) {
+        schema->dictionary->release(schema->dictionary);
+    }
+    owner_release((export_owner_t*)schema->private_data);
+    schema->release = NULL;
+}
+
+/* ============================================================================
+ * Arrays
+ * ============================================================================
+ */
+
+static size_t value_width(carquet_physical_type_t type, int32_t type_length) {
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN: return 1;
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_FLOAT: return 4;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE: return 8;
+        case CARQUET_PHYSICAL_INT96: return 12;
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY: return (size_t)type_length;
+        default: return 0;
+    }
+}
+
+static bool init_array(export_owner_t* owner, struct ArrowArray* array,
+                       int64_t length, int64_t n_buffers) {
+    memset(array, 0, sizeof(*array));
+    array->buffers = owner_alloc(owner, (size_t)n_buffers * sizeof(void*));
+    if (!array->buffers) {
+        return false;
+    }
+    array->length = length;
+    array->n_buffers = n_buffers;
+    array->release = release_array;
+    array->private_data = owner;
+    owner->refs++;
+    return true;
+}
+
+/**
+ * Values buffers of an array of count entries: views become offsets and
+ * bytes, booleans are packed, fixed-width values are used in place unless
+ * copy is set (for data the batch does not own).
+ */
+static bool export_values(export_owner_t* owner, struct ArrowArray* array,
+                          carquet_physical_type_t type, int32_t type_length,
+                          const void* values, int64_t count,
+                          const int32_t* offsets, const uint8_t* chars, bool copy) {
+    if (type == CARQUET_PHYSICAL_BYTE_ARRAY) {
+        if (!offsets) {
+            int32_t* built_offsets = NULL;
+            uint8_t* built_chars = NULL;
+            size_t offsets_size, chars_size;
+            if (carquet_byte_arrays_to_arrow((const carquet_byte_array_t*)values, count, NULL,
+                                             &built_offsets, &offsets_size,
+                                             &built_chars, &chars_size) != CARQUET_OK) {
+                return false;
+            }
+            if (!owner_adopt(owner, built_offsets)) {
+                free(built_chars);
+                return false;
+            }
+            if (!owner_adopt(owner, built_chars)) {
+                return false;
+            }
+            offsets = built_offsets;
+            chars = built_chars;
+        }
+        array->buffers[1] = offsets;
+        array->buffers[2] = chars;
+        return true;
+    }
+
+    if (type == CARQUET_PHYSICAL_BOOLEAN) {
+        uint8_t* bits = owner_alloc(owner, ((size_t)count + 7) / 8);
+        if (!bits) {
+            return false;
+        }
+        const uint8_t* bytes = values;
+        for (int64_t i = 0; i < count; i++) {
+            bits[i / 8] |= (uint8_t)((bytes[i] != 0) << (i % 8));
+        }
+        array->buffers[1] = bits;
+        return true;
+    }
+
+    size_t size = value_width(type, type_length) * (size_t)count;
+    if (copy && size > 0) {
+        void* data = owner_adopt(owner, malloc(size));
+        if (!data) {
+            return false;
+        }
+        memcpy(data, values, size);
+        values = data;
+    }
+    array->buffers[1] = values;
+    return true;
+}
+
+static bool export_column(export_owner_t* owner, const carquet_column_data_t* col,
+                          struct ArrowArray* array) {
+    bool strings = col->type == CARQUET_PHYSICAL_BYTE_ARRAY && !col->dictionary;
+    if (!init_array(owner, array, col->num_values, strings ? 3 : 2)) {
+        return false;
+    }
+    array->null_count = col->null_count;
+
+    /* Arrow validity is the inverse of the default null bitmap */
+    if (col->null_count > 0 && col->validity) {
+        array->buffers[0] = col->null_bitmap;
+    } else if (col->null_count > 0) {
+        size_t bytes = ((size_t)col->num_values + 7) / 8;
+        uint8_t* valid = owner_alloc(owner, bytes);
+        if (!valid) {
+            return false;
+        }
+        for (size_t b = 0; b < bytes; b++) {
+            valid[b] = (uint8_t)~col->null_bitmap[b];
+        }
+        array->buffers[0] = valid;
+    }
+
+    if (col->dictionary) {
+        /* Indices go as is; the dictionary belongs to the batch reader's
+         * row group, so its values are copied */
+        array->buffers[1] = col->data;
+        array->dictionary = owner_alloc(owner, sizeof(struct ArrowArray));
+        bool dict_strings = col->type == CARQUET_PHYSICAL_BYTE_ARRAY;
+        return array->dictionary &&
+               init_array(owner, array->dictionary, col->dictionary_size, dict_strings ? 3 : 2) &&
+               export_values(owner, array->dictionary, col->type, col->type_length,
+                             col->dictionary, col->dictionary_size, NULL, NULL, true);
+    }
+
+    return export_values(owner, array, col->type, col->type_length, col->data,
+                         col->num_values, col->offsets, col->chars, false);
+}
+
+static bool export_arrays(export_owner_t* owner, const carquet_row_batch_t* batch,
+                          struct ArrowArray* array) {
+    int32_t n = batch->num_columns;
+    if (!init_array(owner, array, batch->num_rows, 1)) {
+        return false;
+    }
+    array->children = owner_alloc(owner, (size_t)n * sizeof(struct ArrowArray*));
+    struct ArrowArray* children = owner_alloc(owner, (size_t)n * sizeof(struct ArrowArray));
+    if (!array->children || !children) {
+        return false;
+    }
+    array->n_children = n;
+
+    for (int32_t i = 0; i < n; i++) {
+        array->children[i] = &children[i];
+        if (!export_column(owner, &batch->columns[i], &children[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Schemas
+ * ============================================================================
+ */
+
+static const char* type_format(carquet_physical_type_t type, int32_t type_length,
+                               bool is_string, char* buffer, size_t size) {
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN: return "b";
+        case CARQUET_PHYSICAL_INT32: return "i";
+        case CARQUET_PHYSICAL_INT64: return "l";
+        case CARQUET_PHYSICAL_INT96: return "w:12";
+        case CARQUET_PHYSICAL_FLOAT: return "f";
+        case CARQUET_PHYSICAL_DOUBLE: return "g";
+        case CARQUET_PHYSICAL_BYTE_ARRAY: return is_string ? "u" : "z";
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            snprintf(buffer, size, "w:%d", (int)type_length);
+            return buffer;
+        default: return NULL;
+    }
+}
+
+static bool init_schema(export_owner_t* owner, struct ArrowSchema* schema,
+                        const char* format, const char* name, int64_t flags) {
+    memset(schema, 0, sizeof(*schema));
+    schema->format = owner_strdup(owner, format);
+    schema->name = owner_strdup(owner, name);
+    if (!schema->format || !schema->name) {
+        return false;
+    }
+    schema->flags = flags;
+    schema->release = release_schema;
+    schema->private_data = owner;
+    owner->refs++;
+    return true;
+}
+
+static bool export_column_schema(export_owner_t* owner, const carquet_column_data_t* col,
+                                 struct ArrowSchema* schema) {
+    char buffer[24];
+    const char* format = type_format(col->type, col->type_length, col->is_string,
+                                     buffer, sizeof(buffer));
+    int64_t flags = col->max_def_level > 0 ? ARROW_FLAG_NULLABLE : 0;
+    if (!format) {
+        return false;
+    }
+
+    if (!col->dictionary) {
+        return init_schema(owner, schema, format, col->name, flags);
+    }
+
+    schema->dictionary = NULL;
+    struct ArrowSchema* dictionary = owner_alloc(owner, sizeof(struct ArrowSchema));
+    if (!dictionary || !init_schema(owner, schema, "i", col->name, flags)) {
+        return false;
+    }
+    schema->dictionary = dictionary;
+    return init_schema(owner, dictionary, format, "", 0);
+}
+
+static bool export_schema(export_owner_t* owner, const carquet_row_batch_t* batch,
+                          struct ArrowSchema* schema) {
+    int32_t n = batch->num_columns;
+    if (!init_schema(owner, schema, "+s", "", 0)) {
+        return false;
+    }
+    schema->children = owner_alloc(owner, (size_t)n * sizeof(struct ArrowSchema*));
+    struct ArrowSchema* children = owner_alloc(owner, (size_t)n * sizeof(struct ArrowSchema));
+    if (!schema->children || !children) {
+        return false;
+    }
+    schema->n_children = n;
+
+    for (int32_t i = 0; i < n; i++) {
+        schema->children[i] = &children[i];
+        if (!export_column_schema(owner, &batch->columns[i], &children[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================
+ */
+
+carquet_status_t carquet_row_batch_export_arrow(
+    carquet_row_batch_t* batch,
+    struct ArrowArray* array,
+    struct ArrowSchema* schema) {
+
+    /* batch, array, schema are nonnull per API contract */
+    for (int32_t i = 0; i < batch->num_columns; i++) {
+        const carquet_column_data_t* col = &batch->columns[i];
+        if (col->max_rep_level > 0) {
+            return CARQUET_ERROR_NOT_IMPLEMENTED;
+        }
+        if (col->num_values != batch->num_rows) {
+            return CARQUET_ERROR_INVALID_STATE;
+        }
+    }
+
+    export_owner_t* data = owner_create();
+    export_owner_t* types = owner_create();
+    bool ok = data && types &&
+              export_schema(types, batch, schema) &&
+              export_arrays(data, batch, array);
+    if (!ok) {
+        /* Nothing was handed out: drop both trees without the batch */
+        owner_destroy(data);
+        owner_destroy(types);
+        array->release = NULL;
+        schema->release = NULL;
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    data->batch = batch;
+    return CARQUET_OK;
+}
@@ -13,6 +13,10 @@
 #include <carquet/carquet.h>
 #include "reader_internal.h"
 #include "core/arena.h"
+#include "core/thread.h"
+#include "core/bitpack.h"
+#include "core/pool.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -24,27 +28,36 @@
 extern void carquet_dispatch_build_null_bitmap(const int16_t* def_levels, int64_t count,
                                                 int16_t max_def_level, uint8_t* null_bitmap);
 
+/* From page_reader.c */
+extern carquet_status_t carquet_read_next_page(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error);
+
 /* ============================================================================
  * Internal Structures
  * ============================================================================
  */
 
-typedef struct carquet_column_data {
-    void* data;                 /* Column values */
-    uint8_t* null_bitmap;       /* Null bitmap (1 bit per value) */
-    int64_t num_values;         /* Number of values */
-    size_t data_capacity;       /* Allocated capacity for data */
-    carquet_physical_type_t type;
-    int32_t type_length;        /* For fixed-length types */
-    carquet_data_ownership_t ownership;  /* OWNED or VIEW (for future zero-copy) */
-} carquet_column_data_t;
-
-struct carquet_row_batch {
-    carquet_column_data_t* columns;
-    int32_t num_columns;
-    int64_t num_rows;
-    carquet_arena_t arena;
-};
+/* A row group opened ahead of the caller by the read-ahead thread */
+typedef enum prefetch_slot_state {
+    PREFETCH_SLOT_EMPTY = 0,
+    PREFETCH_SLOT_LOADING,
+    PREFETCH_SLOT_READY,
+} prefetch_slot_state_t;
+
+typedef struct prefetch_slot {
+    prefetch_slot_state_t state;
+    int32_t row_group;
+    carquet_status_t status;
+    carquet_column_reader_t** col_readers;  /* num_projected entries */
+    uint8_t* io_buffer;
+    size_t io_buffer_capacity;
+} prefetch_slot_t;
 
 struct carquet_batch_reader {
     carquet_reader_t* reader;
@@ -62,9 +75,34 @@ struct carquet_batch_reader {
     /* Column readers for current row group */
     carquet_column_reader_t** col_readers;
 
+    /* Row group whose dictionary each projected column last returned
+     * (config.read_dictionary), -1 for none */
+    int32_t* dictionary_row_groups;
+
+    /* Coalesced column chunk bytes for the current row group (non-mmap),
+     * reused across row groups */
+    uint8_t* io_buffer;
+    size_t io_buffer_capacity;
+
+    /* Column buffers given back by carquet_batch_reader_next_into(), handed
+     * out again for the following batches */
+    carquet_buffer_pool_t pool;
+
     /* Memory-mapped data */
     uint8_t* mmap_data;
     size_t mmap_size;
+
+    /* Background row group read-ahead (config.prefetch_depth slots).
+     * Slot state and next_prefetch_row_group are guarded by prefetch_mutex;
+     * a LOADING slot's readers and buffer belong to the worker thread. */
+    prefetch_slot_t* prefetch_slots;
+    int32_t num_prefetch_slots;
+    int32_t next_prefetch_row_group;
+    bool prefetch_running;
+    bool prefetch_shutdown;
+    carquet_thread_t prefetch_thread;
+    carquet_mutex_t prefetch_mutex;
+    carquet_cond_t prefetch_cond;
 };
 
 /* ============================================================================
@@ -78,6 +116,9 @@ void carquet_batch_reader_config_init(carquet_batch_reader_config_t* config) {
     config->batch_size = 65536;  /* 64K rows per batch */
     config->num_threads = 0;     /* Auto-detect */
     config->use_mmap = false;
+    config->prefetch_depth = 0;  /* No read-ahead */
+    config->read_dictionary = false;
+    config->arrow_layout = false;
 }
 
 /* ============================================================================
@@ -200,51 +241,467 @@ carquet_batch_reader_t* carquet_batch_reader_create(
         return NULL;
     }
 
+    if (batch_reader->config.read_dictionary) {
+        batch_reader->dictionary_row_groups = malloc(
+            sizeof(int32_t) * (size_t)batch_reader->num_projected);
+        if (!batch_reader->dictionary_row_groups) {
+            free(batch_reader->col_readers);
+            free(batch_reader->projected_columns);
+            free(batch_reader);
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate dictionary state");
+            return NULL;
+        }
+        for (int32_t i = 0; i < batch_reader->num_projected; i++) {
+            batch_reader->dictionary_row_groups[i] = -1;
+        }
+    }
+
+    /* Read-ahead slots; the worker thread starts with the first batch */
+    if (batch_reader->config.prefetch_depth > 0) {
+        int32_t depth = batch_reader->config.prefetch_depth;
+        batch_reader->prefetch_slots = calloc((size_t)depth, sizeof(prefetch_slot_t));
+        bool ok = batch_reader->prefetch_slots != NULL;
+        for (int32_t i = 0; ok && i < depth; i++) {
+            batch_reader->prefetch_slots[i].col_readers = calloc(
+                batch_reader->num_projected, sizeof(carquet_column_reader_t*));
+            ok = batch_reader->prefetch_slots[i].col_readers != NULL;
+        }
+        if (!ok) {
+            if (batch_reader->prefetch_slots) {
+                for (int32_t i = 0; i < depth; i++) {
+                    free(batch_reader->prefetch_slots[i].col_readers);
+                }
+            }
+            free(batch_reader->prefetch_slots);
+            free(batch_reader->dictionary_row_groups);
+            free(batch_reader->col_readers);
+            free(batch_reader->projected_columns);
+            free(batch_reader);
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate read-ahead slots");
+            return NULL;
+        }
+        batch_reader->num_prefetch_slots = depth;
+        carquet_mutex_init(&batch_reader->prefetch_mutex);
+        carquet_cond_init(&batch_reader->prefetch_cond);
+    }
+
+    carquet_buffer_pool_init(&batch_reader->pool);
     batch_reader->current_row_group = -1;
 
     return batch_reader;
 }
 
-static carquet_status_t open_row_group_readers(
+static void close_column_readers(carquet_column_reader_t** col_readers, int32_t count) {
+    for (int32_t i = 0; i < count; i++) {
+        if (col_readers[i]) {
+            carquet_column_reader_free(col_readers[i]);
+            col_readers[i] = NULL;
+        }
+    }
+}
+
+/**
+ * Read the column chunks of the given column readers into *io_buffer, merging
+ * nearby chunks into single reads, and attach each reader to its bytes.
+ */
+static carquet_status_t fetch_row_group_chunks(
     carquet_batch_reader_t* batch_reader,
-    int32_t row_group_index,
+    carquet_column_reader_t** col_readers,
+    uint8_t** io_buffer,
+    size_t* io_buffer_capacity,
     carquet_error_t* error) {
 
-    /* Close existing readers */
-    for (int32_t i = 0; i < batch_reader->num_projected; i++) {
-        if (batch_reader->col_readers[i]) {
-            carquet_column_reader_free(batch_reader->col_readers[i]);
-            batch_reader->col_readers[i] = NULL;
+    int32_t n = batch_reader->num_projected;
+    carquet_io_range_t* ranges = malloc(sizeof(carquet_io_range_t) * (size_t)n * 2);
+    int32_t* owners = malloc(sizeof(int32_t) * (size_t)n);
+    if (!ranges || !owners) {
+        free(ranges);
+        free(owners);
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate I/O plan");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    carquet_io_range_t* merged = ranges + n;
+
+    /* Columns with unusable chunk metadata are left to per-page reads.
+     * A column projected twice is fetched twice; harmless. */
+    int32_t count = 0;
+    for (int32_t i = 0; i < n; i++) {
+        carquet_column_reader_t* cr = col_readers[i];
+        if (carquet_io_chunk_range(batch_reader->reader, cr->col_meta,
+                                   &ranges[count].offset, &ranges[count].length)) {
+            owners[count++] = i;
+        }
+    }
+
+    int32_t num_merged = 0;
+    int64_t total = 0;
+    carquet_status_t status = carquet_io_plan_ranges(
+        ranges, count, batch_reader->reader->options.coalesce_gap,
+        merged, &num_merged, &total);
+
+    if (status == CARQUET_OK && (size_t)total > *io_buffer_capacity) {
+        uint8_t* buf = realloc(*io_buffer, (size_t)total);
+        if (buf) {
+            *io_buffer = buf;
+            *io_buffer_capacity = (size_t)total;
+        } else {
+            status = CARQUET_ERROR_OUT_OF_MEMORY;
         }
     }
 
+    if (status == CARQUET_OK) {
+        status = carquet_io_read_ranges(batch_reader->reader, merged, num_merged,
+                                        *io_buffer, error);
+    } else {
+        CARQUET_SET_ERROR(error, status, "Failed to allocate column chunk buffer");
+    }
+
+    if (status == CARQUET_OK) {
+        for (int32_t i = 0; i < count; i++) {
+            carquet_column_reader_attach_chunk(
+                col_readers[owners[i]],
+                *io_buffer + ranges[i].buffer_offset,
+                ranges[i].offset, ranges[i].length);
+        }
+    }
+
+    free(ranges);
+    free(owners);
+    return status;
+}
+
+/**
+ * Open column readers for every projected column of a row group into
+ * col_readers and, without mmap, fetch their chunks into *io_buffer.
+ * On failure no readers are left open.
+ */
+static carquet_status_t load_row_group(
+    carquet_batch_reader_t* batch_reader,
+    int32_t row_group_index,
+    carquet_column_reader_t** col_readers,
+    uint8_t** io_buffer,
+    size_t* io_buffer_capacity,
+    carquet_error_t* error) {
+
     /* Open new readers for each projected column */
     for (int32_t i = 0; i < batch_reader->num_projected; i++) {
         int32_t file_col_idx = batch_reader->projected_columns[i];
-        batch_reader->col_readers[i] = carquet_reader_get_column(
+        col_readers[i] = carquet_reader_get_column(
             batch_reader->reader, row_group_index, file_col_idx, error);
 
-        if (!batch_reader->col_readers[i]) {
+        if (!col_readers[i]) {
             /* Close already opened readers */
-            for (int32_t j = 0; j < i; j++) {
-                carquet_column_reader_free(batch_reader->col_readers[j]);
-                batch_reader->col_readers[j] = NULL;
-            }
+            close_column_readers(col_readers, i);
             return error ? error->code : CARQUET_ERROR_COLUMN_NOT_FOUND;
         }
+        col_readers[i]->dictionary_indices = batch_reader->config.read_dictionary &&
+            col_readers[i]->type != CARQUET_PHYSICAL_BOOLEAN;
+        col_readers[i]->spaced_values = true;
+        col_readers[i]->validity_levels = col_readers[i]->max_def_level == 1 &&
+            col_readers[i]->max_rep_level == 0;
+    }
+
+    /* Without mmap, fetch the projected column chunks with as few reads
+     * as possible; column readers then parse pages from memory. */
+    if (!batch_reader->reader->mmap_data && carquet_io_is_positional(batch_reader->reader)) {
+        carquet_status_t status = fetch_row_group_chunks(
+            batch_reader, col_readers, io_buffer, io_buffer_capacity, error);
+        if (status != CARQUET_OK) {
+            close_column_readers(col_readers, batch_reader->num_projected);
+            return status;
+        }
+    }
+
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Row Group Read-Ahead
+ * ============================================================================
+ *
+ * With config.prefetch_depth > 0, a single background thread keeps up to
+ * prefetch_depth row groups after the current one loaded: column readers
+ * opened, chunks fetched (non-mmap) and the first page of every column
+ * decompressed and decoded. When the caller reaches such a row group its
+ * readers and chunk buffer are handed over and the slot is refilled with
+ * the next row group, so I/O and decompression overlap with consumption.
+ */
+
+static void prefetch_worker(void* arg) {
+    carquet_batch_reader_t* batch_reader = (carquet_batch_reader_t*)arg;
+    int32_t num_row_groups = carquet_reader_num_row_groups(batch_reader->reader);
+
+    carquet_mutex_lock(&batch_reader->prefetch_mutex);
+    for (;;) {
+        prefetch_slot_t* slot = NULL;
+        while (!batch_reader->prefetch_shutdown) {
+            if (batch_reader->next_prefetch_row_group < num_row_groups) {
+                for (int32_t i = 0; i < batch_reader->num_prefetch_slots; i++) {
+                    if (batch_reader->prefetch_slots[i].state == PREFETCH_SLOT_EMPTY) {
+                        slot = &batch_reader->prefetch_slots[i];
+                        break;
+                    }
+                }
+                if (slot) break;
+            }
+            carquet_cond_wait(&batch_reader->prefetch_cond, &batch_reader->prefetch_mutex);
+        }
+        if (batch_reader->prefetch_shutdown) {
+            break;
+        }
+
+        slot->state = PREFETCH_SLOT_LOADING;
+        slot->row_group = batch_reader->next_prefetch_row_group++;
+        carquet_mutex_unlock(&batch_reader->prefetch_mutex);
+
+        carquet_error_t err = CARQUET_ERROR_INIT;
+        carquet_status_t status = load_row_group(
+            batch_reader, slot->row_group, slot->col_readers,
+            &slot->io_buffer, &slot->io_buffer_capacity, &err);
+
+        if (status == CARQUET_OK) {
+            /* Decompress the first page of each column. Later pages are
+             * loaded by the parallel page prefetch in carquet_batch_reader_next.
+             * A failed slot is dropped and the caller loads the row group
+             * itself, which reports the error. */
+            for (int32_t i = 0; status == CARQUET_OK && i < batch_reader->num_projected; i++) {
+                carquet_column_reader_t* cr = slot->col_readers[i];
+                if (!cr->page_loaded && cr->values_remaining > 0) {
+                    uint8_t dummy[16];
+                    int64_t values_read = 0;
+                    status = carquet_read_next_page(cr, dummy, 0, NULL, NULL,
+                                                    &values_read, &err);
+                }
+            }
+        }
+
+        carquet_mutex_lock(&batch_reader->prefetch_mutex);
+        slot->status = status;
+        slot->state = PREFETCH_SLOT_READY;
+        carquet_cond_broadcast(&batch_reader->prefetch_cond);
+    }
+    carquet_mutex_unlock(&batch_reader->prefetch_mutex);
+}
+
+static void start_prefetch(carquet_batch_reader_t* batch_reader) {
+    batch_reader->next_prefetch_row_group = batch_reader->current_row_group + 1;
+    batch_reader->prefetch_shutdown = false;
+
+    /* Without a thread the reader simply loads row groups on demand */
+    batch_reader->prefetch_running = carquet_thread_create(
+        &batch_reader->prefetch_thread, prefetch_worker, batch_reader) == CARQUET_OK;
+}
+
+static void stop_prefetch(carquet_batch_reader_t* batch_reader) {
+    if (batch_reader->prefetch_running) {
+        carquet_mutex_lock(&batch_reader->prefetch_mutex);
+        batch_reader->prefetch_shutdown = true;
+        carquet_cond_broadcast(&batch_reader->prefetch_cond);
+        carquet_mutex_unlock(&batch_reader->prefetch_mutex);
+
+        carquet_thread_join(batch_reader->prefetch_thread);
+        batch_reader->prefetch_running = false;
+    }
+}
+
+/**
+ * Take over a read-ahead slot holding row_group_index, waiting for it if it
+ * is still loading. Returns false when the row group has to be loaded by the
+ * caller (not read ahead, or read-ahead failed and the error should surface
+ * from a synchronous load).
+ */
+static bool take_prefetched_row_group(
+    carquet_batch_reader_t* batch_reader,
+    int32_t row_group_index) {
+
+    bool taken = false;
+
+    carquet_mutex_lock(&batch_reader->prefetch_mutex);
+    for (int32_t i = 0; i < batch_reader->num_prefetch_slots; i++) {
+        prefetch_slot_t* slot = &batch_reader->prefetch_slots[i];
+        if (slot->state == PREFETCH_SLOT_EMPTY || slot->row_group > row_group_index) {
+            continue;
+        }
+
+        while (slot->state == PREFETCH_SLOT_LOADING) {
+            carquet_cond_wait(&batch_reader->prefetch_cond, &batch_reader->prefetch_mutex);
+        }
+
+        if (slot->row_group == row_group_index && slot->status == CARQUET_OK) {
+            /* Swap reader arrays and chunk buffers: the slot gets the
+             * (closed) current ones back for reuse. */
+            carquet_column_reader_t** readers = batch_reader->col_readers;
+            batch_reader->col_readers = slot->col_readers;
+            slot->col_readers = readers;
+
+            uint8_t* buffer = batch_reader->io_buffer;
+            size_t capacity = batch_reader->io_buffer_capacity;
+            batch_reader->io_buffer = slot->io_buffer;
+            batch_reader->io_buffer_capacity = slot->io_buffer_capacity;
+            slot->io_buffer = buffer;
+            slot->io_buffer_capacity = capacity;
+            taken = true;
+        } else {
+            /* Stale or failed slot */
+            close_column_readers(slot->col_readers, batch_reader->num_projected);
+        }
+        slot->state = PREFETCH_SLOT_EMPTY;
+    }
+
+    /* Never read ahead a row group the caller has already reached */
+    if (batch_reader->next_prefetch_row_group <= row_group_index) {
+        batch_reader->next_prefetch_row_group = row_group_index + 1;
+    }
+    carquet_cond_broadcast(&batch_reader->prefetch_cond);
+    carquet_mutex_unlock(&batch_reader->prefetch_mutex);
+
+    return taken;
+}
+
+/**
+ * Read a column in dictionary output mode. While its pages are dictionary
+ * encoded the batch keeps their int32 indices; a batch that reaches a page
+ * without a dictionary (a writer falling back to PLAIN mid-chunk, or a
+ * chunk with no dictionary at all) is materialized instead. col_data->data
+ * holds rows values, which is at least as large as rows indices.
+ */
+static int64_t read_dictionary_column(
+    carquet_batch_reader_t* batch_reader,
+    carquet_buffer_pool_t* pool,
+    int32_t col_i,
+    carquet_column_data_t* col_data,
+    int64_t rows,
+    int16_t* def_levels,
+    uint8_t* validity,
+    size_t value_size) {
+
+    carquet_column_reader_t* col_reader = batch_reader->col_readers[col_i];
+    int32_t* indices = (int32_t*)col_data->data;
+
+    int64_t read = validity
+        ? carquet_column_read_validity(col_reader, indices, rows, validity, 0, true)
+        : carquet_column_read_indices(col_reader, indices, rows, def_levels, NULL);
+    if (read < 0) {
+        return -1;
+    }
+
+    int32_t dictionary_size = 0;
+    const void* dictionary = read > 0
+        ? carquet_column_reader_dictionary(col_reader, &dictionary_size) : NULL;
+    if (dictionary && (read == rows || !carquet_column_has_next(col_reader))) {
+        col_data->dictionary = dictionary;
+        col_data->dictionary_size = dictionary_size;
+        col_data->dictionary_changed =
+            batch_reader->dictionary_row_groups[col_i] != batch_reader->current_row_group;
+        batch_reader->dictionary_row_groups[col_i] = batch_reader->current_row_group;
+        return read;
+    }
+
+    /* Materialize the indices read so far, then read the rest as values */
+    if (read > 0) {
+        size_t copy_capacity;
+        uint32_t* copy = carquet_buffer_pool_acquire(pool, (size_t)read * sizeof(uint32_t),
+                                                     &copy_capacity);
+        if (!copy) {
+            return -1;
+        }
+        memcpy(copy, indices, (size_t)read * sizeof(uint32_t));
+        carquet_column_reader_gather_dictionary(col_reader, copy, read, col_data->data);
+        carquet_buffer_pool_release(pool, copy, copy_capacity);
+    }
+
+    void* rest_values = (uint8_t*)col_data->data + (size_t)read * value_size;
+    int64_t rest = validity
+        ? carquet_column_read_validity(col_reader, rest_values, rows - read, validity, read, false)
+        : carquet_column_read_batch(col_reader, rest_values, rows - read,
+                                    def_levels ? def_levels + read : NULL, NULL);
+    if (rest < 0) {
+        return read > 0 ? read : -1;
+    }
+    return read + rest;
+}
+
+/**
+ * Count the nulls of a bitmap of count values whose set bits mark present
+ * values (from_validity) or nulls, and flip it if the batch wants the
+ * other polarity (validity: Arrow's, set bits mark present values).
+ */
+static int64_t finish_null_bitmap(uint8_t* bitmap, int64_t count,
+                                  bool from_validity, bool validity) {
+    bool flip = from_validity != validity;
+    int64_t set = 0;
+    int64_t full_bytes = count / 8;
+    for (int64_t b = 0; b < full_bytes; b++) {
+        set += carquet_popcount32(bitmap[b]);
+        if (flip) {
+            bitmap[b] = (uint8_t)~bitmap[b];
+        }
+    }
+    if (count % 8) {
+        uint8_t mask = (uint8_t)((1u << (count % 8)) - 1);
+        set += carquet_popcount32(bitmap[full_bytes] & mask);
+        bitmap[full_bytes] = (uint8_t)((flip ? ~bitmap[full_bytes] : bitmap[full_bytes]) & mask);
+    }
+    return from_validity ? count - set : set;
+}
+
+static carquet_status_t open_row_group_readers(
+    carquet_batch_reader_t* batch_reader,
+    int32_t row_group_index,
+    carquet_error_t* error) {
+
+    /* Close existing readers */
+    close_column_readers(batch_reader->col_readers, batch_reader->num_projected);
+
+    if (!batch_reader->prefetch_running ||
+        !take_prefetched_row_group(batch_reader, row_group_index)) {
+        carquet_status_t status = load_row_group(
+            batch_reader, row_group_index, batch_reader->col_readers,
+            &batch_reader->io_buffer, &batch_reader->io_buffer_capacity, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
     }
 
     batch_reader->current_row_group = row_group_index;
     batch_reader->rows_read_in_group = 0;
 
+    /* Start reading ahead once the first row group is in hand */
+    if (batch_reader->num_prefetch_slots > 0 && !batch_reader->prefetch_running &&
+        row_group_index + 1 < carquet_reader_num_row_groups(batch_reader->reader)) {
+        start_prefetch(batch_reader);
+    }
+
     return CARQUET_OK;
 }
 
-carquet_status_t carquet_batch_reader_next(
+/* Give the owned buffers of a batch's columns to pool (or free them with
+ * a NULL pool) and clear the columns */
+static void recycle_batch_columns(carquet_row_batch_t* batch, carquet_buffer_pool_t* pool) {
+    for (int32_t i = 0; i < batch->num_columns; i++) {
+        carquet_column_data_t* col = &batch->columns[i];
+        if (col->ownership == CARQUET_DATA_OWNED) {
+            carquet_buffer_pool_release(pool, col->data, col->data_capacity);
+        }
+        carquet_buffer_pool_release(pool, col->null_bitmap, col->bitmap_capacity);
+        carquet_buffer_pool_release(pool, col->offsets, col->offsets_capacity);
+        carquet_buffer_pool_release(pool, col->chars, col->chars_capacity);
+        memset(col, 0, sizeof(*col));
+    }
+    batch->num_columns = 0;
+    batch->num_rows = 0;
+}
+
+/**
+ * Read the next rows into batch, whose columns are clear. Column buffers
+ * come from pool, or straight from malloc() with a NULL pool. On failure
+ * the buffers allocated so far stay with the batch.
+ */
+static carquet_status_t fill_batch(
     carquet_batch_reader_t* batch_reader,
-    carquet_row_batch_t** batch) {
+    carquet_row_batch_t* new_batch,
+    carquet_buffer_pool_t* pool) {
 
-    /* batch_reader and batch are nonnull per API contract */
     carquet_error_t err = CARQUET_ERROR_INIT;
     int32_t num_row_groups = carquet_reader_num_row_groups(batch_reader->reader);
 
@@ -254,7 +711,6 @@ carquet_status_t carquet_batch_reader_next(
 
         batch_reader->current_row_group++;
         if (batch_reader->current_row_group >= num_row_groups) {
-            *batch = NULL;
             return CARQUET_ERROR_END_OF_DATA;
         }
 
@@ -265,25 +721,17 @@ carquet_status_t carquet_batch_reader_next(
         }
     }
 
-    /* Allocate batch */
-    carquet_row_batch_t* new_batch = calloc(1, sizeof(carquet_row_batch_t));
-    if (!new_batch) {
-        return CARQUET_ERROR_OUT_OF_MEMORY;
-    }
-
-    if (carquet_arena_init(&new_batch->arena) != CARQUET_OK) {
-        free(new_batch);
-        return CARQUET_ERROR_OUT_OF_MEMORY;
+    /* Column slots live in the batch's arena and are kept for reuse */
+    if (new_batch->column_capacity < batch_reader->num_projected) {
+        new_batch->columns = carquet_arena_calloc(&new_batch->arena,
+            batch_reader->num_projected, sizeof(carquet_column_data_t));
+        if (!new_batch->columns) {
+            new_batch->column_capacity = 0;
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+        new_batch->column_capacity = batch_reader->num_projected;
     }
-
     new_batch->num_columns = batch_reader->num_projected;
-    new_batch->columns = carquet_arena_calloc(&new_batch->arena,
-        batch_reader->num_projected, sizeof(carquet_column_data_t));
-    if (!new_batch->columns) {
-        carquet_arena_destroy(&new_batch->arena);
-        free(new_batch);
-        return CARQUET_ERROR_OUT_OF_MEMORY;
-    }
 
     int64_t batch_size = batch_reader->config.batch_size;
     int64_t rows_to_read = carquet_column_remaining(batch_reader->col_readers[0]);
@@ -294,7 +742,6 @@ carquet_status_t carquet_batch_reader_next(
     /* Handle empty row group - return empty batch, not an error */
     if (rows_to_read == 0) {
         new_batch->num_rows = 0;
-        *batch = new_batch;
         return CARQUET_OK;
     }
 
@@ -369,6 +816,13 @@ carquet_status_t carquet_batch_reader_next(
 
         col_data->type = elem->has_type ? elem->type : CARQUET_PHYSICAL_BYTE_ARRAY;
         col_data->type_length = elem->type_length;
+        col_data->name = elem->name;
+        col_data->is_string = col_data->type == CARQUET_PHYSICAL_BYTE_ARRAY &&
+            ((elem->has_logical_type && elem->logical_type.id == CARQUET_LOGICAL_STRING) ||
+             (elem->has_converted_type && elem->converted_type == CARQUET_CONVERTED_UTF8));
+        col_data->max_def_level = schema->max_def_levels[file_col_idx];
+        col_data->max_rep_level = schema->max_rep_levels[file_col_idx];
+        col_data->validity = batch_reader->config.arrow_layout;
 
         size_t value_size = get_type_size(col_data->type, col_data->type_length);
         int16_t max_def = schema->max_def_levels[file_col_idx];
@@ -392,11 +846,14 @@ carquet_status_t carquet_batch_reader_next(
             (void)local_err;
         }
 
-        /* Check if we got a zero-copy view and can use it directly */
+        /* Check if we got a zero-copy view and can use it directly. Arrow
+         * layout needs every column of the batch to hold the same rows. */
         bool use_zero_copy = col_reader->page_loaded &&
                              col_reader->decoded_ownership == CARQUET_DATA_VIEW &&
                              col_reader->page_values_read == 0 &&
                              col_reader->page_num_values <= (int32_t)rows_to_read &&
+                             (!batch_reader->config.arrow_layout ||
+                              col_reader->page_num_values == (int32_t)rows_to_read) &&
                              max_def == 0;
 
         if (use_zero_copy) {
@@ -407,9 +864,17 @@ carquet_status_t carquet_batch_reader_next(
             col_data->ownership = CARQUET_DATA_VIEW;
             col_data->num_values = col_reader->page_num_values;
 
-            /* No nulls in REQUIRED columns */
-            size_t bitmap_size = ((size_t)col_data->num_values + 7) / 8;
-            col_data->null_bitmap = calloc(1, bitmap_size);  /* All zeros = no nulls */
+            /* No nulls in REQUIRED columns; Arrow leaves the bitmap out */
+            if (!col_data->validity) {
+                size_t bitmap_size = ((size_t)col_data->num_values + 7) / 8;
+                col_data->null_bitmap = carquet_buffer_pool_acquire(
+                    pool, bitmap_size, &col_data->bitmap_capacity);
+                if (!col_data->null_bitmap) {
+                    read_error = true;
+                    continue;
+                }
+                memset(col_data->null_bitmap, 0, bitmap_size);  /* All zeros = no nulls */
+            }
 
             /* Mark page as consumed */
             col_reader->page_values_read = col_reader->page_num_values;
@@ -433,87 +898,161 @@ carquet_status_t carquet_batch_reader_next(
             size_t data_size = value_size * (size_t)rows_to_read;
 
             /* Allocate column data buffer */
-            col_data->data = malloc(data_size);
+            col_data->data = carquet_buffer_pool_acquire(pool, data_size, &col_data->data_capacity);
             if (!col_data->data) {
                 read_error = true;
                 continue;
             }
-            col_data->data_capacity = data_size;
             col_data->ownership = CARQUET_DATA_OWNED;
 
             /* Allocate null bitmap */
-            size_t bitmap_size = ((size_t)rows_to_read + 7) / 8;
-            col_data->null_bitmap = calloc(1, bitmap_size);
+            if (!col_data->validity || max_def > 0) {
+                size_t bitmap_size = ((size_t)rows_to_read + 7) / 8;
+                col_data->null_bitmap = carquet_buffer_pool_acquire(
+                    pool, bitmap_size, &col_data->bitmap_capacity);
+                if (!col_data->null_bitmap) {
+                    read_error = true;
+                    continue;
+                }
+                memset(col_data->null_bitmap, 0, bitmap_size);
+            }
 
-            /* Read values */
+            /* Read values. Def levels of max 1 are decoded straight into
+             * the bitmap as validity bits; deeper ones go through int16
+             * levels. */
+            uint8_t* validity = col_reader->validity_levels ? col_data->null_bitmap : NULL;
             int16_t* def_levels = NULL;
-            if (max_def > 0) {
-                def_levels = malloc(sizeof(int16_t) * (size_t)rows_to_read);
+            size_t def_capacity = 0;
+            if (max_def > 0 && !col_reader->validity_levels) {
+                def_levels = carquet_buffer_pool_acquire(
+                    pool, sizeof(int16_t) * (size_t)rows_to_read, &def_capacity);
+            }
+            if (max_def > 0 && !validity && !def_levels) {
+                read_error = true;
+                continue;
             }
 
-            int64_t values_read = carquet_column_read_batch(
-                col_reader, col_data->data, rows_to_read, def_levels, NULL);
+            int64_t values_read;
+            if (col_reader->dictionary_indices) {
+                values_read = read_dictionary_column(batch_reader, pool, col_i, col_data,
+                                                     rows_to_read, def_levels, validity,
+                                                     value_size);
+            } else if (validity) {
+                values_read = carquet_column_read_validity(
+                    col_reader, col_data->data, rows_to_read, validity, 0, false);
+            } else {
+                values_read = carquet_column_read_batch(
+                    col_reader, col_data->data, rows_to_read, def_levels, NULL);
+            }
 
             if (values_read < 0) {
                 read_error = true;
-                free(def_levels);
+                carquet_buffer_pool_release(pool, def_levels, def_capacity);
                 continue;
             }
 
             col_data->num_values = values_read;
 
-            /* Build null bitmap from definition levels */
-            if (def_levels && col_data->null_bitmap) {
-                int64_t full_bytes = values_read / 8;
-                for (int64_t b = 0; b < full_bytes; b++) {
-                    uint8_t null_bits = 0;
-                    int64_t base = b * 8;
-                    if (def_levels[base + 0] < max_def) null_bits |= 0x01;
-                    if (def_levels[base + 1] < max_def) null_bits |= 0x02;
-                    if (def_levels[base + 2] < max_def) null_bits |= 0x04;
-                    if (def_levels[base + 3] < max_def) null_bits |= 0x08;
-                    if (def_levels[base + 4] < max_def) null_bits |= 0x10;
-                    if (def_levels[base + 5] < max_def) null_bits |= 0x20;
-                    if (def_levels[base + 6] < max_def) null_bits |= 0x40;
-                    if (def_levels[base + 7] < max_def) null_bits |= 0x80;
-                    col_data->null_bitmap[b] = null_bits;
-                }
-                for (int64_t j = full_bytes * 8; j < values_read; j++) {
-                    if (def_levels[j] < max_def) {
-                        col_data->null_bitmap[j / 8] |= (1 << (j % 8));
-                    }
-                }
+            /* Null bitmap from the validity bits or definition levels */
+            if (validity) {
+                col_data->null_count = finish_null_bitmap(
+                    validity, values_read, true, col_data->validity);
+            } else if (def_levels && col_data->null_bitmap) {
+                carquet_dispatch_build_null_bitmap(def_levels, values_read, max_def,
+                                                   col_data->null_bitmap);
+                col_data->null_count = finish_null_bitmap(
+                    col_data->null_bitmap, values_read, false, col_data->validity);
             }
 
-            free(def_levels);
+            carquet_buffer_pool_release(pool, def_levels, def_capacity);
+
+            /* Arrow strings: offsets into one run of bytes next to the views */
+            if (col_data->validity && col_data->type == CARQUET_PHYSICAL_BYTE_ARRAY &&
+                !col_data->dictionary &&
+                carquet_byte_arrays_to_arrow((const carquet_byte_array_t*)col_data->data,
+                                             values_read, pool,
+                                             &col_data->offsets, &col_data->offsets_capacity,
+                                             &col_data->chars,
+                                             &col_data->chars_capacity) != CARQUET_OK) {
+                read_error = true;
+                continue;
+            }
         }
     }
 
     if (read_error) {
-        carquet_row_batch_free(new_batch);
         return CARQUET_ERROR_DECODE;
     }
 
     new_batch->num_rows = new_batch->columns[0].num_values;
     batch_reader->total_rows_read += new_batch->num_rows;
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_batch_reader_next(
+    carquet_batch_reader_t* batch_reader,
+    carquet_row_batch_t** batch) {
+
+    /* batch_reader and batch are nonnull per API contract. The batch is
+     * the caller's to free, so its buffers never come back to the pool. */
+    carquet_row_batch_t* new_batch = carquet_row_batch_create(NULL);
+    if (!new_batch) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    carquet_status_t status = fill_batch(batch_reader, new_batch, NULL);
+    if (status != CARQUET_OK) {
+        carquet_row_batch_free(new_batch);
+        if (status == CARQUET_ERROR_END_OF_DATA) {
+            *batch = NULL;
+        }
+        return status;
+    }
 
     *batch = new_batch;
     return CARQUET_OK;
 }
 
+carquet_status_t carquet_batch_reader_next_into(
+    carquet_batch_reader_t* batch_reader,
+    carquet_row_batch_t* batch) {
+
+    /* batch_reader and batch are nonnull per API contract */
+    recycle_batch_columns(batch, &batch_reader->pool);
+
+    carquet_status_t status = fill_batch(batch_reader, batch, &batch_reader->pool);
+    if (status != CARQUET_OK) {
+        batch->num_rows = 0;
+    }
+    return status;
+}
+
 void carquet_batch_reader_free(carquet_batch_reader_t* batch_reader) {
     if (!batch_reader) return;
 
+    /* Stop read-ahead before touching its slots */
+    stop_prefetch(batch_reader);
+    if (batch_reader->prefetch_slots) {
+        for (int32_t i = 0; i < batch_reader->num_prefetch_slots; i++) {
+            prefetch_slot_t* slot = &batch_reader->prefetch_slots[i];
+            close_column_readers(slot->col_readers, batch_reader->num_projected);
+            free(slot->col_readers);
+            free(slot->io_buffer);
+        }
+        free(batch_reader->prefetch_slots);
+        carquet_mutex_destroy(&batch_reader->prefetch_mutex);
+        carquet_cond_destroy(&batch_reader->prefetch_cond);
+    }
+
     /* Free column readers */
     if (batch_reader->col_readers) {
-        for (int32_t i = 0; i < batch_reader->num_projected; i++) {
-            if (batch_reader->col_readers[i]) {
-                carquet_column_reader_free(batch_reader->col_readers[i]);
-            }
-        }
+        close_column_readers(batch_reader->col_readers, batch_reader->num_projected);
         free(batch_reader->col_readers);
     }
 
+    carquet_buffer_pool_destroy(&batch_reader->pool);
+    free(batch_reader->io_buffer);
+    free(batch_reader->dictionary_row_groups);
     free(batch_reader->projected_columns);
     free(batch_reader);
 }
@@ -523,6 +1062,50 @@ void carquet_batch_reader_free(carquet_batch_reader_t* batch_reader) {
  * ============================================================================
  */
 
+carquet_status_t carquet_byte_arrays_to_arrow(
+    const carquet_byte_array_t* values,
+    int64_t count,
+    carquet_buffer_pool_t* pool,
+    int32_t** offsets,
+    size_t* offsets_capacity,
+    uint8_t** chars,
+    size_t* chars_capacity) {
+
+    int32_t* out_offsets = carquet_buffer_pool_acquire(
+        pool, ((size_t)count + 1) * sizeof(int32_t), offsets_capacity);
+    if (!out_offsets) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    int64_t total = 0;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < count; i++) {
+        total += values[i].length;
+        if (total > INT32_MAX) {
+            /* Would need Arrow's large binary (int64 offsets) */
+            carquet_buffer_pool_release(pool, out_offsets, *offsets_capacity);
+            return CARQUET_ERROR_NOT_IMPLEMENTED;
+        }
+        out_offsets[i + 1] = (int32_t)total;
+    }
+
+    uint8_t* out_chars = carquet_buffer_pool_acquire(pool, total > 0 ? (size_t)total : 1,
+                                                     chars_capacity);
+    if (!out_chars) {
+        carquet_buffer_pool_release(pool, out_offsets, *offsets_capacity);
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    for (int64_t i = 0; i < count; i++) {
+        if (values[i].length > 0) {
+            memcpy(out_chars + out_offsets[i], values[i].data, (size_t)values[i].length);
+        }
+    }
+
+    *offsets = out_offsets;
+    *chars = out_chars;
+    return CARQUET_OK;
+}
+
 int64_t carquet_row_batch_num_rows(const carquet_row_batch_t* batch) {
     /* batch is nonnull per API contract */
     return batch->num_rows;
@@ -554,17 +1137,43 @@ carquet_status_t carquet_row_batch_column(
     return CARQUET_OK;
 }
 
+carquet_status_t carquet_row_batch_column_dictionary(
+    const carquet_row_batch_t* batch,
+    int32_t column_index,
+    const void** dictionary,
+    int32_t* dictionary_size,
+    bool* dictionary_changed) {
+
+    /* All pointers are nonnull per API contract */
+    if (column_index < 0 || column_index >= batch->num_columns) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    const carquet_column_data_t* col = &batch->columns[column_index];
+
+    *dictionary = col->dictionary;
+    *dictionary_size = col->dictionary_size;
+    *dictionary_changed = col->dictionary_changed;
+
+    return CARQUET_OK;
+}
+
+carquet_row_batch_t* carquet_row_batch_create(carquet_error_t* error) {
+    carquet_row_batch_t* batch = calloc(1, sizeof(carquet_row_batch_t));
+    if (!batch || carquet_arena_init(&batch->arena) != CARQUET_OK) {
+        free(batch);
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate row batch");
+        return NULL;
+    }
+    return batch;
+}
+
 void carquet_row_batch_free(carquet_row_batch_t* batch) {
     if (!batch) return;
 
-    /* Free column data (only if owned, not views into mmap) */
-    for (int32_t i = 0; i < batch->num_columns; i++) {
-        if (batch->columns[i].ownership == CARQUET_DATA_OWNED) {
-            free(batch->columns[i].data);
-        }
-        /* null_bitmap is always owned */
-        free(batch->columns[i].null_bitmap);
-    }
+    /* Free column data (only if owned, not views into mmap); null_bitmap
+     * and Arrow buffers are always owned */
+    recycle_batch_columns(batch, NULL);
 
     carquet_arena_destroy(&batch->arena);
     free(batch);
@@ -9,6 +9,7 @@
 #include "encoding/plain.h"
 #include "encoding/rle.h"
 #include "core/endian.h"
+#include "core/bitpack.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -23,11 +24,57 @@ extern carquet_status_t carquet_read_next_page(
     int64_t* values_read,
     carquet_error_t* error);
 
+extern carquet_status_t carquet_read_next_page_indices(
+    carquet_column_reader_t* reader,
+    int32_t* indices,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error);
+
+extern carquet_status_t carquet_read_next_page_validity(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t validity_offset,
+    bool as_indices,
+    int64_t* values_read,
+    carquet_error_t* error);
+
+/* SIMD dispatch function for def levels to null bits */
+extern void carquet_dispatch_build_null_bitmap(const int16_t* def_levels, int64_t count,
+                                                int16_t max_def_level, uint8_t* null_bitmap);
+
 /* ============================================================================
  * Batch Reading
  * ============================================================================
  */
 
+/* Size of one value in the output array, or 0 for an unknown type */
+static size_t read_value_size(const carquet_column_reader_t* reader) {
+    switch (reader->type) {
+        case CARQUET_PHYSICAL_BOOLEAN:
+            return 1;
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_FLOAT:
+            return 4;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE:
+            return 8;
+        case CARQUET_PHYSICAL_INT96:
+            return 12;
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            return (size_t)reader->type_length;
+        case CARQUET_PHYSICAL_BYTE_ARRAY:
+            /* Variable length - handled differently */
+            return sizeof(carquet_byte_array_t);
+        default:
+            return 0;
+    }
+}
+
 int64_t carquet_column_read_batch(
     carquet_column_reader_t* reader,
     void* values,
@@ -39,6 +86,7 @@ int64_t carquet_column_read_batch(
     if (max_values < 0) {
         return -1;
     }
+    carquet_column_reader_release_batch(reader);
     if (max_values == 0) {
         /* Load page if needed, but don't read any values */
         if (reader->values_remaining > 0 && !reader->page_loaded) {
@@ -58,33 +106,11 @@ int64_t carquet_column_read_batch(
 
     carquet_error_t error = CARQUET_ERROR_INIT;
     int64_t total_read = 0;
-    size_t value_size = 0;
 
     /* Determine value size for pointer arithmetic */
-    switch (reader->type) {
-        case CARQUET_PHYSICAL_BOOLEAN:
-            value_size = 1;
-            break;
-        case CARQUET_PHYSICAL_INT32:
-        case CARQUET_PHYSICAL_FLOAT:
-            value_size = 4;
-            break;
-        case CARQUET_PHYSICAL_INT64:
-        case CARQUET_PHYSICAL_DOUBLE:
-            value_size = 8;
-            break;
-        case CARQUET_PHYSICAL_INT96:
-            value_size = 12;
-            break;
-        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
-            value_size = reader->type_length;
-            break;
-        case CARQUET_PHYSICAL_BYTE_ARRAY:
-            /* Variable length - handled differently */
-            value_size = sizeof(carquet_byte_array_t);
-            break;
-        default:
-            return -1;
+    size_t value_size = read_value_size(reader);
+    if (value_size == 0) {
+        return -1;
     }
 
     /* Read pages until we have enough values or run out */
@@ -117,6 +143,203 @@ int64_t carquet_column_read_batch(
     return total_read;
 }
 
+int64_t carquet_column_read_indices(
+    carquet_column_reader_t* reader,
+    int32_t* indices,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels) {
+
+    if (max_values < 0) {
+        return -1;
+    }
+    carquet_column_reader_release_batch(reader);
+
+    carquet_error_t error = CARQUET_ERROR_INIT;
+    int64_t total_read = 0;
+
+    while (total_read < max_values && reader->values_remaining > 0) {
+        int64_t values_read = 0;
+        carquet_status_t status = carquet_read_next_page_indices(
+            reader, indices + total_read, max_values - total_read,
+            def_levels ? def_levels + total_read : NULL,
+            rep_levels ? rep_levels + total_read : NULL,
+            &values_read, &error);
+
+        if (status != CARQUET_OK) {
+            if (total_read > 0) {
+                break;
+            }
+            return -1;
+        }
+
+        /* The next page is not dictionary-encoded */
+        if (values_read == 0) {
+            break;
+        }
+
+        total_read += values_read;
+    }
+
+    return total_read;
+}
+
+int64_t carquet_column_read_validity(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t validity_offset,
+    bool as_indices) {
+
+    if (max_values < 0) {
+        return -1;
+    }
+    carquet_column_reader_release_batch(reader);
+
+    size_t value_size = as_indices ? sizeof(int32_t) : read_value_size(reader);
+    if (value_size == 0) {
+        return -1;
+    }
+    carquet_error_t error = CARQUET_ERROR_INIT;
+    int64_t total_read = 0;
+
+    while (total_read < max_values && reader->values_remaining > 0) {
+        int64_t values_read = 0;
+        carquet_status_t status = carquet_read_next_page_validity(
+            reader, (uint8_t*)values + (size_t)total_read * value_size,
+            max_values - total_read, validity, validity_offset + total_read,
+            as_indices, &values_read, &error);
+
+        if (status != CARQUET_OK) {
+            if (total_read > 0) {
+                break;
+            }
+            return -1;
+        }
+
+        /* End of data, or (as_indices) a page that is not dictionary-encoded */
+        if (values_read == 0) {
+            break;
+        }
+
+        total_read += values_read;
+    }
+
+    return total_read;
+}
+
+/* ============================================================================
+ * Spaced Reading
+ * ============================================================================
+ */
+
+/* Levels decoded per step for columns with max_def_level > 1 */
+#define SPACED_LEVEL_CHUNK 1024
+
+/**
+ * Switch a flat column reader to spaced values (and, for max_def_level 1,
+ * validity bits). Pages decode in the new layout from their next load, so
+ * a page partly read packed is dropped and decoded again from its first
+ * unread entry, and the staging buffers are reallocated for the new levels.
+ */
+static void begin_spaced_values(carquet_column_reader_t* reader) {
+    bool validity_levels = reader->max_def_level == 1;
+    if (reader->spaced_values && reader->validity_levels == validity_levels) {
+        return;
+    }
+    if (reader->page_loaded && reader->page_values_read < reader->page_num_values) {
+        reader->page_skip = reader->page_values_read;
+        reader->page_loaded = false;
+    }
+    reader->spaced_values = true;
+    if (reader->validity_levels != validity_levels) {
+        reader->validity_levels = validity_levels;
+        reader->decoded_capacity = 0;
+    }
+}
+
+/* Columns with max_def_level > 1: int16 levels a chunk at a time, turned
+ * into validity bits */
+static int64_t read_spaced_levels(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity) {
+
+    size_t value_size = read_value_size(reader);
+    if (value_size == 0) {
+        return -1;
+    }
+    int16_t def_levels[SPACED_LEVEL_CHUNK];
+    uint8_t bits[SPACED_LEVEL_CHUNK / 8];
+    carquet_error_t error = CARQUET_ERROR_INIT;
+    int64_t total_read = 0;
+
+    while (total_read < max_values && reader->values_remaining > 0) {
+        int64_t values_read = 0;
+        int64_t to_read = max_values - total_read;
+        if (to_read > SPACED_LEVEL_CHUNK) {
+            to_read = SPACED_LEVEL_CHUNK;
+        }
+
+        carquet_status_t status = carquet_read_next_page(
+            reader, (uint8_t*)values + (size_t)total_read * value_size, to_read,
+            def_levels, NULL, &values_read, &error);
+        if (status != CARQUET_OK) {
+            if (total_read > 0) {
+                break;
+            }
+            return -1;
+        }
+        if (values_read == 0) {
+            break;
+        }
+
+        /* build_null_bitmap ORs in the bits of a partial last byte */
+        bits[(values_read - 1) / 8] = 0;
+        carquet_dispatch_build_null_bitmap(def_levels, values_read, reader->max_def_level, bits);
+        for (int64_t b = 0; b < (values_read + 7) / 8; b++) {
+            bits[b] = (uint8_t)~bits[b];
+        }
+        carquet_bitmap_copy(validity, total_read, bits, 0, values_read);
+        total_read += values_read;
+    }
+
+    return total_read;
+}
+
+int64_t carquet_column_read_spaced(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t* null_count) {
+
+    if (max_values < 0 || reader->max_rep_level > 0) {
+        return -1;
+    }
+    begin_spaced_values(reader);
+
+    int64_t total_read;
+    if (reader->max_def_level == 1) {
+        total_read = carquet_column_read_validity(reader, values, max_values, validity, 0, false);
+    } else if (reader->max_def_level == 0) {
+        total_read = carquet_column_read_batch(reader, values, max_values, NULL, NULL);
+        if (total_read > 0) {
+            carquet_bitmap_fill(validity, 0, total_read, true);
+        }
+    } else {
+        carquet_column_reader_release_batch(reader);
+        total_read = read_spaced_levels(reader, values, max_values, validity);
+    }
+
+    if (null_count && total_read >= 0) {
+        *null_count = total_read - carquet_bitmap_count(validity, 0, total_read);
+    }
+    return total_read;
+}
+
 /* ============================================================================
  * Skip Values
  * ============================================================================
@@ -127,59 +350,235 @@ int64_t carquet_column_skip(
     int64_t num_values) {
 
     /* reader is nonnull per API contract */
+    carquet_column_reader_release_batch(reader);
     if (num_values <= 0 || reader->values_remaining <= 0) {
         return 0;
     }
 
-    /* Allocate temporary buffer for skipping */
-    size_t value_size = 0;
-    switch (reader->type) {
-        case CARQUET_PHYSICAL_BOOLEAN:
-            value_size = 1;
-            break;
-        case CARQUET_PHYSICAL_INT32:
-        case CARQUET_PHYSICAL_FLOAT:
-            value_size = 4;
-            break;
-        case CARQUET_PHYSICAL_INT64:
-        case CARQUET_PHYSICAL_DOUBLE:
-            value_size = 8;
-            break;
-        case CARQUET_PHYSICAL_INT96:
-            value_size = 12;
-            break;
-        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
-            value_size = reader->type_length;
+    carquet_error_t error = CARQUET_ERROR_INIT;
+    int64_t total_skipped = 0;
+
+    while (total_skipped < num_values && reader->values_remaining > 0) {
+        int64_t to_skip = num_values - total_skipped;
+
+        /* Values of the decoded page: just move the cursor */
+        if (reader->page_loaded && reader->page_values_read < reader->page_num_values) {
+            int64_t available = reader->page_num_values - reader->page_values_read;
+            if (to_skip > available) {
+                to_skip = available;
+            }
+            reader->page_values_read += (int32_t)to_skip;
+            reader->values_remaining -= to_skip;
+            total_skipped += to_skip;
+            continue;
+        }
+
+        if (reader->page_loaded) {
+            reader->current_page += reader->page_header_size + reader->page_compressed_size;
+            reader->page_loaded = false;
+        }
+
+        /* Whole pages are stepped over by their header, never decompressed */
+        int32_t page_values = 0;
+        if (carquet_column_reader_skip_page(reader, to_skip, &page_values, &error) != CARQUET_OK) {
             break;
-        case CARQUET_PHYSICAL_BYTE_ARRAY:
-            value_size = sizeof(carquet_byte_array_t);
+        }
+        if (page_values <= to_skip) {
+            reader->values_remaining -= page_values;
+            total_skipped += page_values;
+            continue;
+        }
+
+        /* The skip ends inside this page: decode only what follows it */
+        uint8_t dummy[16];
+        int64_t values_read = 0;
+        reader->page_skip = (int32_t)to_skip;
+        if (carquet_read_next_page(reader, dummy, 0, NULL, NULL, &values_read, &error) != CARQUET_OK) {
+            reader->page_skip = 0;
             break;
-        default:
-            return 0;
+        }
+        reader->values_remaining -= reader->page_values_read;
+        total_skipped += reader->page_values_read;
     }
 
-    /* Read and discard values in chunks */
-    int64_t total_skipped = 0;
-    int64_t chunk_size = 1024;
+    return total_skipped;
+}
 
-    void* temp = malloc(chunk_size * value_size);
-    if (!temp) {
-        return 0;
+/* ============================================================================
+ * Seeking
+ * ============================================================================
+ */
+
+/**
+ * Make sure a page with unread values is loaded. Returns false at the end
+ * of the chunk or on error.
+ */
+static bool ensure_page(carquet_column_reader_t* reader, carquet_error_t* error) {
+    if (reader->values_remaining <= 0) {
+        return false;
     }
+    uint8_t dummy[16];
+    int64_t values_read = 0;
+    return carquet_read_next_page(reader, dummy, 0, NULL, NULL, &values_read, error) == CARQUET_OK;
+}
 
-    while (total_skipped < num_values && reader->values_remaining > 0) {
-        int64_t to_skip = num_values - total_skipped;
-        if (to_skip > chunk_size) {
-            to_skip = chunk_size;
+/**
+ * Advance past num_rows rows from the current position, which must be the
+ * start of a row. Stops early at the end of the chunk.
+ */
+static carquet_status_t skip_rows(
+    carquet_column_reader_t* reader,
+    int64_t num_rows,
+    carquet_error_t* error) {
+
+    /* Flat columns hold one value per row */
+    if (reader->max_rep_level == 0) {
+        if (carquet_column_skip(reader, num_rows) < num_rows && reader->values_remaining > 0) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Failed to skip to row");
+            return CARQUET_ERROR_DECODE;
+        }
+        return CARQUET_OK;
+    }
+
+    while (true) {
+        /* V2 headers count rows, so whole pages are stepped over without
+         * decoding their levels */
+        if (reader->values_remaining > 0 &&
+            (!reader->page_loaded || reader->page_values_read >= reader->page_num_values)) {
+            if (reader->page_loaded) {
+                reader->current_page += reader->page_header_size + reader->page_compressed_size;
+                reader->page_loaded = false;
+            }
+            int32_t page_rows = 0;
+            int32_t page_values = 0;
+            carquet_status_t status = carquet_column_reader_skip_page_rows(
+                reader, num_rows, &page_rows, &page_values, error);
+            if (status != CARQUET_OK) {
+                return status;
+            }
+            if (page_rows >= 0 && page_rows <= num_rows) {
+                num_rows -= page_rows;
+                reader->values_remaining -= page_values;
+                continue;
+            }
         }
 
-        int64_t skipped = carquet_column_read_batch(reader, temp, to_skip, NULL, NULL);
-        if (skipped <= 0) {
+        if (!ensure_page(reader, error)) {
+            return reader->values_remaining <= 0 ? CARQUET_OK
+                                                 : (error ? error->code : CARQUET_ERROR_DECODE);
+        }
+
+        int32_t start = reader->page_values_read;
+        int32_t end = reader->page_num_values;
+        int32_t stop = end;
+
+        /* Rows start at repetition level 0; stop on the start of the row
+         * after the skipped ones */
+        for (int32_t i = start; i < end; i++) {
+            if (reader->decoded_rep_levels[i] == 0 && num_rows-- == 0) {
+                stop = i;
+                break;
+            }
+        }
+
+        reader->page_values_read = stop;
+        reader->values_remaining -= stop - start;
+        if (stop < end) {
             break;
         }
-        total_skipped += skipped;
     }
 
-    free(temp);
-    return total_skipped;
+    return CARQUET_OK;
+}
+
+static carquet_status_t load_offset_index(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error) {
+
+    const parquet_column_chunk_t* chunk = reader->chunk;
+    reader->offset_index_loaded = true;
+
+    if (carquet_arena_init_size(&reader->page_index_arena, 4096) != CARQUET_OK) {
+        reader->offset_index_loaded = false;
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate page index arena");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (!chunk->has_offset_index_offset || !chunk->has_offset_index_length) {
+        return CARQUET_OK;
+    }
+
+    carquet_status_t status = carquet_reader_load_offset_index(
+        reader->file_reader, chunk, &reader->page_index_arena, &reader->offset_index, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    reader->has_offset_index = reader->offset_index.num_pages > 0 &&
+                               reader->offset_index.page_locations[0].first_row_index == 0;
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_column_seek_row(
+    carquet_column_reader_t* reader,
+    int64_t row,
+    carquet_error_t* error) {
+
+    /* reader is nonnull per API contract */
+    carquet_column_reader_release_batch(reader);
+    const parquet_row_group_t* rg =
+        &reader->file_reader->metadata.row_groups[reader->row_group_index];
+    if (row < 0 || row > rg->num_rows) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT,
+            "Row %lld outside row group of %lld rows", (long long)row, (long long)rg->num_rows);
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!reader->offset_index_loaded) {
+        carquet_status_t status = load_offset_index(reader, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    bool repeated = reader->max_rep_level > 0;
+    int64_t position = reader->col_meta->num_values - reader->values_remaining;
+
+    /* Flat columns hold one value per row, so a target later in the
+     * current page is reached by skipping within it */
+    if (!repeated && reader->page_loaded && row >= position &&
+        row - position < reader->page_num_values - reader->page_values_read) {
+        return skip_rows(reader, row - position, error);
+    }
+
+    if (reader->has_offset_index) {
+        /* Last page starting at or before the row */
+        const parquet_offset_index_t* index = &reader->offset_index;
+        int32_t lo = 0;
+        int32_t hi = index->num_pages - 1;
+        while (lo < hi) {
+            int32_t mid = lo + (hi - lo + 1) / 2;
+            if (index->page_locations[mid].first_row_index <= row) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+
+        carquet_status_t status = carquet_column_reader_seek_page(reader, lo, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        return skip_rows(reader, row - index->page_locations[lo].first_row_index, error);
+    }
+
+    /* No OffsetIndex: skip forward, rewinding to the chunk start first if
+     * the row is behind us (or cannot be located, for repeated columns) */
+    if (repeated || row < position) {
+        reader->page_loaded = false;
+        reader->current_page = 0;
+        reader->values_remaining = reader->col_meta->num_values;
+        position = 0;
+    }
+    return skip_rows(reader, row - position, error);
 }
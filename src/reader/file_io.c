@@ -0,0 +1,460 @@
+/**
+ * @file file_io.c
+ * @brief Positional file I/O for the non-mmap read path
+ *
+ * All footer, dictionary and page reads on the non-mmap path go through
+ * carquet_io_read_at(), which reads at an explicit offset (pread on POSIX,
+ * ReadFile with an OVERLAPPED offset on Windows). No seek position is
+ * shared between callers, so column readers of the same carquet_reader_t
+ * can fetch pages concurrently. Readers opened with
+ * carquet_reader_open_source() route the same reads to the caller's
+ * carquet_input_source_t instead.
+ */
+
+#include <carquet/carquet.h>
+#include "reader_internal.h"
+#include "core/thread.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+/* ============================================================================
+ * Platform-specific Implementation
+ * ============================================================================
+ */
+
+#ifdef _WIN32
+
+carquet_status_t carquet_io_init(
+    carquet_reader_t* reader,
+    FILE* file,
+    carquet_error_t* error) {
+
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+    if (handle == INVALID_HANDLE_VALUE) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_OPEN, "Failed to get file handle");
+        return CARQUET_ERROR_FILE_OPEN;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size)) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to get file size");
+        return CARQUET_ERROR_FILE_READ;
+    }
+
+    reader->file_handle = handle;
+    reader->file_size = (size_t)size.QuadPart;
+    return CARQUET_OK;
+}
+
+static size_t io_pread(carquet_reader_t* reader, void* buffer, size_t length,
+                       int64_t offset, bool* failed) {
+    uint8_t* out = (uint8_t*)buffer;
+    size_t total = 0;
+
+    while (total < length) {
+        OVERLAPPED ov;
+        memset(&ov, 0, sizeof(ov));
+        uint64_t pos = (uint64_t)offset + total;
+        ov.Offset = (DWORD)(pos & 0xFFFFFFFFu);
+        ov.OffsetHigh = (DWORD)(pos >> 32);
+
+        size_t want = length - total;
+        DWORD chunk = want > 0x40000000u ? 0x40000000u : (DWORD)want;
+        DWORD got = 0;
+        if (!ReadFile(reader->file_handle, out + total, chunk, &got, &ov)) {
+            if (GetLastError() != ERROR_HANDLE_EOF) {
+                *failed = true;
+            }
+            break;
+        }
+        if (got == 0) {
+            break;  /* EOF */
+        }
+        total += got;
+    }
+    return total;
+}
+
+#else /* POSIX */
+
+carquet_status_t carquet_io_init(
+    carquet_reader_t* reader,
+    FILE* file,
+    carquet_error_t* error) {
+
+    int fd = fileno(file);
+    if (fd < 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_OPEN, "Failed to get file descriptor");
+        return CARQUET_ERROR_FILE_OPEN;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to stat file");
+        return CARQUET_ERROR_FILE_READ;
+    }
+
+    reader->fd = fd;
+    reader->file_size = (size_t)st.st_size;
+    return CARQUET_OK;
+}
+
+static size_t io_pread(carquet_reader_t* reader, void* buffer, size_t length,
+                       int64_t offset, bool* failed) {
+    uint8_t* out = (uint8_t*)buffer;
+    size_t total = 0;
+
+    /* pread may return short counts (signals, pipes, network filesystems) */
+    while (total < length) {
+        ssize_t got = pread(reader->fd, out + total, length - total,
+                            (off_t)(offset + (int64_t)total));
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            *failed = true;
+            break;
+        }
+        if (got == 0) {
+            break;  /* EOF */
+        }
+        total += (size_t)got;
+    }
+    return total;
+}
+
+#endif
+
+/* ============================================================================
+ * Positional Reads
+ * ============================================================================
+ */
+
+carquet_status_t carquet_io_init_source(
+    carquet_reader_t* reader,
+    const carquet_input_source_t* source,
+    carquet_error_t* error) {
+
+    if (!source->size || !source->read_at) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT,
+            "Input source requires size and read_at");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    int64_t size = source->size(source->ctx);
+    if (size < 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to get input source size");
+        return CARQUET_ERROR_FILE_READ;
+    }
+
+    reader->source = *source;
+    reader->has_source = true;
+    reader->file_size = (size_t)size;
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_io_read_at(
+    carquet_reader_t* reader,
+    int64_t offset,
+    size_t length,
+    void* buffer,
+    carquet_error_t* error) {
+
+    if (offset < 0 || (uint64_t)offset > reader->file_size ||
+        length > reader->file_size - (size_t)offset) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_TRUNCATED,
+            "Read of %zu bytes at offset %lld exceeds file size %zu",
+            length, (long long)offset, reader->file_size);
+        return CARQUET_ERROR_FILE_TRUNCATED;
+    }
+
+    if (length == 0) {
+        return CARQUET_OK;
+    }
+
+    if (reader->has_source) {
+        carquet_status_t status = reader->source.read_at(
+            reader->source.ctx, offset, buffer, length);
+        if (status != CARQUET_OK) {
+            CARQUET_SET_ERROR(error, status,
+                "Input source failed to read %zu bytes at offset %lld",
+                length, (long long)offset);
+        }
+        return status;
+    }
+
+    bool failed = false;
+    size_t got = io_pread(reader, buffer, length, offset, &failed);
+    if (failed || got != length) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ,
+            "Failed to read %zu bytes at offset %lld", length, (long long)offset);
+        return CARQUET_ERROR_FILE_READ;
+    }
+
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Column Chunk Ranges
+ * ============================================================================
+ */
+
+bool carquet_io_chunk_range(
+    const carquet_reader_t* reader,
+    const parquet_column_metadata_t* col_meta,
+    int64_t* offset,
+    int64_t* length) {
+
+    /* The dictionary page, when present, precedes the data pages */
+    int64_t start = col_meta->data_page_offset;
+    if (col_meta->has_dictionary_page_offset &&
+        col_meta->dictionary_page_offset > 0 &&
+        col_meta->dictionary_page_offset < start) {
+        start = col_meta->dictionary_page_offset;
+    }
+
+    int64_t size = col_meta->total_compressed_size;
+    if (start < 0 || size <= 0 ||
+        (uint64_t)start > reader->file_size ||
+        (uint64_t)size > reader->file_size - (uint64_t)start) {
+        return false;
+    }
+
+    *offset = start;
+    *length = size;
+    return true;
+}
+
+static int compare_range_ptr(const void* a, const void* b) {
+    const carquet_io_range_t* ra = *(const carquet_io_range_t* const*)a;
+    const carquet_io_range_t* rb = *(const carquet_io_range_t* const*)b;
+    if (ra->offset < rb->offset) return -1;
+    if (ra->offset > rb->offset) return 1;
+    return 0;
+}
+
+carquet_status_t carquet_io_plan_ranges(
+    carquet_io_range_t* ranges,
+    int32_t count,
+    int64_t max_gap,
+    carquet_io_range_t* merged,
+    int32_t* num_merged,
+    int64_t* buffer_size) {
+
+    *num_merged = 0;
+    *buffer_size = 0;
+    if (count <= 0) {
+        return CARQUET_OK;
+    }
+
+    /* Sort through an index so callers keep their own range order */
+    carquet_io_range_t** order = malloc(sizeof(carquet_io_range_t*) * (size_t)count);
+    if (!order) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        order[i] = &ranges[i];
+    }
+    qsort(order, (size_t)count, sizeof(carquet_io_range_t*), compare_range_ptr);
+
+    int32_t m = -1;
+    int64_t total = 0;
+    for (int32_t i = 0; i < count; i++) {
+        carquet_io_range_t* r = order[i];
+        carquet_io_range_t* cur = m >= 0 ? &merged[m] : NULL;
+
+        if (cur && max_gap >= 0 && r->offset <= cur->offset + cur->length + max_gap) {
+            /* Extend the current read (ranges may overlap on odd metadata) */
+            int64_t end = r->offset + r->length;
+            if (end > cur->offset + cur->length) {
+                total += end - (cur->offset + cur->length);
+                cur->length = end - cur->offset;
+            }
+        } else {
+            m++;
+            merged[m].offset = r->offset;
+            merged[m].length = r->length;
+            merged[m].buffer_offset = total;
+            total += r->length;
+            cur = &merged[m];
+        }
+        r->buffer_offset = cur->buffer_offset + (r->offset - cur->offset);
+    }
+
+    free(order);
+    *num_merged = m + 1;
+    *buffer_size = total;
+    return CARQUET_OK;
+}
+
+/* Outstanding reads of one read_ranges_async() call */
+typedef struct async_read_batch {
+    carquet_mutex_t mutex;
+    carquet_cond_t cond;
+    int32_t pending;
+    carquet_status_t status;
+} async_read_batch_t;
+
+static void async_read_done(void* user_data, carquet_status_t status) {
+    async_read_batch_t* batch = (async_read_batch_t*)user_data;
+    carquet_mutex_lock(&batch->mutex);
+    if (status != CARQUET_OK && batch->status == CARQUET_OK) {
+        batch->status = status;
+    }
+    if (--batch->pending == 0) {
+        carquet_cond_broadcast(&batch->cond);
+    }
+    carquet_mutex_unlock(&batch->mutex);
+}
+
+/**
+ * Start every read through the source's read_at_async, then wait for all
+ * of them, so a high-latency source serves the whole plan concurrently.
+ */
+static carquet_status_t read_ranges_async(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* merged,
+    int32_t num_merged,
+    uint8_t* buffer,
+    carquet_error_t* error) {
+
+    async_read_batch_t batch;
+    carquet_mutex_init(&batch.mutex);
+    carquet_cond_init(&batch.cond);
+    batch.pending = 0;
+    batch.status = CARQUET_OK;
+
+    for (int32_t i = 0; i < num_merged; i++) {
+        /* Count the read before starting it: the callback may run inline */
+        carquet_mutex_lock(&batch.mutex);
+        batch.pending++;
+        carquet_mutex_unlock(&batch.mutex);
+
+        carquet_status_t status = reader->source.read_at_async(
+            reader->source.ctx, merged[i].offset,
+            buffer + merged[i].buffer_offset, (size_t)merged[i].length,
+            async_read_done, &batch);
+        if (status != CARQUET_OK) {
+            carquet_mutex_lock(&batch.mutex);
+            batch.pending--;
+            if (batch.status == CARQUET_OK) {
+                batch.status = status;
+            }
+            carquet_mutex_unlock(&batch.mutex);
+            break;
+        }
+    }
+
+    /* Wait for every started read, even after a failure: they write into
+     * buffer */
+    carquet_mutex_lock(&batch.mutex);
+    while (batch.pending > 0) {
+        carquet_cond_wait(&batch.cond, &batch.mutex);
+    }
+    carquet_status_t status = batch.status;
+    carquet_mutex_unlock(&batch.mutex);
+
+    carquet_mutex_destroy(&batch.mutex);
+    carquet_cond_destroy(&batch.cond);
+
+    if (status != CARQUET_OK) {
+        CARQUET_SET_ERROR(error, status, "Input source failed to read column chunks");
+    }
+    return status;
+}
+
+carquet_status_t carquet_io_read_ranges(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* merged,
+    int32_t num_merged,
+    uint8_t* buffer,
+    carquet_error_t* error) {
+
+    if (reader->has_source && reader->source.read_at_async && num_merged > 1) {
+        return read_ranges_async(reader, merged, num_merged, buffer, error);
+    }
+    if (reader->use_io_uring) {
+        return carquet_uring_read_ranges(reader, merged, num_merged, buffer, error);
+    }
+    return carquet_io_read_ranges_pread(reader, merged, num_merged, buffer, error);
+}
+
+carquet_status_t carquet_io_read_ranges_pread(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* merged,
+    int32_t num_merged,
+    uint8_t* buffer,
+    carquet_error_t* error) {
+
+    for (int32_t i = 0; i < num_merged; i++) {
+        carquet_status_t status = carquet_io_read_at(
+            reader, merged[i].offset, (size_t)merged[i].length,
+            buffer + merged[i].buffer_offset, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Column Reader Chunk Buffers
+ * ============================================================================
+ */
+
+void carquet_column_reader_attach_chunk(
+    carquet_column_reader_t* reader,
+    const uint8_t* data,
+    int64_t offset,
+    int64_t length) {
+
+    reader->chunk_data = data;
+    reader->chunk_offset = offset;
+    reader->chunk_length = length;
+}
+
+carquet_status_t carquet_column_reader_fetch_chunk(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error) {
+
+    if (reader->chunk_data) {
+        return CARQUET_OK;
+    }
+
+    int64_t offset, length;
+    if (!carquet_io_chunk_range(reader->file_reader, reader->col_meta, &offset, &length)) {
+        /* Unusable chunk metadata: the page loader falls back to per-page reads */
+        return CARQUET_OK;
+    }
+
+    if ((size_t)length > reader->chunk_buffer_capacity) {
+        uint8_t* buf = realloc(reader->chunk_buffer, (size_t)length);
+        if (!buf) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY,
+                "Failed to allocate column chunk buffer");
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+        reader->chunk_buffer = buf;
+        reader->chunk_buffer_capacity = (size_t)length;
+    }
+
+    carquet_io_range_t range = { offset, length, 0 };
+    carquet_status_t status = carquet_io_read_ranges(
+        reader->file_reader, &range, 1, reader->chunk_buffer, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    carquet_column_reader_attach_chunk(reader, reader->chunk_buffer, offset, length);
+    return CARQUET_OK;
+}
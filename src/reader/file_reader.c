@@ -15,6 +15,13 @@
 #include <string.h>
 #include <stdio.h>
 
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+/* From metadata/bloom_filter.c */
+extern void carquet_bloom_filter_destroy(carquet_bloom_filter_t* filter);
+
 /* ============================================================================
  * Constants
  * ============================================================================
@@ -194,6 +201,139 @@ carquet_schema_t* build_schema(
     return schema;
 }
 
+/* ============================================================================
+ * Metadata Cache
+ * ============================================================================
+ */
+
+/**
+ * Modification time of the open file in nanoseconds.
+ */
+static bool file_mtime(const carquet_reader_t* reader, int64_t* mtime) {
+#ifdef _WIN32
+    HANDLE handle = reader->mmap_info ? reader->mmap_info->file_handle : reader->file_handle;
+    FILETIME ft;
+    if (!GetFileTime(handle, NULL, NULL, &ft)) {
+        return false;
+    }
+    uint64_t ticks = ((uint64_t)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+    *mtime = (int64_t)(ticks * 100);  /* 100 ns units */
+#else
+    int fd = reader->mmap_info ? reader->mmap_info->fd : reader->fd;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return false;
+    }
+#ifdef __APPLE__
+    *mtime = (int64_t)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    *mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+#endif
+    return true;
+}
+
+const carquet_metadata_key_t* carquet_reader_cache_key(
+    const carquet_reader_t* reader,
+    const char* path,
+    carquet_metadata_key_t* key) {
+
+    if (!reader->options.metadata_cache) {
+        return NULL;
+    }
+
+    key->size = (int64_t)reader->file_size;
+    key->mtime = 0;
+
+    if (reader->options.metadata_cache_key) {
+        key->name = reader->options.metadata_cache_key;
+        return key;
+    }
+
+    /* Without a caller key only files opened by path can be identified */
+    if (!path || !file_mtime(reader, &key->mtime)) {
+        return NULL;
+    }
+    key->name = path;
+    return key;
+}
+
+bool carquet_reader_use_cached_footer(
+    carquet_reader_t* reader,
+    const carquet_metadata_key_t* key) {
+
+    if (!key) {
+        return false;
+    }
+
+    carquet_metadata_entry_t* entry =
+        carquet_metadata_cache_lookup(reader->options.metadata_cache, key);
+    if (!entry) {
+        return false;
+    }
+
+    reader->metadata_entry = entry;
+    reader->metadata = entry->metadata;
+    reader->schema = entry->schema;
+    return true;
+}
+
+carquet_status_t carquet_reader_parse_footer(
+    carquet_reader_t* reader,
+    const carquet_metadata_key_t* key,
+    const uint8_t* footer_data,
+    size_t footer_size,
+    carquet_error_t* error) {
+
+    carquet_status_t status;
+
+    /* Lazy mode decodes column chunks only when a column is opened */
+    carquet_status_t (*parse)(const uint8_t*, size_t, carquet_arena_t*,
+                              parquet_file_metadata_t*, carquet_error_t*) =
+        reader->options.lazy_metadata ? parquet_parse_file_metadata_lazy
+                                      : parquet_parse_file_metadata;
+
+    if (!key) {
+        status = parse(footer_data, footer_size, &reader->arena, &reader->metadata, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+
+        reader->schema = build_schema(&reader->arena, &reader->metadata, error);
+        if (!reader->schema) {
+            return CARQUET_ERROR_INVALID_SCHEMA;
+        }
+        return CARQUET_OK;
+    }
+
+    /* Parse into a cache entry of its own so other readers can share it */
+    carquet_metadata_entry_t* entry =
+        carquet_metadata_entry_create(reader->options.metadata_cache, key);
+    if (!entry) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate metadata cache entry");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    status = parse(footer_data, footer_size, &entry->arena, &entry->metadata, error);
+    if (status == CARQUET_OK) {
+        entry->schema = build_schema(&entry->arena, &entry->metadata, error);
+        if (!entry->schema) {
+            status = CARQUET_ERROR_INVALID_SCHEMA;
+        }
+    }
+    if (status != CARQUET_OK) {
+        carquet_metadata_entry_release(entry);
+        return status;
+    }
+
+    carquet_metadata_cache_insert(reader->options.metadata_cache, entry);
+
+    reader->metadata_entry = entry;
+    reader->metadata = entry->metadata;
+    reader->schema = entry->schema;
+    return CARQUET_OK;
+}
+
 /* ============================================================================
  * File Reader Implementation
  * ============================================================================
@@ -206,21 +346,17 @@ void carquet_reader_options_init(carquet_reader_options_t* options) {
     options->verify_checksums = true;
     options->buffer_size = 64 * 1024;
     options->num_threads = 0;
+    options->coalesce_gap = 1024 * 1024;
+    options->footer_read_size = 64 * 1024;
+    options->io_backend = CARQUET_IO_BACKEND_DEFAULT;
+    options->io_queue_depth = 32;
 }
 
-static carquet_status_t read_footer(carquet_reader_t* reader, carquet_error_t* error) {
-    /* Seek to end to get file size */
-    if (fseek(reader->file, 0, SEEK_END) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek to end");
-        return CARQUET_ERROR_FILE_SEEK;
-    }
-
-    long file_size = ftell(reader->file);
-    if (file_size < 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to get file size");
-        return CARQUET_ERROR_FILE_READ;
-    }
-    reader->file_size = (size_t)file_size;
+static carquet_status_t read_footer(carquet_reader_t* reader,
+                                    const carquet_metadata_key_t* key,
+                                    carquet_error_t* error) {
+    /* File size was recorded by carquet_io_init() */
+    carquet_status_t status;
 
     /* Check minimum size */
     if (reader->file_size < PARQUET_MAGIC_LEN * 2 + PARQUET_FOOTER_SIZE_LEN) {
@@ -228,20 +364,38 @@ static carquet_status_t read_footer(carquet_reader_t* reader, carquet_error_t* e
         return CARQUET_ERROR_INVALID_FOOTER;
     }
 
-    /* Read trailing magic and footer size */
-    uint8_t footer_tail[8];
-    if (fseek(reader->file, -8, SEEK_END) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek to footer");
-        return CARQUET_ERROR_FILE_SEEK;
+    if (carquet_reader_use_cached_footer(reader, key)) {
+        return CARQUET_OK;
+    }
+
+    /* Speculatively read the tail of the file in one request: for most
+     * files it holds the whole footer, so opening costs a single read. */
+    size_t tail_size = reader->options.footer_read_size;
+    if (tail_size < 8) {
+        tail_size = 8;
+    }
+    if (tail_size > reader->file_size) {
+        tail_size = reader->file_size;
     }
 
-    if (fread(footer_tail, 1, 8, reader->file) != 8) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read footer tail");
-        return CARQUET_ERROR_FILE_READ;
+    uint8_t* tail = malloc(tail_size);
+    if (!tail) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate footer buffer");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    int64_t tail_offset = (int64_t)(reader->file_size - tail_size);
+    status = carquet_io_read_at(reader, tail_offset, tail_size, tail, error);
+    if (status != CARQUET_OK) {
+        free(tail);
+        CARQUET_SET_ERROR(error, status, "Failed to read footer tail");
+        return status;
     }
 
     /* Verify magic */
+    const uint8_t* footer_tail = tail + tail_size - 8;
     if (memcmp(footer_tail + 4, PARQUET_MAGIC, PARQUET_MAGIC_LEN) != 0) {
+        free(tail);
         CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_MAGIC, "Invalid trailing magic");
         return CARQUET_ERROR_INVALID_MAGIC;
     }
@@ -249,53 +403,54 @@ static carquet_status_t read_footer(carquet_reader_t* reader, carquet_error_t* e
     /* Get footer size */
     uint32_t footer_size = carquet_read_u32_le(footer_tail);
     if (footer_size > reader->file_size - 8) {
+        free(tail);
         CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_FOOTER, "Footer size too large");
         return CARQUET_ERROR_INVALID_FOOTER;
     }
 
-    /* Read footer (Thrift-encoded metadata) */
-    uint8_t* footer_data = malloc(footer_size);
-    if (!footer_data) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate footer buffer");
-        return CARQUET_ERROR_OUT_OF_MEMORY;
-    }
-
-    long footer_offset = (long)(reader->file_size - 8 - footer_size);
-    if (fseek(reader->file, footer_offset, SEEK_SET) != 0) {
-        free(footer_data);
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek to footer data");
-        return CARQUET_ERROR_FILE_SEEK;
-    }
-
-    if (fread(footer_data, 1, footer_size, reader->file) != footer_size) {
-        free(footer_data);
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read footer data");
-        return CARQUET_ERROR_FILE_READ;
-    }
-
-    /* Parse metadata */
-    carquet_status_t status = parquet_parse_file_metadata(
-        footer_data, footer_size, &reader->arena, &reader->metadata, error);
+    /* Footer (Thrift-encoded metadata) straight from the tail if it fits,
+     * otherwise read only the missing front part */
+    const uint8_t* footer_data;
+    uint8_t* footer_buffer = NULL;
+    size_t in_tail = tail_size - 8;
 
-    free(footer_data);
+    if (footer_size <= in_tail) {
+        footer_data = footer_tail - footer_size;
+    } else {
+        footer_buffer = malloc(footer_size);
+        if (!footer_buffer) {
+            free(tail);
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate footer buffer");
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
 
-    if (status != CARQUET_OK) {
-        return status;
+        size_t missing = footer_size - in_tail;
+        int64_t footer_offset = (int64_t)(reader->file_size - 8 - footer_size);
+        status = carquet_io_read_at(reader, footer_offset, missing, footer_buffer, error);
+        if (status != CARQUET_OK) {
+            free(footer_buffer);
+            free(tail);
+            CARQUET_SET_ERROR(error, status, "Failed to read footer data");
+            return status;
+        }
+        memcpy(footer_buffer + missing, tail, in_tail);
+        footer_data = footer_buffer;
     }
 
-    /* Build schema */
-    reader->schema = build_schema(&reader->arena, &reader->metadata, error);
-    if (!reader->schema) {
-        return CARQUET_ERROR_INVALID_SCHEMA;
-    }
+    /* Parse metadata and build schema */
+    status = carquet_reader_parse_footer(reader, key, footer_data, footer_size, error);
 
-    return CARQUET_OK;
+    free(footer_buffer);
+    free(tail);
+    return status;
 }
 
 /**
  * Read footer from memory-mapped data.
  */
-static carquet_status_t read_footer_mmap(carquet_reader_t* reader, carquet_error_t* error) {
+static carquet_status_t read_footer_mmap(carquet_reader_t* reader,
+                                         const carquet_metadata_key_t* key,
+                                         carquet_error_t* error) {
     const uint8_t* data = reader->mmap_data;
     size_t file_size = reader->file_size;
 
@@ -305,6 +460,10 @@ static carquet_status_t read_footer_mmap(carquet_reader_t* reader, carquet_error
         return CARQUET_ERROR_INVALID_FOOTER;
     }
 
+    if (carquet_reader_use_cached_footer(reader, key)) {
+        return CARQUET_OK;
+    }
+
     /* Verify magic bytes at start and end */
     if (memcmp(data, PARQUET_MAGIC, PARQUET_MAGIC_LEN) != 0) {
         CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_MAGIC, "Invalid header magic");
@@ -326,24 +485,10 @@ static carquet_status_t read_footer_mmap(carquet_reader_t* reader, carquet_error
 
     /* Parse metadata directly from mmap (zero-copy) */
     const uint8_t* footer_data = end - 8 - footer_size;
-    carquet_status_t status = parquet_parse_file_metadata(
-        footer_data, footer_size, &reader->arena, &reader->metadata, error);
-
-    if (status != CARQUET_OK) {
-        return status;
-    }
-
-    /* Build schema */
-    reader->schema = build_schema(&reader->arena, &reader->metadata, error);
-    if (!reader->schema) {
-        return CARQUET_ERROR_INVALID_SCHEMA;
-    }
-
-    return CARQUET_OK;
+    return carquet_reader_parse_footer(reader, key, footer_data, footer_size, error);
 }
 
-carquet_reader_t* carquet_reader_open(
-    const char* path,
+static carquet_reader_t* alloc_reader(
     const carquet_reader_options_t* options,
     carquet_error_t* error) {
 
@@ -366,19 +511,38 @@ carquet_reader_t* carquet_reader_open(
         return NULL;
     }
 
+    return reader;
+}
+
+carquet_reader_t* carquet_reader_open(
+    const char* path,
+    const carquet_reader_options_t* options,
+    carquet_error_t* error) {
+
+    carquet_reader_t* reader = alloc_reader(options, error);
+    if (!reader) {
+        return NULL;
+    }
+
     carquet_status_t status;
 
+    /* io_uring replaces mmap when requested and usable */
+    bool use_io_uring = reader->options.io_backend == CARQUET_IO_BACKEND_IO_URING &&
+                        carquet_uring_available();
+
     /* Try mmap if requested */
-    if (reader->options.use_mmap) {
+    if (reader->options.use_mmap && !use_io_uring) {
         carquet_mmap_info_t* mmap_info = carquet_mmap_open(path, error);
         if (mmap_info) {
+            mmap_info->max_resident = reader->options.mmap_max_resident;
             reader->mmap_info = mmap_info;
             reader->mmap_data = mmap_info->data;
             reader->file_size = mmap_info->size;
             reader->owns_file = false;  /* mmap handles cleanup */
 
             /* Parse footer from mmap */
-            status = read_footer_mmap(reader, error);
+            carquet_metadata_key_t key;
+            status = read_footer_mmap(reader, carquet_reader_cache_key(reader, path, &key), error);
             if (status != CARQUET_OK) {
                 carquet_mmap_close(reader->mmap_info);
                 carquet_arena_destroy(&reader->arena);
@@ -386,13 +550,14 @@ carquet_reader_t* carquet_reader_open(
                 return NULL;
             }
 
+            carquet_mutex_init(&reader->bloom_mutex);
             reader->is_open = true;
             return reader;
         }
-        /* mmap failed, fall through to fread path */
+        /* mmap failed, fall through to positional-read path */
     }
 
-    /* Standard fread path */
+    /* Standard positional-read (pread) path */
     FILE* file = fopen(path, "rb");
     if (!file) {
         carquet_arena_destroy(&reader->arena);
@@ -403,9 +568,14 @@ carquet_reader_t* carquet_reader_open(
 
     reader->file = file;
     reader->owns_file = true;
+    reader->use_io_uring = use_io_uring;
 
-    /* Read and parse footer */
-    status = read_footer(reader, error);
+    /* Bind positional I/O and read/parse footer */
+    status = carquet_io_init(reader, file, error);
+    if (status == CARQUET_OK) {
+        carquet_metadata_key_t key;
+        status = read_footer(reader, carquet_reader_cache_key(reader, path, &key), error);
+    }
     if (status != CARQUET_OK) {
         carquet_arena_destroy(&reader->arena);
         fclose(file);
@@ -413,6 +583,72 @@ carquet_reader_t* carquet_reader_open(
         return NULL;
     }
 
+    carquet_mutex_init(&reader->bloom_mutex);
+    reader->is_open = true;
+    return reader;
+}
+
+carquet_reader_t* carquet_reader_open_file(
+    FILE* file,
+    const carquet_reader_options_t* options,
+    carquet_error_t* error) {
+
+    /* file is nonnull per API contract */
+    carquet_reader_t* reader = alloc_reader(options, error);
+    if (!reader) {
+        return NULL;
+    }
+
+    reader->file = file;
+    reader->owns_file = false;  /* Caller closes the FILE */
+    reader->use_io_uring = reader->options.io_backend == CARQUET_IO_BACKEND_IO_URING &&
+                           carquet_uring_available();
+
+    carquet_status_t status = carquet_io_init(reader, file, error);
+    if (status == CARQUET_OK) {
+        carquet_metadata_key_t key;
+        status = read_footer(reader, carquet_reader_cache_key(reader, NULL, &key), error);
+    }
+    if (status != CARQUET_OK) {
+        carquet_arena_destroy(&reader->arena);
+        free(reader);
+        return NULL;
+    }
+
+    carquet_mutex_init(&reader->bloom_mutex);
+    reader->is_open = true;
+    return reader;
+}
+
+carquet_reader_t* carquet_reader_open_source(
+    const carquet_input_source_t* source,
+    const carquet_reader_options_t* options,
+    carquet_error_t* error) {
+
+    /* source is nonnull per API contract */
+    carquet_reader_t* reader = alloc_reader(options, error);
+    if (!reader) {
+        if (source->release) {
+            source->release(source->ctx);
+        }
+        return NULL;
+    }
+
+    carquet_status_t status = carquet_io_init_source(reader, source, error);
+    if (status == CARQUET_OK) {
+        carquet_metadata_key_t key;
+        status = read_footer(reader, carquet_reader_cache_key(reader, NULL, &key), error);
+    }
+    if (status != CARQUET_OK) {
+        if (source->release) {
+            source->release(source->ctx);
+        }
+        carquet_arena_destroy(&reader->arena);
+        free(reader);
+        return NULL;
+    }
+
+    carquet_mutex_init(&reader->bloom_mutex);
     reader->is_open = true;
     return reader;
 }
@@ -431,6 +667,26 @@ void carquet_reader_close(carquet_reader_t* reader) {
         fclose(reader->file);
     }
 
+    if (reader->has_source && reader->source.release) {
+        reader->source.release(reader->source.ctx);
+    }
+
+    if (reader->bloom_filters) {
+        int64_t slots = (int64_t)reader->metadata.num_row_groups * reader->schema->num_leaves;
+        for (int64_t i = 0; i < slots; i++) {
+            carquet_bloom_filter_destroy(reader->bloom_filters[i]);
+        }
+        free(reader->bloom_filters);
+        free(reader->bloom_loaded);
+    }
+    carquet_mutex_destroy(&reader->bloom_mutex);
+
+    if (reader->metadata_entry) {
+        carquet_metadata_entry_release(reader->metadata_entry);
+    } else {
+        parquet_file_metadata_free(&reader->metadata);
+    }
+
     carquet_arena_destroy(&reader->arena);
     free(reader);
 }
@@ -516,7 +772,12 @@ carquet_column_reader_t* carquet_reader_get_column(
     col_reader->file_reader = reader;
     col_reader->row_group_index = row_group_index;
     col_reader->column_index = column_index;
-    col_reader->chunk = &rg->columns[column_index];
+    col_reader->chunk = parquet_row_group_column(&reader->metadata, row_group_index,
+                                                 column_index, error);
+    if (!col_reader->chunk) {
+        free(col_reader);
+        return NULL;
+    }
 
     if (col_reader->chunk->has_metadata) {
         col_reader->col_meta = &col_reader->chunk->metadata;
@@ -546,10 +807,17 @@ carquet_column_reader_t* carquet_reader_get_column(
 void carquet_column_reader_free(carquet_column_reader_t* reader) {
     if (!reader) return;
 
+    carquet_mmap_chunk_end(reader);
+    free(reader->chunk_buffer);
     free(reader->page_buffer);
     free(reader->page_data_for_values);
+    carquet_column_reader_release_batch(reader);
+    free(reader->retired_buffers);
+    free(reader->string_offsets);
+    free(reader->string_buffer);
     free(reader->dictionary_data);
     free(reader->dictionary_offsets);
+    free(reader->dictionary_values);
 
     /* Only free decoded_values if we own the memory (not a mmap view) */
     if (reader->decoded_ownership == CARQUET_DATA_OWNED) {
@@ -558,8 +826,12 @@ void carquet_column_reader_free(carquet_column_reader_t* reader) {
 
     /* Levels are always owned (decoded from RLE) */
     free(reader->decoded_def_levels);
+    free(reader->decoded_validity);
     free(reader->decoded_rep_levels);
     free(reader->indices_buffer);
+    if (reader->offset_index_loaded) {
+        carquet_arena_destroy(&reader->page_index_arena);
+    }
     free(reader);
 }
 
@@ -583,6 +855,11 @@ bool carquet_reader_is_mmap(const carquet_reader_t* reader) {
     return reader->mmap_info != NULL && reader->mmap_info->is_valid;
 }
 
+bool carquet_reader_is_io_uring(const carquet_reader_t* reader) {
+    /* reader is nonnull per API contract */
+    return reader->use_io_uring;
+}
+
 bool carquet_reader_can_zero_copy(
     const carquet_reader_t* reader,
     int32_t row_group_index,
@@ -608,8 +885,9 @@ bool carquet_reader_can_zero_copy(
         return false;
     }
 
-    const parquet_column_chunk_t* chunk = &rg->columns[column_index];
-    if (!chunk->has_metadata) {
+    const parquet_column_chunk_t* chunk =
+        parquet_row_group_column(&reader->metadata, row_group_index, column_index, NULL);
+    if (!chunk || !chunk->has_metadata) {
         return false;
     }
 
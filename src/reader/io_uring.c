@@ -0,0 +1,420 @@
+/**
+ * @file io_uring.c
+ * @brief io_uring read engine for the non-mmap read path (Linux)
+ *
+ * Used when carquet_reader_options_t.io_backend is CARQUET_IO_BACKEND_IO_URING.
+ * The reads of a coalesced range plan are split into fixed-size segments and
+ * kept in flight up to the configured queue depth; completions are reaped as
+ * they arrive and the freed slots are refilled immediately, so an NVMe device
+ * sees many outstanding requests instead of one blocking pread at a time.
+ *
+ * The kernel interface is driven through raw syscalls (no liburing
+ * dependency). Each thread gets its own ring, created on first use and
+ * closed when the thread exits, so column readers and the batch reader's
+ * read-ahead thread never share submission state.
+ */
+
+#include <carquet/carquet.h>
+#include "reader_internal.h"
+
+#ifdef CARQUET_HAVE_IO_URING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Submission queue entries per ring; bounds the usable queue depth */
+#define CARQUET_URING_ENTRIES 128
+
+/* Maximum bytes per read request */
+#define CARQUET_URING_SEGMENT_SIZE (1024 * 1024)
+
+/* ============================================================================
+ * Ring Setup
+ * ============================================================================
+ */
+
+typedef struct carquet_uring {
+    int ring_fd;
+
+    /* Submission queue */
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    struct io_uring_sqe* sqes;
+    unsigned sq_entries;
+
+    /* Completion queue */
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+
+    /* Mappings */
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} carquet_uring_t;
+
+static void uring_destroy(carquet_uring_t* ring) {
+    if (ring->sqes && ring->sqes != MAP_FAILED) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring && ring->sq_ring != MAP_FAILED) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+    if (ring->ring_fd >= 0) {
+        close(ring->ring_fd);
+    }
+    free(ring);
+}
+
+/* Set once the kernel is known not to run this engine; every later read
+ * goes straight to pread instead of setting up a ring to find out again */
+static bool uring_unsupported = false;
+
+/* IORING_OP_READ arrived in Linux 5.6, after io_uring itself (5.1): on
+ * older kernels the ring sets up but every read fails with -EINVAL. The
+ * probe opcode is from 5.6 too, so a failed probe also means no read. */
+static bool uring_supports_read(int ring_fd) {
+    size_t size = sizeof(struct io_uring_probe) +
+                  IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = calloc(1, size);
+    if (!probe) {
+        return false;
+    }
+    long ret = syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE,
+                       probe, IORING_OP_LAST);
+    bool supported = ret == 0 && probe->last_op >= IORING_OP_READ &&
+                     (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return supported;
+}
+
+static carquet_uring_t* uring_create(unsigned entries) {
+    carquet_uring_t* ring = calloc(1, sizeof(carquet_uring_t));
+    if (!ring) {
+        return NULL;
+    }
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->ring_fd < 0) {
+        /* ENOSYS (old kernel) or EPERM (disabled by sysctl/seccomp) */
+        if (errno == ENOSYS || errno == EPERM) {
+            __atomic_store_n(&uring_unsupported, true, __ATOMIC_RELAXED);
+        }
+        free(ring);
+        return NULL;
+    }
+    if (!uring_supports_read(ring->ring_fd)) {
+        __atomic_store_n(&uring_unsupported, true, __ATOMIC_RELAXED);
+        uring_destroy(ring);
+        return NULL;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        uring_destroy(ring);
+        return NULL;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            uring_destroy(ring);
+            return NULL;
+        }
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        uring_destroy(ring);
+        return NULL;
+    }
+
+    uint8_t* sq = (uint8_t*)ring->sq_ring;
+    ring->sq_head = (unsigned*)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    ring->sq_entries = params.sq_entries;
+
+    uint8_t* cq = (uint8_t*)ring->cq_ring;
+    ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    return ring;
+}
+
+/* ============================================================================
+ * Per-Thread Rings
+ * ============================================================================
+ */
+
+static pthread_key_t tls_ring_key;
+static pthread_once_t tls_ring_once = PTHREAD_ONCE_INIT;
+static bool tls_ring_key_ok = false;
+
+static void destroy_tls_ring(void* ring) {
+    if (ring) {
+        uring_destroy((carquet_uring_t*)ring);
+    }
+}
+
+static void init_tls_ring_key(void) {
+    tls_ring_key_ok = pthread_key_create(&tls_ring_key, destroy_tls_ring) == 0;
+}
+
+static carquet_uring_t* get_ring(void) {
+    if (__atomic_load_n(&uring_unsupported, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    pthread_once(&tls_ring_once, init_tls_ring_key);
+    if (!tls_ring_key_ok) {
+        return NULL;
+    }
+
+    carquet_uring_t* ring = (carquet_uring_t*)pthread_getspecific(tls_ring_key);
+    if (!ring) {
+        ring = uring_create(CARQUET_URING_ENTRIES);
+        if (ring && pthread_setspecific(tls_ring_key, ring) != 0) {
+            uring_destroy(ring);
+            ring = NULL;
+        }
+    }
+    return ring;
+}
+
+bool carquet_uring_available(void) {
+    return get_ring() != NULL;
+}
+
+/* ============================================================================
+ * Reads
+ * ============================================================================
+ */
+
+typedef enum {
+    SEGMENT_FREE = 0,
+    SEGMENT_PENDING,    /* Filled in, not yet submitted (new or short read) */
+    SEGMENT_INFLIGHT,
+} segment_state_t;
+
+typedef struct {
+    segment_state_t state;
+    int64_t offset;
+    uint8_t* dest;
+    uint32_t length;
+} segment_t;
+
+static void queue_read(carquet_uring_t* ring, int fd, const segment_t* seg, uint64_t user_data) {
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = (uint64_t)seg->offset;
+    sqe->addr = (uint64_t)(uintptr_t)seg->dest;
+    sqe->len = seg->length;
+    sqe->user_data = user_data;
+
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+carquet_status_t carquet_uring_read_ranges(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* ranges,
+    int32_t count,
+    uint8_t* buffer,
+    carquet_error_t* error) {
+
+    carquet_uring_t* ring = get_ring();
+    if (!ring) {
+        return carquet_io_read_ranges_pread(reader, ranges, count, buffer, error);
+    }
+
+    int32_t depth = reader->options.io_queue_depth;
+    if (depth <= 0 || depth > (int32_t)ring->sq_entries) {
+        depth = (int32_t)ring->sq_entries;
+    }
+
+    segment_t segments[CARQUET_URING_ENTRIES];
+    memset(segments, 0, sizeof(segments));
+
+    /* Cursor over the not yet queued bytes of the plan */
+    int32_t range_idx = 0;
+    int64_t range_pos = 0;
+
+    int32_t inflight = 0;
+    bool ring_failed = false;
+    carquet_status_t status = CARQUET_OK;
+
+    for (;;) {
+        /* Fill the queue: resubmit short reads first, then new segments */
+        if (status == CARQUET_OK) {
+            for (int32_t s = 0; s < depth; s++) {
+                segment_t* seg = &segments[s];
+                if (seg->state == SEGMENT_FREE) {
+                    while (range_idx < count && range_pos >= ranges[range_idx].length) {
+                        range_idx++;
+                        range_pos = 0;
+                    }
+                    if (range_idx >= count) {
+                        continue;
+                    }
+                    const carquet_io_range_t* r = &ranges[range_idx];
+                    int64_t len = r->length - range_pos;
+                    if (len > CARQUET_URING_SEGMENT_SIZE) {
+                        len = CARQUET_URING_SEGMENT_SIZE;
+                    }
+                    seg->offset = r->offset + range_pos;
+                    seg->dest = buffer + r->buffer_offset + range_pos;
+                    seg->length = (uint32_t)len;
+                    seg->state = SEGMENT_PENDING;
+                    range_pos += len;
+                }
+                if (seg->state == SEGMENT_PENDING) {
+                    queue_read(ring, reader->fd, seg, (uint64_t)s);
+                    seg->state = SEGMENT_INFLIGHT;
+                    inflight++;
+                }
+            }
+        }
+
+        if (inflight == 0) {
+            break;
+        }
+
+        /* Submit whatever the kernel has not consumed yet and wait for at
+         * least one completion */
+        unsigned to_submit = *ring->sq_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        long ret = syscall(__NR_io_uring_enter, ring->ring_fd, to_submit, 1,
+                           IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            int err = errno;
+            if (ring_failed) {
+                /* Not even waiting works. Closing the ring cancels what is
+                 * left; nothing better can be done for the buffers. */
+                pthread_setspecific(tls_ring_key, NULL);
+                uring_destroy(ring);
+                return status;
+            }
+
+            /* Reads already submitted still land in the caller's buffers,
+             * so stop submitting and wait for them before returning. A
+             * failed enter consumed none of the entries queued for it:
+             * take them back, they will never complete. */
+            ring_failed = true;
+            unsigned sq_head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+            inflight -= (int32_t)(*ring->sq_tail - sq_head);
+            __atomic_store_n(ring->sq_tail, sq_head, __ATOMIC_RELEASE);
+            if (status == CARQUET_OK) {
+                status = CARQUET_ERROR_FILE_READ;
+                CARQUET_SET_ERROR(error, status, "io_uring_enter failed: %s", strerror(err));
+            }
+        }
+
+        /* Reap completions */
+        unsigned head = *ring->cq_head;
+        unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            const struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+            segment_t* seg = &segments[cqe->user_data];
+            int32_t res = cqe->res;
+            head++;
+            inflight--;
+
+            if (res == -EINTR || res == -EAGAIN) {
+                seg->state = SEGMENT_PENDING;
+            } else if (res < 0) {
+                seg->state = SEGMENT_FREE;
+                if (status == CARQUET_OK) {
+                    status = CARQUET_ERROR_FILE_READ;
+                    CARQUET_SET_ERROR(error, status,
+                        "Failed to read %u bytes at offset %lld: %s",
+                        seg->length, (long long)seg->offset, strerror(-res));
+                }
+            } else if (res == 0) {
+                seg->state = SEGMENT_FREE;
+                if (status == CARQUET_OK) {
+                    status = CARQUET_ERROR_FILE_TRUNCATED;
+                    CARQUET_SET_ERROR(error, status,
+                        "Unexpected end of file at offset %lld", (long long)seg->offset);
+                }
+            } else if ((uint32_t)res < seg->length) {
+                /* Short read: queue the remainder */
+                seg->offset += res;
+                seg->dest += res;
+                seg->length -= (uint32_t)res;
+                seg->state = SEGMENT_PENDING;
+            } else {
+                seg->state = SEGMENT_FREE;
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+        /* After an error only drain what is already in flight */
+        if (status != CARQUET_OK && inflight == 0) {
+            break;
+        }
+    }
+
+    /* Nothing is in flight any more: drop the broken ring, the next read
+     * on this thread sets up a fresh one */
+    if (ring_failed) {
+        pthread_setspecific(tls_ring_key, NULL);
+        uring_destroy(ring);
+    }
+    return status;
+}
+
+#else /* !CARQUET_HAVE_IO_URING */
+
+bool carquet_uring_available(void) {
+    return false;
+}
+
+carquet_status_t carquet_uring_read_ranges(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* ranges,
+    int32_t count,
+    uint8_t* buffer,
+    carquet_error_t* error) {
+
+    return carquet_io_read_ranges_pread(reader, ranges, count, buffer, error);
+}
+
+#endif /* CARQUET_HAVE_IO_URING */
@@ -0,0 +1,391 @@
+/**
+ * @file metadata_cache.c
+ * @brief Shared LRU cache of parsed file footers
+ *
+ * Entries are keyed by name (path or caller key), file size and
+ * modification time, and hold the parsed parquet_file_metadata_t plus the
+ * schema built from it in their own arena. Readers take a reference for
+ * their lifetime instead of decoding the footer again. An entry that is
+ * evicted or replaced while readers still hold it is unlinked from the
+ * index and freed by the last carquet_metadata_entry_release().
+ *
+ * Lazy entries keep decoding column chunks into their arena after insert;
+ * that growth is charged to the entry as it happens, evicting cold entries
+ * to stay within the limit.
+ */
+
+#include <carquet/carquet.h>
+#include "reader_internal.h"
+#include "core/thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* From util/xxhash.c */
+extern uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
+
+#define CACHE_INITIAL_BUCKETS 64
+
+struct carquet_metadata_cache {
+    carquet_mutex_t mutex;
+    size_t max_bytes;
+    size_t bytes;
+
+    /* Hash index (chained) */
+    carquet_metadata_entry_t** buckets;
+    size_t num_buckets;
+    int64_t num_entries;
+
+    /* Recency list: head is most recently used */
+    carquet_metadata_entry_t* lru_head;
+    carquet_metadata_entry_t* lru_tail;
+
+    int64_t hits;
+    int64_t misses;
+    int64_t evictions;
+};
+
+/* ============================================================================
+ * Helpers (cache mutex held)
+ * ============================================================================
+ */
+
+static uint64_t key_hash(const carquet_metadata_key_t* key, size_t name_len) {
+    uint64_t seed = (uint64_t)key->size * 0x9E3779B97F4A7C15ULL ^ (uint64_t)key->mtime;
+    return carquet_xxhash64(key->name, name_len, seed);
+}
+
+static bool key_matches(const carquet_metadata_entry_t* entry,
+                        const carquet_metadata_key_t* key,
+                        size_t name_len, uint64_t hash) {
+    return entry->hash == hash &&
+           entry->size == key->size &&
+           entry->mtime == key->mtime &&
+           entry->name_len == name_len &&
+           memcmp(entry->name, key->name, name_len) == 0;
+}
+
+static size_t entry_bytes(const carquet_metadata_entry_t* entry) {
+    return sizeof(*entry) + entry->name_len + 1 + carquet_arena_capacity(&entry->arena);
+}
+
+static void entry_free(carquet_metadata_entry_t* entry) {
+    parquet_file_metadata_free(&entry->metadata);
+    carquet_arena_destroy(&entry->arena);
+    free(entry->name);
+    free(entry);
+}
+
+static void lru_unlink(carquet_metadata_cache_t* cache, carquet_metadata_entry_t* entry) {
+    if (entry->lru_prev) {
+        entry->lru_prev->lru_next = entry->lru_next;
+    } else {
+        cache->lru_head = entry->lru_next;
+    }
+    if (entry->lru_next) {
+        entry->lru_next->lru_prev = entry->lru_prev;
+    } else {
+        cache->lru_tail = entry->lru_prev;
+    }
+    entry->lru_prev = NULL;
+    entry->lru_next = NULL;
+}
+
+static void lru_push_front(carquet_metadata_cache_t* cache, carquet_metadata_entry_t* entry) {
+    entry->lru_prev = NULL;
+    entry->lru_next = cache->lru_head;
+    if (cache->lru_head) {
+        cache->lru_head->lru_prev = entry;
+    } else {
+        cache->lru_tail = entry;
+    }
+    cache->lru_head = entry;
+}
+
+/**
+ * Remove an entry from the index and recency list. Returns true if nobody
+ * references it any more and the caller must free it (after unlocking).
+ */
+static bool cache_unlink(carquet_metadata_cache_t* cache, carquet_metadata_entry_t* entry) {
+    carquet_metadata_entry_t** link = &cache->buckets[entry->hash & (cache->num_buckets - 1)];
+    while (*link != entry) {
+        link = &(*link)->hash_next;
+    }
+    *link = entry->hash_next;
+    entry->hash_next = NULL;
+
+    lru_unlink(cache, entry);
+    cache->bytes -= entry->bytes;
+    cache->num_entries--;
+    entry->cached = false;
+    return entry->refcount == 0;
+}
+
+/**
+ * Evict from the cold end until incoming more bytes fit. Entries nobody
+ * references are chained onto unused for the caller to free.
+ */
+static void cache_evict(carquet_metadata_cache_t* cache, size_t incoming,
+                        carquet_metadata_entry_t** unused) {
+    while (cache->lru_tail && cache->bytes + incoming > cache->max_bytes) {
+        carquet_metadata_entry_t* victim = cache->lru_tail;
+        cache->evictions++;
+        if (cache_unlink(cache, victim)) {
+            victim->lru_next = *unused;
+            *unused = victim;
+        }
+    }
+}
+
+static void cache_grow(carquet_metadata_cache_t* cache) {
+    size_t new_count = cache->num_buckets * 2;
+    carquet_metadata_entry_t** buckets = calloc(new_count, sizeof(*buckets));
+    if (!buckets) {
+        return;  /* Keep the current table; chains just get longer */
+    }
+
+    for (size_t i = 0; i < cache->num_buckets; i++) {
+        carquet_metadata_entry_t* entry = cache->buckets[i];
+        while (entry) {
+            carquet_metadata_entry_t* next = entry->hash_next;
+            size_t slot = entry->hash & (new_count - 1);
+            entry->hash_next = buckets[slot];
+            buckets[slot] = entry;
+            entry = next;
+        }
+    }
+
+    free(cache->buckets);
+    cache->buckets = buckets;
+    cache->num_buckets = new_count;
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================
+ */
+
+carquet_metadata_cache_t* carquet_metadata_cache_create(
+    size_t max_bytes,
+    carquet_error_t* error) {
+
+    if (max_bytes == 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT,
+                          "Metadata cache size must be positive");
+        return NULL;
+    }
+
+    carquet_metadata_cache_t* cache = calloc(1, sizeof(carquet_metadata_cache_t));
+    if (!cache) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate metadata cache");
+        return NULL;
+    }
+
+    cache->buckets = calloc(CACHE_INITIAL_BUCKETS, sizeof(*cache->buckets));
+    if (!cache->buckets) {
+        free(cache);
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate metadata cache");
+        return NULL;
+    }
+
+    cache->num_buckets = CACHE_INITIAL_BUCKETS;
+    cache->max_bytes = max_bytes;
+    carquet_mutex_init(&cache->mutex);
+    return cache;
+}
+
+void carquet_metadata_cache_free(carquet_metadata_cache_t* cache) {
+    if (!cache) return;
+
+    /* Readers must be closed by now, so every entry is unreferenced */
+    carquet_metadata_entry_t* entry = cache->lru_head;
+    while (entry) {
+        carquet_metadata_entry_t* next = entry->lru_next;
+        entry_free(entry);
+        entry = next;
+    }
+
+    carquet_mutex_destroy(&cache->mutex);
+    free(cache->buckets);
+    free(cache);
+}
+
+void carquet_metadata_cache_clear(carquet_metadata_cache_t* cache) {
+    carquet_metadata_entry_t* unused = NULL;
+
+    carquet_mutex_lock(&cache->mutex);
+    while (cache->lru_head) {
+        carquet_metadata_entry_t* entry = cache->lru_head;
+        if (cache_unlink(cache, entry)) {
+            entry->lru_next = unused;
+            unused = entry;
+        }
+    }
+    carquet_mutex_unlock(&cache->mutex);
+
+    while (unused) {
+        carquet_metadata_entry_t* next = unused->lru_next;
+        entry_free(unused);
+        unused = next;
+    }
+}
+
+void carquet_metadata_cache_get_stats(
+    carquet_metadata_cache_t* cache,
+    carquet_metadata_cache_stats_t* stats) {
+
+    carquet_mutex_lock(&cache->mutex);
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->evictions = cache->evictions;
+    stats->entries = cache->num_entries;
+    stats->bytes = cache->bytes;
+    carquet_mutex_unlock(&cache->mutex);
+}
+
+/* ============================================================================
+ * Reader Interface
+ * ============================================================================
+ */
+
+carquet_metadata_entry_t* carquet_metadata_cache_lookup(
+    carquet_metadata_cache_t* cache,
+    const carquet_metadata_key_t* key) {
+
+    size_t name_len = strlen(key->name);
+    uint64_t hash = key_hash(key, name_len);
+
+    carquet_mutex_lock(&cache->mutex);
+    carquet_metadata_entry_t* entry = cache->buckets[hash & (cache->num_buckets - 1)];
+    while (entry && !key_matches(entry, key, name_len, hash)) {
+        entry = entry->hash_next;
+    }
+
+    if (entry) {
+        entry->refcount++;
+        lru_unlink(cache, entry);
+        lru_push_front(cache, entry);
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+    carquet_mutex_unlock(&cache->mutex);
+
+    return entry;
+}
+
+carquet_metadata_entry_t* carquet_metadata_entry_create(
+    carquet_metadata_cache_t* cache,
+    const carquet_metadata_key_t* key) {
+
+    carquet_metadata_entry_t* entry = calloc(1, sizeof(carquet_metadata_entry_t));
+    if (!entry) {
+        return NULL;
+    }
+
+    entry->name_len = strlen(key->name);
+    entry->name = malloc(entry->name_len + 1);
+    if (!entry->name || carquet_arena_init(&entry->arena) != CARQUET_OK) {
+        free(entry->name);
+        free(entry);
+        return NULL;
+    }
+    memcpy(entry->name, key->name, entry->name_len + 1);
+
+    entry->cache = cache;
+    entry->size = key->size;
+    entry->mtime = key->mtime;
+    entry->hash = key_hash(key, entry->name_len);
+    entry->refcount = 1;
+    return entry;
+}
+
+/**
+ * Lazy footer callback: charge chunks decoded after insert to the entry.
+ * Called with the entry's lazy footer lock held, which guards its arena.
+ */
+static void entry_grown(void* ctx) {
+    carquet_metadata_entry_t* entry = ctx;
+    carquet_metadata_cache_t* cache = entry->cache;
+    carquet_metadata_entry_t* unused = NULL;
+
+    carquet_mutex_lock(&cache->mutex);
+    size_t bytes = entry_bytes(entry);
+    if (entry->cached) {
+        cache->bytes = cache->bytes - entry->bytes + bytes;
+    }
+    entry->bytes = bytes;
+    cache_evict(cache, 0, &unused);
+    carquet_mutex_unlock(&cache->mutex);
+
+    while (unused) {
+        carquet_metadata_entry_t* next = unused->lru_next;
+        entry_free(unused);
+        unused = next;
+    }
+}
+
+void carquet_metadata_cache_insert(
+    carquet_metadata_cache_t* cache,
+    carquet_metadata_entry_t* entry) {
+
+    entry->bytes = entry_bytes(entry);
+    if (entry->bytes > cache->max_bytes) {
+        return;  /* Never fits; the reader keeps it to itself */
+    }
+
+    carquet_metadata_entry_t* unused = NULL;
+
+    carquet_mutex_lock(&cache->mutex);
+
+    /* A concurrent open of the same file may have inserted it first */
+    carquet_metadata_key_t key = { entry->name, entry->size, entry->mtime };
+    carquet_metadata_entry_t* old = cache->buckets[entry->hash & (cache->num_buckets - 1)];
+    while (old && !key_matches(old, &key, entry->name_len, entry->hash)) {
+        old = old->hash_next;
+    }
+    if (old && cache_unlink(cache, old)) {
+        old->lru_next = unused;
+        unused = old;
+    }
+
+    cache_evict(cache, entry->bytes, &unused);
+
+    if ((size_t)cache->num_entries >= cache->num_buckets) {
+        cache_grow(cache);
+    }
+
+    size_t slot = entry->hash & (cache->num_buckets - 1);
+    entry->hash_next = cache->buckets[slot];
+    cache->buckets[slot] = entry;
+    lru_push_front(cache, entry);
+    cache->bytes += entry->bytes;
+    cache->num_entries++;
+    entry->cached = true;
+
+    /* Set before unlocking: other readers only reach the entry through a
+     * lookup, and this reader has not decoded any chunk yet */
+    if (entry->metadata.lazy) {
+        entry->metadata.lazy->on_grow = entry_grown;
+        entry->metadata.lazy->on_grow_ctx = entry;
+    }
+
+    carquet_mutex_unlock(&cache->mutex);
+
+    while (unused) {
+        carquet_metadata_entry_t* next = unused->lru_next;
+        entry_free(unused);
+        unused = next;
+    }
+}
+
+void carquet_metadata_entry_release(carquet_metadata_entry_t* entry) {
+    carquet_metadata_cache_t* cache = entry->cache;
+
+    carquet_mutex_lock(&cache->mutex);
+    bool unused = --entry->refcount == 0 && !entry->cached;
+    carquet_mutex_unlock(&cache->mutex);
+
+    if (unused) {
+        entry_free(entry);
+    }
+}
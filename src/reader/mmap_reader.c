@@ -91,6 +91,7 @@ carquet_mmap_info_t* carquet_mmap_open(const char* path, carquet_error_t* error)
         return NULL;
     }
 
+    carquet_mutex_init(&mmap_info->advice_mutex);
     mmap_info->is_valid = true;
     return mmap_info;
 }
@@ -107,6 +108,7 @@ void carquet_mmap_close(carquet_mmap_info_t* mmap_info) {
     if (mmap_info->file_handle != INVALID_HANDLE_VALUE) {
         CloseHandle(mmap_info->file_handle);
     }
+    carquet_mutex_destroy(&mmap_info->advice_mutex);
     mmap_info->is_valid = false;
     free(mmap_info);
 }
@@ -148,9 +150,12 @@ carquet_mmap_info_t* carquet_mmap_open(const char* path, carquet_error_t* error)
     }
 
     /* Advise the kernel about access pattern - use MADV_RANDOM for Parquet
-     * since we typically seek to specific column chunks rather than reading sequentially */
+     * since we typically seek to specific column chunks rather than reading
+     * sequentially. Chunks being scanned are switched to MADV_SEQUENTIAL by
+     * carquet_mmap_chunk_advance(). */
     madvise(mmap_info->data, mmap_info->size, MADV_RANDOM);
 
+    carquet_mutex_init(&mmap_info->advice_mutex);
     mmap_info->is_valid = true;
     return mmap_info;
 }
@@ -164,12 +169,166 @@ void carquet_mmap_close(carquet_mmap_info_t* mmap_info) {
     if (mmap_info->fd >= 0) {
         close(mmap_info->fd);
     }
+    carquet_mutex_destroy(&mmap_info->advice_mutex);
     mmap_info->is_valid = false;
     free(mmap_info);
 }
 
 #endif
 
+/* ============================================================================
+ * Column Chunk Residency
+ * ============================================================================
+ *
+ * A full scan of a large file through one MADV_RANDOM mapping gets no kernel
+ * readahead and keeps every touched page mapped until close. Instead each
+ * column reader keeps a window over its chunk: bytes ahead of the current
+ * page are advised MADV_SEQUENTIAL + MADV_WILLNEED, bytes behind it are
+ * dropped with MADV_DONTNEED. Dropped pages stay in the page cache and are
+ * faulted back in if touched again (e.g. through a zero-copy view), so this
+ * never affects correctness. With max_resident set, the windows of all
+ * column readers of the mapping together stay within that budget.
+ */
+
+/* Read-ahead window per column chunk without a residency cap */
+#define CARQUET_MMAP_WINDOW (64 * 1024 * 1024)
+
+/* Granularity of advice calls, to keep syscalls off the per-page path */
+#define CARQUET_MMAP_ADVICE_STEP (1024 * 1024)
+
+#ifndef _WIN32
+static size_t mmap_page_size(void) {
+    static size_t page_size = 0;
+    if (page_size == 0) {
+        long ps = sysconf(_SC_PAGESIZE);
+        page_size = ps > 0 ? (size_t)ps : 4096;
+    }
+    return page_size;
+}
+#endif
+
+/* Apply advice to [begin, end), rounded outwards (WILLNEED) or inwards
+ * (DONTNEED, so neighbouring chunks keep their partial pages) */
+static void mmap_advise(carquet_mmap_info_t* mmap_info, int64_t begin, int64_t end, bool release) {
+#ifdef _WIN32
+    /* No per-range advice used on Windows; the window is still tracked */
+    (void)mmap_info;
+    (void)begin;
+    (void)end;
+    (void)release;
+#else
+    int64_t page = (int64_t)mmap_page_size();
+    int64_t size = (int64_t)mmap_info->size;
+    if (release) {
+        begin = (begin + page - 1) / page * page;
+        end = end / page * page;
+    } else {
+        begin = begin / page * page;
+        end = (end + page - 1) / page * page;
+    }
+    if (end > size) end = size;
+    if (begin >= end) return;
+
+    uint8_t* addr = mmap_info->data + begin;
+    size_t len = (size_t)(end - begin);
+    if (release) {
+        madvise(addr, len, MADV_DONTNEED);
+    } else {
+        madvise(addr, len, MADV_SEQUENTIAL);
+        madvise(addr, len, MADV_WILLNEED);
+    }
+#endif
+}
+
+static void chunk_release_to(carquet_column_reader_t* reader, int64_t offset) {
+    carquet_mmap_info_t* mmap_info = reader->file_reader->mmap_info;
+    if (offset <= reader->mmap_released_end) {
+        return;
+    }
+
+    mmap_advise(mmap_info, reader->mmap_released_end, offset, true);
+
+    /* Only bytes inside the advised window were accounted for */
+    int64_t accounted_end = offset < reader->mmap_advised_end ? offset : reader->mmap_advised_end;
+    if (accounted_end > reader->mmap_released_end) {
+        carquet_mutex_lock(&mmap_info->advice_mutex);
+        mmap_info->resident -= accounted_end - reader->mmap_released_end;
+        carquet_mutex_unlock(&mmap_info->advice_mutex);
+    }
+    reader->mmap_released_end = offset;
+    if (reader->mmap_advised_end < offset) {
+        reader->mmap_advised_end = offset;
+    }
+}
+
+static void chunk_extend_window(carquet_column_reader_t* reader, int64_t offset) {
+    carquet_mmap_info_t* mmap_info = reader->file_reader->mmap_info;
+
+    /* Keep the window up to CARQUET_MMAP_WINDOW ahead of offset, topping it
+     * up in steps rather than on every page */
+    int64_t target = offset + CARQUET_MMAP_WINDOW;
+    if (target > reader->mmap_chunk_end) {
+        target = reader->mmap_chunk_end;
+    }
+
+    /* A window cut short by the budget can fall behind offset. Bytes in
+     * between were never charged, so settle the window up to offset first:
+     * what is charged stays exactly [mmap_released_end, mmap_advised_end) */
+    if (offset > reader->mmap_advised_end) {
+        chunk_release_to(reader, offset);
+    }
+    int64_t begin = reader->mmap_advised_end > offset ? reader->mmap_advised_end : offset;
+    if (target <= begin ||
+        (target - begin < CARQUET_MMAP_ADVICE_STEP && target < reader->mmap_chunk_end)) {
+        return;
+    }
+
+    int64_t want = target - begin;
+    carquet_mutex_lock(&mmap_info->advice_mutex);
+    if (mmap_info->max_resident > 0) {
+        int64_t budget = (int64_t)mmap_info->max_resident - mmap_info->resident;
+        if (want > budget) {
+            want = budget > 0 ? budget : 0;
+        }
+    }
+    mmap_info->resident += want;
+    carquet_mutex_unlock(&mmap_info->advice_mutex);
+
+    if (want > 0) {
+        mmap_advise(mmap_info, begin, begin + want, false);
+        reader->mmap_advised_end = begin + want;
+    }
+}
+
+void carquet_mmap_chunk_advance(carquet_column_reader_t* reader, int64_t page_offset) {
+    if (!reader->file_reader->mmap_info) {
+        return;  /* Caller-owned buffer: leave it alone */
+    }
+
+    if (reader->mmap_chunk_end == 0) {
+        int64_t offset, length;
+        if (!carquet_io_chunk_range(reader->file_reader, reader->col_meta, &offset, &length)) {
+            return;
+        }
+        reader->mmap_chunk_end = offset + length;
+        reader->mmap_advised_end = offset;
+        reader->mmap_released_end = offset;
+    }
+
+    if (page_offset - reader->mmap_released_end >= CARQUET_MMAP_ADVICE_STEP) {
+        chunk_release_to(reader, page_offset);
+    }
+    chunk_extend_window(reader, page_offset);
+}
+
+void carquet_mmap_chunk_end(carquet_column_reader_t* reader) {
+    if (!reader->file_reader->mmap_info || reader->mmap_chunk_end == 0) {
+        return;
+    }
+    chunk_release_to(reader, reader->mmap_chunk_end);
+    reader->mmap_chunk_end = 0;
+}
+
 /* ============================================================================
  * Public API for Memory-Mapped Reading
  * ============================================================================
@@ -328,25 +487,21 @@ carquet_reader_t* carquet_reader_open_buffer(
         return NULL;
     }
 
-    /* Parse footer */
-    const uint8_t* footer_data = end - 8 - footer_size;
-    carquet_status_t status = parquet_parse_file_metadata(
-        footer_data, footer_size, &reader->arena, &reader->metadata, error);
-
-    if (status != CARQUET_OK) {
-        carquet_arena_destroy(&reader->arena);
-        free(reader);
-        return NULL;
-    }
-
-    /* Build schema - declared in reader_internal.h */
-    reader->schema = build_schema(&reader->arena, &reader->metadata, error);
-    if (!reader->schema) {
-        carquet_arena_destroy(&reader->arena);
-        free(reader);
-        return NULL;
+    /* Parse footer and build schema, or share them from the metadata cache */
+    carquet_metadata_key_t key;
+    const carquet_metadata_key_t* cache_key = carquet_reader_cache_key(reader, NULL, &key);
+    if (!carquet_reader_use_cached_footer(reader, cache_key)) {
+        const uint8_t* footer_data = end - 8 - footer_size;
+        carquet_status_t status = carquet_reader_parse_footer(
+            reader, cache_key, footer_data, footer_size, error);
+        if (status != CARQUET_OK) {
+            carquet_arena_destroy(&reader->arena);
+            free(reader);
+            return NULL;
+        }
     }
 
+    carquet_mutex_init(&reader->bloom_mutex);
     reader->is_open = true;
     return reader;
 }
@@ -0,0 +1,487 @@
+/**
+ * @file nested_reader.c
+ * @brief Record-by-record reading and assembly of nested columns
+ *
+ * A nested reader stages each page of a leaf column before reading from it,
+ * so the page's repetition levels show where records start and a batch can
+ * end exactly on a record boundary. The entries of a batch are then turned
+ * into list offsets and validity bitmaps, one repeated level at a time, in
+ * a single pass over their levels, and the values of entries that carry an
+ * element are pulled together into the element slots.
+ */
+
+#include <carquet/carquet.h>
+#include "reader_internal.h"
+#include "thrift/parquet_types.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* From page_reader.c */
+extern carquet_status_t carquet_read_next_page(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error);
+
+struct carquet_nested_reader {
+    carquet_column_reader_t* column;
+    carquet_list_assembler_t assembler;
+    size_t value_size;
+
+    /* Entries of the current batch: values in entry slots and their levels */
+    uint8_t* values;
+    int16_t* def_levels;
+    int16_t* rep_levels;
+    int64_t capacity;
+};
+
+/* ============================================================================
+ * Level Assembly
+ * ============================================================================
+ */
+
+carquet_status_t carquet_list_assembler_init(
+    carquet_list_assembler_t* assembler,
+    const int16_t* rep_def,
+    int32_t num_levels,
+    int16_t max_def_level) {
+
+    memset(assembler, 0, sizeof(*assembler));
+    assembler->num_levels = num_levels;
+    assembler->max_def_level = max_def_level;
+    if (num_levels == 0) {
+        return CARQUET_OK;
+    }
+
+    assembler->rep_def = malloc(sizeof(int16_t) * (size_t)num_levels);
+    assembler->levels = calloc((size_t)num_levels, sizeof(carquet_list_level_t));
+    assembler->offsets = calloc((size_t)num_levels, sizeof(int32_t*));
+    assembler->validity = calloc((size_t)num_levels, sizeof(uint8_t*));
+    if (!assembler->rep_def || !assembler->levels || !assembler->offsets || !assembler->validity) {
+        carquet_list_assembler_destroy(assembler);
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    memcpy(assembler->rep_def, rep_def, sizeof(int16_t) * (size_t)num_levels);
+    return CARQUET_OK;
+}
+
+void carquet_list_assembler_destroy(carquet_list_assembler_t* assembler) {
+    for (int32_t i = 0; i < assembler->num_levels; i++) {
+        if (assembler->offsets) free(assembler->offsets[i]);
+        if (assembler->validity) free(assembler->validity[i]);
+    }
+    free(assembler->rep_def);
+    free(assembler->levels);
+    free(assembler->offsets);
+    free(assembler->validity);
+    free(assembler->value_validity);
+    memset(assembler, 0, sizeof(*assembler));
+}
+
+static carquet_status_t grow_assembler(carquet_list_assembler_t* assembler, int64_t count) {
+    if (assembler->value_validity && count <= assembler->capacity) {
+        return CARQUET_OK;
+    }
+    int64_t capacity = assembler->capacity > 0 ? assembler->capacity : 1024;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+
+    /* Every entry may open a slot at each level, plus the closing offset */
+    size_t bitmap_size = (size_t)capacity / 8 + 1;
+    for (int32_t i = 0; i < assembler->num_levels; i++) {
+        int32_t* offsets = realloc(assembler->offsets[i], sizeof(int32_t) * ((size_t)capacity + 1));
+        if (!offsets) return CARQUET_ERROR_OUT_OF_MEMORY;
+        assembler->offsets[i] = offsets;
+        uint8_t* validity = realloc(assembler->validity[i], bitmap_size);
+        if (!validity) return CARQUET_ERROR_OUT_OF_MEMORY;
+        assembler->validity[i] = validity;
+    }
+    uint8_t* value_validity = realloc(assembler->value_validity, bitmap_size);
+    if (!value_validity) return CARQUET_ERROR_OUT_OF_MEMORY;
+    assembler->value_validity = value_validity;
+
+    assembler->capacity = capacity;
+    return CARQUET_OK;
+}
+
+static inline void put_bit(uint8_t* bitmap, int64_t i, bool value) {
+    uint8_t* byte = bitmap + i / 8;
+    int shift = (int)(i % 8);
+    *byte = (uint8_t)((*byte & ~(1u << shift)) | ((unsigned)value << shift));
+}
+
+carquet_status_t carquet_list_assembler_run(
+    carquet_list_assembler_t* assembler,
+    const int16_t* def_levels,
+    const int16_t* rep_levels,
+    int64_t count) {
+
+    if (count > INT32_MAX) {
+        /* Would need Arrow's large list (int64 offsets) */
+        return CARQUET_ERROR_NOT_IMPLEMENTED;
+    }
+    carquet_status_t status = grow_assembler(assembler, count);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    int32_t num_levels = assembler->num_levels;
+    const int16_t* rep_def = assembler->rep_def;
+    int16_t max_def = assembler->max_def_level;
+    int16_t value_def = num_levels > 0 ? rep_def[num_levels - 1] : 0;
+    carquet_list_level_t* levels = assembler->levels;
+    for (int32_t i = 0; i < num_levels; i++) {
+        levels[i].length = 0;
+        levels[i].null_count = 0;
+    }
+    int64_t num_values = 0;
+    int64_t null_count = 0;
+
+    /* Each entry opens a list at every level from its repetition level
+     * down, as far as its definition level reaches. Offsets and bits are
+     * written at the next slot unconditionally and kept only if the slot
+     * opens, which keeps the pass free of data-dependent branches. */
+    for (int64_t e = 0; e < count; e++) {
+        int16_t def = def_levels ? def_levels[e] : max_def;
+        int16_t rep = rep_levels ? rep_levels[e] : 0;
+
+        for (int32_t i = 0; i < num_levels; i++) {
+            int64_t slot = levels[i].length;
+            int64_t child = i + 1 < num_levels ? levels[i + 1].length : num_values;
+            bool opens = rep <= i && def >= (i > 0 ? rep_def[i - 1] : 0);
+            bool valid = def >= rep_def[i] - 1;
+            assembler->offsets[i][slot] = (int32_t)child;
+            put_bit(assembler->validity[i], slot, valid);
+            levels[i].length = slot + opens;
+            levels[i].null_count += opens & !valid;
+        }
+
+        bool has_slot = def >= value_def;
+        bool valid = def >= max_def;
+        put_bit(assembler->value_validity, num_values, valid);
+        num_values += has_slot;
+        null_count += has_slot & !valid;
+    }
+
+    for (int32_t i = 0; i < num_levels; i++) {
+        int64_t child = i + 1 < num_levels ? levels[i + 1].length : num_values;
+        assembler->offsets[i][levels[i].length] = (int32_t)child;
+        levels[i].offsets = assembler->offsets[i];
+        levels[i].validity = assembler->validity[i];
+    }
+    assembler->num_values = num_values;
+    assembler->null_count = null_count;
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Schema Path
+ * ============================================================================
+ */
+
+/**
+ * Find the path from element idx down to element target in the depth-first
+ * schema array, storing element indices from depth on. Returns the index
+ * after idx's subtree; *path_len is set once target is found.
+ */
+static int32_t find_path(const parquet_schema_element_t* elements, int32_t num_elements,
+                         int32_t idx, int32_t target, int32_t* path, int32_t depth,
+                         int32_t* path_len) {
+    if (idx >= num_elements) {
+        return idx;
+    }
+    path[depth] = idx;
+    if (idx == target) {
+        *path_len = depth + 1;
+        return idx + 1;
+    }
+    int32_t next = idx + 1;
+    for (int32_t child = 0; child < elements[idx].num_children && !*path_len; child++) {
+        next = find_path(elements, num_elements, next, target, path, depth + 1, path_len);
+    }
+    return next;
+}
+
+static bool is_list_or_map(const parquet_schema_element_t* elem) {
+    if (elem->has_logical_type &&
+        (elem->logical_type.id == CARQUET_LOGICAL_LIST ||
+         elem->logical_type.id == CARQUET_LOGICAL_MAP)) {
+        return true;
+    }
+    return elem->has_converted_type &&
+        (elem->converted_type == CARQUET_CONVERTED_LIST ||
+         elem->converted_type == CARQUET_CONVERTED_MAP ||
+         elem->converted_type == CARQUET_CONVERTED_MAP_KEY_VALUE);
+}
+
+/**
+ * Set up the assembler from the repeated ancestors of a leaf column and
+ * record the schema element of each level.
+ */
+static carquet_status_t init_levels(carquet_nested_reader_t* nested,
+                                    const carquet_schema_t* schema,
+                                    int32_t column_index,
+                                    carquet_error_t* error) {
+    const parquet_schema_element_t* elements = schema->elements;
+    int32_t* path = malloc(sizeof(int32_t) * (size_t)schema->num_elements);
+    int16_t* rep_def = malloc(sizeof(int16_t) * (size_t)schema->num_elements);
+    int32_t* level_elements = malloc(sizeof(int32_t) * (size_t)schema->num_elements);
+    if (!path || !rep_def || !level_elements) {
+        free(path);
+        free(rep_def);
+        free(level_elements);
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate schema path");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    int32_t path_len = 0;
+    find_path(elements, schema->num_elements, 0, schema->leaf_indices[column_index],
+              path, 0, &path_len);
+
+    /* The root (path[0]) adds no level */
+    int16_t def = 0;
+    int32_t num_levels = 0;
+    for (int32_t k = 1; k < path_len; k++) {
+        const parquet_schema_element_t* elem = &elements[path[k]];
+        if (!elem->has_repetition || elem->repetition_type == CARQUET_REPETITION_REQUIRED) {
+            continue;
+        }
+        def++;
+        if (elem->repetition_type == CARQUET_REPETITION_REPEATED) {
+            rep_def[num_levels] = def;
+            level_elements[num_levels] = k > 1 && is_list_or_map(&elements[path[k - 1]])
+                ? path[k - 1] : path[k];
+            num_levels++;
+        }
+    }
+
+    carquet_status_t status = CARQUET_OK;
+    if (path_len == 0 || num_levels != nested->column->max_rep_level ||
+        def != nested->column->max_def_level) {
+        status = CARQUET_ERROR_INVALID_SCHEMA;
+        CARQUET_SET_ERROR(error, status, "Cannot resolve the schema path of column %d",
+                          column_index);
+    } else {
+        status = carquet_list_assembler_init(&nested->assembler, rep_def, num_levels, def);
+        if (status != CARQUET_OK) {
+            CARQUET_SET_ERROR(error, status, "Failed to allocate list levels");
+        }
+        for (int32_t i = 0; status == CARQUET_OK && i < num_levels; i++) {
+            nested->assembler.levels[i].schema_element = level_elements[i];
+        }
+    }
+
+    free(path);
+    free(rep_def);
+    free(level_elements);
+    return status;
+}
+
+/* ============================================================================
+ * Nested Reader
+ * ============================================================================
+ */
+
+static size_t nested_value_size(carquet_physical_type_t type, int32_t type_length) {
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN: return 1;
+        case CARQUET_PHYSICAL_INT32: return 4;
+        case CARQUET_PHYSICAL_INT64: return 8;
+        case CARQUET_PHYSICAL_INT96: return 12;
+        case CARQUET_PHYSICAL_FLOAT: return 4;
+        case CARQUET_PHYSICAL_DOUBLE: return 8;
+        case CARQUET_PHYSICAL_BYTE_ARRAY: return sizeof(carquet_byte_array_t);
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY: return (size_t)type_length;
+        default: return 0;
+    }
+}
+
+carquet_nested_reader_t* carquet_nested_reader_create(
+    carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_error_t* error) {
+
+    /* reader is nonnull per API contract */
+    carquet_nested_reader_t* nested = calloc(1, sizeof(carquet_nested_reader_t));
+    if (!nested) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate nested reader");
+        return NULL;
+    }
+
+    nested->column = carquet_reader_get_column(reader, row_group_index, column_index, error);
+    if (!nested->column) {
+        free(nested);
+        return NULL;
+    }
+
+    /* Values land in their entry slots, so batches may start and end
+     * anywhere in a page */
+    nested->column->spaced_values = true;
+    nested->value_size = nested_value_size(nested->column->type, nested->column->type_length);
+    if (nested->value_size == 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_TYPE_MISMATCH, "Unsupported column type");
+        carquet_nested_reader_free(nested);
+        return NULL;
+    }
+
+    if (init_levels(nested, carquet_reader_schema(reader), column_index, error) != CARQUET_OK) {
+        carquet_nested_reader_free(nested);
+        return NULL;
+    }
+    return nested;
+}
+
+static carquet_status_t grow_entries(carquet_nested_reader_t* nested, int64_t count,
+                                     carquet_error_t* error) {
+    if (count <= nested->capacity) {
+        return CARQUET_OK;
+    }
+    int64_t capacity = nested->capacity > 0 ? nested->capacity : 1024;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+
+    uint8_t* values = realloc(nested->values, nested->value_size * (size_t)capacity);
+    if (values) nested->values = values;
+    int16_t* def_levels = realloc(nested->def_levels, sizeof(int16_t) * (size_t)capacity);
+    if (def_levels) nested->def_levels = def_levels;
+    int16_t* rep_levels = realloc(nested->rep_levels, sizeof(int16_t) * (size_t)capacity);
+    if (rep_levels) nested->rep_levels = rep_levels;
+    if (!values || !def_levels || !rep_levels) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate nested batch");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    nested->capacity = capacity;
+    return CARQUET_OK;
+}
+
+/**
+ * The column reader leaves every entry's value in its entry slot (zeroed
+ * for nulls). Entries that stop at an empty or null list have no element,
+ * so pull the element slots together in order.
+ */
+static void compact_values(carquet_nested_reader_t* nested, int64_t count) {
+    const carquet_list_assembler_t* assembler = &nested->assembler;
+    if (assembler->num_values == count) {
+        return;
+    }
+
+    int16_t slot_def = assembler->rep_def[assembler->num_levels - 1];
+    size_t value_size = nested->value_size;
+    int64_t k = 0;
+    for (int64_t i = 0; i < count; i++) {
+        if (nested->def_levels[i] >= slot_def) {
+            if (k != i) {
+                memcpy(nested->values + (size_t)k * value_size,
+                       nested->values + (size_t)i * value_size, value_size);
+            }
+            k++;
+        }
+    }
+}
+
+carquet_status_t carquet_nested_reader_next(
+    carquet_nested_reader_t* nested,
+    int64_t max_rows,
+    carquet_nested_batch_t* batch,
+    carquet_error_t* error) {
+
+    /* nested and batch are nonnull per API contract */
+    memset(batch, 0, sizeof(*batch));
+    if (max_rows <= 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "max_rows must be positive");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    carquet_column_reader_t* column = nested->column;
+    carquet_column_reader_release_batch(column);
+    bool repeated = column->max_rep_level > 0;
+    int64_t count = 0;
+    int64_t rows = 0;
+
+    while (column->values_remaining > 0) {
+        /* Stage the page (a zero-value read decodes it without taking
+         * any entry) so its repetition levels can be scanned */
+        uint8_t dummy[16];
+        int64_t values_read = 0;
+        carquet_status_t status = carquet_read_next_page(
+            column, dummy, 0, NULL, NULL, &values_read, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        int64_t available = column->page_num_values - column->page_values_read;
+        if (!column->page_loaded || available <= 0) {
+            break;
+        }
+
+        /* Take entries up to the start of record max_rows + 1 */
+        int64_t take = 0;
+        if (repeated) {
+            const int16_t* rep = column->decoded_rep_levels + column->page_values_read;
+            for (; take < available; take++) {
+                if (rep[take] == 0) {
+                    if (rows == max_rows) break;
+                    rows++;
+                }
+            }
+        } else {
+            take = available < max_rows - rows ? available : max_rows - rows;
+            rows += take;
+        }
+        if (take == 0) {
+            break;
+        }
+
+        status = grow_entries(nested, count + take, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        status = carquet_read_next_page(
+            column, nested->values + (size_t)count * nested->value_size, take,
+            column->max_def_level > 0 ? nested->def_levels + count : NULL,
+            repeated ? nested->rep_levels + count : NULL, &values_read, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        count += values_read;
+        if (values_read < take) {
+            break;
+        }
+    }
+
+    carquet_status_t status = carquet_list_assembler_run(
+        &nested->assembler, column->max_def_level > 0 ? nested->def_levels : NULL,
+        repeated ? nested->rep_levels : NULL, count);
+    if (status != CARQUET_OK) {
+        CARQUET_SET_ERROR(error, status, "Failed to assemble list levels");
+        return status;
+    }
+    compact_values(nested, count);
+
+    const carquet_list_assembler_t* assembler = &nested->assembler;
+    batch->num_rows = rows;
+    batch->num_levels = assembler->num_levels;
+    batch->levels = assembler->levels;
+    batch->num_values = assembler->num_values;
+    batch->null_count = assembler->null_count;
+    batch->values = nested->values;
+    batch->validity = assembler->value_validity;
+    return CARQUET_OK;
+}
+
+void carquet_nested_reader_free(carquet_nested_reader_t* nested) {
+    if (!nested) return;
+    carquet_list_assembler_destroy(&nested->assembler);
+    carquet_column_reader_free(nested->column);
+    free(nested->values);
+    free(nested->def_levels);
+    free(nested->rep_levels);
+    free(nested);
+}
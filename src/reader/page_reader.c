@@ -11,6 +11,7 @@
 #include "encoding/plain.h"
 #include "encoding/rle.h"
 #include "core/endian.h"
+#include "core/bitpack.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -33,6 +34,33 @@ extern int64_t carquet_dispatch_count_non_nulls(const int16_t* def_levels, int64
                                                   int16_t max_def_level);
 extern void carquet_dispatch_fill_def_levels(int16_t* def_levels, int64_t count, int16_t value);
 
+/* SIMD dispatch functions for spacing values by a validity bitmap */
+extern void carquet_dispatch_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                                int64_t offset, int64_t count, int64_t present);
+extern void carquet_dispatch_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                                int64_t offset, int64_t count, int64_t present);
+
+/* Forward declarations for value decoders */
+extern carquet_status_t carquet_delta_decode_int32(
+    const uint8_t* data, size_t data_size,
+    int32_t* values, int32_t num_values, size_t* bytes_consumed);
+extern carquet_status_t carquet_delta_decode_int64(
+    const uint8_t* data, size_t data_size,
+    int64_t* values, int32_t num_values, size_t* bytes_consumed);
+extern carquet_status_t carquet_delta_length_decode_offsets(
+    const uint8_t* data, size_t data_size, int32_t num_values,
+    int32_t* offsets, const uint8_t** chars, size_t* bytes_consumed);
+extern carquet_status_t carquet_delta_strings_decode_offsets(
+    const uint8_t* data, size_t data_size, int32_t num_values,
+    int32_t* offsets, uint8_t** chars, size_t* chars_capacity, size_t* bytes_consumed);
+extern carquet_status_t carquet_byte_stream_split_decode_float(
+    const uint8_t* data, size_t data_size, float* values, int64_t count);
+extern carquet_status_t carquet_byte_stream_split_decode_double(
+    const uint8_t* data, size_t data_size, double* values, int64_t count);
+extern carquet_status_t carquet_byte_stream_split_decode(
+    const uint8_t* data, size_t data_size, int32_t type_length,
+    uint8_t* values, int64_t count);
+
 /* Forward declarations for compression functions */
 extern carquet_status_t carquet_lz4_decompress(
     const uint8_t* src, size_t src_size,
@@ -110,6 +138,32 @@ static inline int bit_width_for_max(int max_val) {
     return width;
 }
 
+/* ============================================================================
+ * Helper: Get value size for a physical type
+ * ============================================================================
+ */
+
+static size_t get_value_size(carquet_physical_type_t type, int32_t type_length) {
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN:
+            return 1;
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_FLOAT:
+            return 4;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE:
+            return 8;
+        case CARQUET_PHYSICAL_INT96:
+            return 12;
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            return type_length;
+        case CARQUET_PHYSICAL_BYTE_ARRAY:
+            return sizeof(carquet_byte_array_t);
+        default:
+            return 0;
+    }
+}
+
 /* ============================================================================
  * Level Decoding
  * ============================================================================
@@ -143,6 +197,66 @@ static carquet_status_t decode_levels_rle(
     return CARQUET_OK;
 }
 
+/**
+ * Decode levels [first, num_values) into their positions in levels,
+ * skipping the leading runs without decoding them. If prefix_matches is
+ * non-NULL it receives how many skipped levels equal match_level.
+ */
+static carquet_status_t decode_levels_from(
+    const uint8_t* data,
+    size_t data_size,
+    int bit_width,
+    int32_t first,
+    int32_t num_values,
+    int16_t* levels,
+    int16_t match_level,
+    int64_t* prefix_matches) {
+
+    if (prefix_matches) {
+        *prefix_matches = 0;
+    }
+
+    if (first == 0 || bit_width == 0) {
+        size_t bytes_consumed;
+        if (prefix_matches && bit_width == 0 && match_level == 0) {
+            *prefix_matches = first;
+        }
+        return decode_levels_rle(data, data_size, bit_width, num_values - first,
+                                 levels + first, &bytes_consumed);
+    }
+
+    carquet_rle_decoder_t dec;
+    carquet_rle_decoder_init(&dec, data, data_size, bit_width);
+    int64_t skipped = prefix_matches
+        ? carquet_rle_decoder_skip_count(&dec, first, (uint32_t)match_level, prefix_matches)
+        : carquet_rle_decoder_skip(&dec, first);
+    if (skipped != first || carquet_rle_decoder_status(&dec) != CARQUET_OK) {
+        return CARQUET_ERROR_DECODE;
+    }
+
+    uint32_t chunk[256];
+    int32_t pos = first;
+    while (pos < num_values) {
+        int64_t want = num_values - pos;
+        if (want > 256) want = 256;
+        int64_t got = carquet_rle_decoder_get_batch(&dec, chunk, want);
+        for (int64_t i = 0; i < got; i++) {
+            levels[pos + i] = (int16_t)chunk[i];
+        }
+        pos += (int32_t)got;
+        if (got < want) {
+            break;
+        }
+    }
+
+    if (carquet_rle_decoder_status(&dec) != CARQUET_OK) {
+        return CARQUET_ERROR_DECODE;
+    }
+
+    /* Like carquet_rle_decode_levels, a short stream leaves the tail as is */
+    return CARQUET_OK;
+}
+
 /* ============================================================================
  * Dictionary Page Reading
  * ============================================================================
@@ -252,108 +366,377 @@ carquet_status_t carquet_read_dictionary_page(
  * ============================================================================
  */
 
-carquet_status_t carquet_read_data_page_v1(
+/**
+ * Decode def levels of max 1 for entries [first, num_values) as bits of
+ * reader->page_validity, counting the present entries before first and
+ * from it on. A stream that ends early leaves the rest null.
+ */
+static carquet_status_t decode_page_validity(
     carquet_column_reader_t* reader,
-    const uint8_t* page_data,
-    size_t page_size,
-    const parquet_data_page_header_t* header,
-    void* values,
-    int64_t max_values,
-    int16_t* def_levels,
-    int16_t* rep_levels,
-    int64_t* values_read,
-    carquet_error_t* error) {
-
-    const uint8_t* ptr = page_data;
-    size_t remaining = page_size;
-    size_t bytes_consumed;
-
-    int32_t num_values = header->num_values;
-    if (num_values > max_values) {
-        num_values = (int32_t)max_values;
+    const uint8_t* def_data,
+    size_t def_size,
+    int32_t first,
+    int32_t num_values,
+    int64_t* skipped_present,
+    int64_t* present) {
+
+    carquet_rle_decoder_t dec;
+    carquet_rle_decoder_init(&dec, def_data, def_size, 1);
+    *skipped_present = 0;
+    *present = 0;
+    if (first > 0 &&
+        carquet_rle_decoder_skip_count(&dec, first, 1, skipped_present) != first) {
+        return CARQUET_ERROR_DECODE;
     }
 
-    /* Decode repetition levels if needed */
-    if (reader->max_rep_level > 0 && rep_levels) {
-        /* Read 4-byte length prefix */
-        if (remaining < 4) {
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Truncated rep levels");
-            return CARQUET_ERROR_DECODE;
-        }
-        uint32_t rep_size = carquet_read_u32_le(ptr);
-        ptr += 4;
-        remaining -= 4;
+    int64_t offset = reader->page_validity_offset + first;
+    int64_t count = num_values - first;
+    int64_t got = carquet_rle_decoder_get_bitmap(&dec, reader->page_validity, offset,
+                                                 count, present);
+    if (carquet_rle_decoder_status(&dec) != CARQUET_OK) {
+        return CARQUET_ERROR_DECODE;
+    }
+    carquet_bitmap_fill(reader->page_validity, offset + got, count - got, false);
+    return CARQUET_OK;
+}
 
-        if (rep_size > remaining) {
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Invalid rep level size");
-            return CARQUET_ERROR_DECODE;
-        }
+/**
+ * Decode the level streams of a data page for entries [first, num_values)
+ * and count its non-null values, in all and before first. A NULL stream
+ * means the column has no such levels (or the caller does not want them).
+ * With reader->validity_levels, def levels go to reader->page_validity.
+ */
+static carquet_status_t decode_page_levels(
+    carquet_column_reader_t* reader,
+    const uint8_t* rep_data,
+    size_t rep_size,
+    const uint8_t* def_data,
+    size_t def_size,
+    int32_t first,
+    int32_t num_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* skipped_non_null,
+    int64_t* non_null_count,
+    carquet_error_t* error) {
 
+    if (rep_data) {
         int bit_width = bit_width_for_max(reader->max_rep_level);
-        carquet_status_t status = decode_levels_rle(
-            ptr, rep_size, bit_width, num_values, rep_levels, &bytes_consumed);
+        carquet_status_t status = decode_levels_from(
+            rep_data, rep_size, bit_width, first, num_values, rep_levels, 0, NULL);
         if (status != CARQUET_OK) {
             CARQUET_SET_ERROR(error, status, "Failed to decode rep levels");
             return status;
         }
-        ptr += rep_size;
-        remaining -= rep_size;
     } else if (rep_levels) {
-        memset(rep_levels, 0, num_values * sizeof(int16_t));
+        memset(rep_levels + first, 0, (size_t)(num_values - first) * sizeof(int16_t));
     }
 
-    /* Decode definition levels if needed */
-    if (reader->max_def_level > 0 && def_levels) {
-        /* Read 4-byte length prefix */
-        if (remaining < 4) {
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Truncated def levels");
-            return CARQUET_ERROR_DECODE;
-        }
-        uint32_t def_size = carquet_read_u32_le(ptr);
-        ptr += 4;
-        remaining -= 4;
-
-        if (def_size > remaining) {
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Invalid def level size");
-            return CARQUET_ERROR_DECODE;
+    *skipped_non_null = first;
+    if (def_data && reader->validity_levels) {
+        int64_t present;
+        carquet_status_t status = decode_page_validity(
+            reader, def_data, def_size, first, num_values, skipped_non_null, &present);
+        if (status != CARQUET_OK) {
+            CARQUET_SET_ERROR(error, status, "Failed to decode def levels");
+            return status;
         }
-
+        *non_null_count = *skipped_non_null + present;
+        return CARQUET_OK;
+    } else if (def_data) {
         int bit_width = bit_width_for_max(reader->max_def_level);
-        carquet_status_t status = decode_levels_rle(
-            ptr, def_size, bit_width, num_values, def_levels, &bytes_consumed);
+        carquet_status_t status = decode_levels_from(
+            def_data, def_size, bit_width, first, num_values, def_levels,
+            reader->max_def_level, skipped_non_null);
         if (status != CARQUET_OK) {
             CARQUET_SET_ERROR(error, status, "Failed to decode def levels");
             return status;
         }
-        ptr += def_size;
-        remaining -= def_size;
     } else if (def_levels) {
         /* Set all to max level (all values present) */
-        for (int32_t i = 0; i < num_values; i++) {
+        for (int32_t i = first; i < num_values; i++) {
             def_levels[i] = reader->max_def_level;
         }
     }
 
     /* Count non-null values */
-    int32_t non_null_count = num_values;
-    if (def_levels && reader->max_def_level > 0) {
-        non_null_count = 0;
-        for (int32_t i = 0; i < num_values; i++) {
+    *non_null_count = num_values;
+    if (def_data) {
+        *non_null_count = *skipped_non_null;
+        for (int32_t i = first; i < num_values; i++) {
             if (def_levels[i] == reader->max_def_level) {
-                non_null_count++;
+                (*non_null_count)++;
+            }
+        }
+    }
+
+    /* Where partial reads of a packed page enter the value stream */
+    reader->page_value_entry = first;
+    reader->page_value_index = (int32_t)*skipped_non_null;
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Dictionary Lookup
+ * ============================================================================
+ */
+
+void carquet_column_reader_gather_dictionary(
+    const carquet_column_reader_t* reader,
+    const uint32_t* indices,
+    int64_t count,
+    void* values) {
+
+    uint8_t* out_values = (uint8_t*)values;
+    size_t value_size = get_value_size(reader->type, reader->type_length);
+
+    if (reader->type == CARQUET_PHYSICAL_BYTE_ARRAY) {
+        /* BYTE_ARRAY: dictionary is stored as length-prefixed values */
+        carquet_byte_array_t* out = (carquet_byte_array_t*)out_values;
+
+        /* Use O(1) offset table lookup (built when dictionary was read) */
+        if (reader->dictionary_offsets) {
+            for (int64_t i = 0; i < count; i++) {
+                /* Direct O(1) lookup using offset table */
+                uint32_t offset = reader->dictionary_offsets[indices[i]];
+                const uint8_t* dict_ptr = reader->dictionary_data + offset;
+                uint32_t len = carquet_read_u32_le(dict_ptr);
+                out[i].data = (uint8_t*)(dict_ptr + 4);
+                out[i].length = (int32_t)len;
+            }
+        } else {
+            /* Fallback: scan each time (shouldn't happen for new readers) */
+            for (int64_t i = 0; i < count; i++) {
+                const uint8_t* dict_ptr = reader->dictionary_data;
+                for (uint32_t j = 0; j < indices[i]; j++) {
+                    uint32_t len = carquet_read_u32_le(dict_ptr);
+                    dict_ptr += 4 + len;
+                }
+                uint32_t len = carquet_read_u32_le(dict_ptr);
+                out[i].data = (uint8_t*)(dict_ptr + 4);
+                out[i].length = (int32_t)len;
+            }
+        }
+        return;
+    }
+
+    /* Use SIMD-optimized gather for common types */
+    switch (reader->type) {
+        case CARQUET_PHYSICAL_INT32:
+            carquet_dispatch_gather_i32(
+                (const int32_t*)reader->dictionary_data,
+                indices, count, (int32_t*)out_values);
+            break;
+        case CARQUET_PHYSICAL_INT64:
+            carquet_dispatch_gather_i64(
+                (const int64_t*)reader->dictionary_data,
+                indices, count, (int64_t*)out_values);
+            break;
+        case CARQUET_PHYSICAL_FLOAT:
+            carquet_dispatch_gather_float(
+                (const float*)reader->dictionary_data,
+                indices, count, (float*)out_values);
+            break;
+        case CARQUET_PHYSICAL_DOUBLE:
+            carquet_dispatch_gather_double(
+                (const double*)reader->dictionary_data,
+                indices, count, (double*)out_values);
+            break;
+        case CARQUET_PHYSICAL_INT96:
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            /* Scalar fallback for less common types */
+            for (int64_t i = 0; i < count; i++) {
+                memcpy(out_values + i * value_size,
+                       reader->dictionary_data + indices[i] * value_size,
+                       value_size);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+const void* carquet_column_reader_dictionary(
+    carquet_column_reader_t* reader,
+    int32_t* count) {
+
+    *count = 0;
+    if (!reader->has_dictionary) {
+        return NULL;
+    }
+
+    if (reader->type == CARQUET_PHYSICAL_BYTE_ARRAY) {
+        /* Entries are handed out as views, built once per chunk */
+        if (!reader->dictionary_values && reader->dictionary_count > 0) {
+            carquet_byte_array_t* entries = malloc(
+                (size_t)reader->dictionary_count * sizeof(carquet_byte_array_t));
+            if (!entries) {
+                return NULL;
             }
+            for (int32_t i = 0; i < reader->dictionary_count; i++) {
+                uint32_t index = (uint32_t)i;
+                carquet_column_reader_gather_dictionary(reader, &index, 1, &entries[i]);
+            }
+            reader->dictionary_values = entries;
         }
+        *count = reader->dictionary_count;
+        return reader->dictionary_values;
+    }
+
+    *count = reader->dictionary_count;
+    return reader->dictionary_data;
+}
+
+/* ============================================================================
+ * Byte Array Buffers
+ * ============================================================================
+ */
+
+/**
+ * Keep a page buffer alive until the next batch starts, since views handed
+ * out earlier in this batch may point into it.
+ */
+static void retire_buffer(carquet_column_reader_t* reader, uint8_t* buffer) {
+    if (!buffer) {
+        return;
+    }
+    if (reader->num_retired_buffers == reader->retired_buffers_capacity) {
+        int32_t new_cap = reader->retired_buffers_capacity == 0
+            ? 4 : reader->retired_buffers_capacity * 2;
+        uint8_t** grown = realloc(reader->retired_buffers, (size_t)new_cap * sizeof(uint8_t*));
+        if (!grown) {
+            /* Views from earlier pages of this batch dangle, as they did
+             * before pages were retained */
+            free(buffer);
+            return;
+        }
+        reader->retired_buffers = grown;
+        reader->retired_buffers_capacity = new_cap;
+    }
+    reader->retired_buffers[reader->num_retired_buffers++] = buffer;
+}
+
+/** Make buffer the page data that byte array views point into. */
+static void retain_page_data(carquet_column_reader_t* reader, uint8_t* buffer) {
+    retire_buffer(reader, reader->page_data_for_values);
+    reader->page_data_for_values = buffer;
+}
+
+/** Byte array views of these pages point into the page bytes themselves. */
+static bool views_page_data(const carquet_column_reader_t* reader, carquet_encoding_t encoding) {
+    return reader->type == CARQUET_PHYSICAL_BYTE_ARRAY &&
+           (encoding == CARQUET_ENCODING_PLAIN ||
+            encoding == CARQUET_ENCODING_DELTA_LENGTH_BYTE_ARRAY);
+}
+
+void carquet_column_reader_release_batch(carquet_column_reader_t* reader) {
+    for (int32_t i = 0; i < reader->num_retired_buffers; i++) {
+        free(reader->retired_buffers[i]);
+    }
+    reader->num_retired_buffers = 0;
+}
+
+/**
+ * Decode a DELTA_LENGTH_BYTE_ARRAY or DELTA_BYTE_ARRAY page into the
+ * reader's offsets and one contiguous run of string bytes, then point the
+ * views of entries [first, count) at it. Lengths are delta coded and
+ * prefixes build on the previous value, so the whole page is decoded.
+ */
+static carquet_status_t decode_string_page(
+    carquet_column_reader_t* reader,
+    carquet_encoding_t encoding,
+    const uint8_t* ptr,
+    size_t remaining,
+    carquet_byte_array_t* values,
+    int32_t first,
+    int64_t count) {
+
+    if ((size_t)count + 1 > reader->string_offsets_capacity) {
+        int32_t* offsets = realloc(reader->string_offsets, ((size_t)count + 1) * sizeof(int32_t));
+        if (!offsets) {
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+        reader->string_offsets = offsets;
+        reader->string_offsets_capacity = (size_t)count + 1;
+    }
+
+    carquet_status_t status;
+    const uint8_t* chars = NULL;
+    if (encoding == CARQUET_ENCODING_DELTA_LENGTH_BYTE_ARRAY) {
+        status = carquet_delta_length_decode_offsets(
+            ptr, remaining, (int32_t)count, reader->string_offsets, &chars, NULL);
+    } else {
+        /* The previous page's strings may back views of this batch */
+        retire_buffer(reader, reader->string_buffer);
+        reader->string_buffer = NULL;
+        reader->string_buffer_capacity = 0;
+        status = carquet_delta_strings_decode_offsets(
+            ptr, remaining, (int32_t)count, reader->string_offsets,
+            &reader->string_buffer, &reader->string_buffer_capacity, NULL);
+        chars = reader->string_buffer;
+    }
+    if (status != CARQUET_OK) {
+        reader->string_data = NULL;
+        return status;
+    }
+    reader->string_data = chars;
+
+    const int32_t* offsets = reader->string_offsets;
+    for (int64_t i = first; i < count; i++) {
+        values[i].data = (uint8_t*)(chars + offsets[i]);
+        values[i].length = offsets[i + 1] - offsets[i];
+    }
+    return CARQUET_OK;
+}
+
+/**
+ * Decode the values section of a data page: the value stream is entered at
+ * value first, and slots [first, non_null_count) of values are filled.
+ */
+static carquet_status_t decode_page_values(
+    carquet_column_reader_t* reader,
+    carquet_encoding_t encoding,
+    const uint8_t* ptr,
+    size_t remaining,
+    void* values,
+    int32_t first,
+    int64_t non_null_count,
+    carquet_error_t* error) {
+
+    /* The value stream is entered at value first and decoded into the
+     * matching output slot */
+    size_t value_size = get_value_size(reader->type, reader->type_length);
+    int64_t decode_count = non_null_count - first;
+    if (decode_count < 0) {
+        decode_count = 0;
     }
 
     /* Decode values based on encoding */
     carquet_status_t status = CARQUET_OK;
 
-    switch (header->encoding) {
+    switch (encoding) {
         case CARQUET_ENCODING_PLAIN:
             {
+                /* Booleans are bit-packed: skip whole bytes and decode the
+                 * rest of the partial byte into slots that are never read */
+                int64_t skip = first < non_null_count ? first : non_null_count;
+                if (reader->type == CARQUET_PHYSICAL_BOOLEAN) {
+                    skip &= ~(int64_t)7;
+                    decode_count = non_null_count - skip;
+                    if (decode_count < 0) decode_count = 0;
+                }
+
+                int64_t skipped_bytes = carquet_skip_plain(
+                    ptr, remaining, reader->type, reader->type_length, skip);
+                if (skipped_bytes < 0) {
+                    status = CARQUET_ERROR_DECODE;
+                    break;
+                }
+
                 int64_t bytes = carquet_decode_plain(
-                    ptr, remaining, reader->type, reader->type_length,
-                    values, non_null_count);
+                    ptr + skipped_bytes, remaining - (size_t)skipped_bytes,
+                    reader->type, reader->type_length,
+                    (uint8_t*)values + (size_t)skip * value_size, decode_count);
                 if (bytes < 0) {
                     status = CARQUET_ERROR_DECODE;
                 }
@@ -378,127 +761,129 @@ carquet_status_t carquet_read_data_page_v1(
                 ptr++;
                 remaining--;
 
-                /* Use reusable indices buffer to avoid per-page allocation */
+                /* In dictionary output mode the indices are the page's
+                 * values; otherwise they go to the reusable indices buffer
+                 * to avoid per-page allocation */
                 uint32_t* indices;
-                if ((size_t)non_null_count <= reader->indices_capacity) {
+                if (reader->page_is_indices) {
+                    indices = (uint32_t*)values + first;
+                } else if ((size_t)decode_count <= reader->indices_capacity) {
                     indices = reader->indices_buffer;
                 } else {
                     /* Need larger buffer - reallocate */
                     free(reader->indices_buffer);
-                    reader->indices_buffer = malloc(non_null_count * sizeof(uint32_t));
+                    reader->indices_buffer = malloc((size_t)decode_count * sizeof(uint32_t));
                     if (!reader->indices_buffer) {
                         reader->indices_capacity = 0;
                         CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate indices");
                         return CARQUET_ERROR_OUT_OF_MEMORY;
                     }
-                    reader->indices_capacity = non_null_count;
+                    reader->indices_capacity = (size_t)decode_count;
                     indices = reader->indices_buffer;
                 }
 
-                int64_t decoded = carquet_rle_decode_all(
-                    ptr, remaining, bit_width, indices, non_null_count);
+                int64_t decoded;
+                if (first == 0 || decode_count == 0) {
+                    decoded = carquet_rle_decode_all(
+                        ptr, remaining, bit_width, indices, decode_count);
+                } else {
+                    /* Step over the skipped indices run by run */
+                    carquet_rle_decoder_t dec;
+                    carquet_rle_decoder_init(&dec, ptr, remaining, bit_width);
+                    carquet_rle_decoder_skip(&dec, first);
+                    decoded = carquet_rle_decoder_get_batch(&dec, indices, decode_count);
+                    if (carquet_rle_decoder_status(&dec) != CARQUET_OK) {
+                        decoded = -1;
+                    }
+                }
 
                 if (decoded < 0) {
                     CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Failed to decode dictionary indices");
                     return CARQUET_ERROR_DECODE;
                 }
 
-                /* Look up values from dictionary */
-                if (reader->type == CARQUET_PHYSICAL_BYTE_ARRAY) {
-                    /* BYTE_ARRAY: dictionary is stored as length-prefixed values */
-                    carquet_byte_array_t* out = (carquet_byte_array_t*)values;
-
-                    /* Use O(1) offset table lookup (built when dictionary was read) */
-                    if (reader->dictionary_offsets) {
-                        for (int32_t i = 0; i < non_null_count; i++) {
-                            int32_t idx = (int32_t)indices[i];
-                            if (idx < 0 || idx >= reader->dictionary_count) {
-                                status = CARQUET_ERROR_DECODE;
-                                break;
-                            }
-
-                            /* Direct O(1) lookup using offset table */
-                            uint32_t offset = reader->dictionary_offsets[idx];
-                            const uint8_t* dict_ptr = reader->dictionary_data + offset;
-                            uint32_t len = carquet_read_u32_le(dict_ptr);
-                            out[i].data = (uint8_t*)(dict_ptr + 4);
-                            out[i].length = (int32_t)len;
-                        }
-                    } else {
-                        /* Fallback: scan each time (shouldn't happen for new readers) */
-                        for (int32_t i = 0; i < non_null_count; i++) {
-                            int32_t idx = (int32_t)indices[i];
-                            if (idx < 0 || idx >= reader->dictionary_count) {
-                                status = CARQUET_ERROR_DECODE;
-                                break;
-                            }
-
-                            const uint8_t* dict_ptr = reader->dictionary_data;
-                            for (int32_t j = 0; j < idx; j++) {
-                                uint32_t len = carquet_read_u32_le(dict_ptr);
-                                dict_ptr += 4 + len;
-                            }
-                            uint32_t len = carquet_read_u32_le(dict_ptr);
-                            out[i].data = (uint8_t*)(dict_ptr + 4);
-                            out[i].length = (int32_t)len;
-                        }
-                    }
-                } else {
-                    /* Validate all indices first */
-                    for (int32_t i = 0; i < non_null_count; i++) {
-                        if (indices[i] >= (uint32_t)reader->dictionary_count) {
-                            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Dictionary index out of bounds");
-                            return CARQUET_ERROR_DECODE;
-                        }
+                /* Validate all indices first */
+                for (int64_t i = 0; i < decode_count; i++) {
+                    if (indices[i] >= (uint32_t)reader->dictionary_count) {
+                        CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Dictionary index out of bounds");
+                        return CARQUET_ERROR_DECODE;
                     }
+                }
 
-                    /* Use SIMD-optimized gather for common types */
-                    switch (reader->type) {
-                        case CARQUET_PHYSICAL_INT32:
-                            carquet_dispatch_gather_i32(
-                                (const int32_t*)reader->dictionary_data,
-                                indices, non_null_count, (int32_t*)values);
-                            break;
-                        case CARQUET_PHYSICAL_INT64:
-                            carquet_dispatch_gather_i64(
-                                (const int64_t*)reader->dictionary_data,
-                                indices, non_null_count, (int64_t*)values);
-                            break;
-                        case CARQUET_PHYSICAL_FLOAT:
-                            carquet_dispatch_gather_float(
-                                (const float*)reader->dictionary_data,
-                                indices, non_null_count, (float*)values);
-                            break;
-                        case CARQUET_PHYSICAL_DOUBLE:
-                            carquet_dispatch_gather_double(
-                                (const double*)reader->dictionary_data,
-                                indices, non_null_count, (double*)values);
-                            break;
-                        case CARQUET_PHYSICAL_INT96:
-                        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
-                            {
-                                /* Scalar fallback for less common types */
-                                size_t value_size = (reader->type == CARQUET_PHYSICAL_INT96)
-                                    ? 12 : (size_t)reader->type_length;
-                                uint8_t* out = (uint8_t*)values;
-                                for (int32_t i = 0; i < non_null_count; i++) {
-                                    memcpy(out + i * value_size,
-                                           reader->dictionary_data + indices[i] * value_size,
-                                           value_size);
-                                }
-                            }
-                            break;
-                        default:
-                            break;
-                    }
+                /* Look up values from dictionary */
+                if (!reader->page_is_indices) {
+                    carquet_column_reader_gather_dictionary(
+                        reader, indices, decode_count, (uint8_t*)values + (size_t)first * value_size);
                 }
                 /* indices buffer is reused, don't free */
             }
             break;
 
+        case CARQUET_ENCODING_DELTA_BINARY_PACKED:
+            /* Each value builds on the previous one, so skipped entries are
+             * decoded too, into slots that are never read */
+            if (non_null_count == 0) {
+                break;
+            }
+            if (reader->type == CARQUET_PHYSICAL_INT32) {
+                status = carquet_delta_decode_int32(
+                    ptr, remaining, (int32_t*)values, (int32_t)non_null_count, NULL);
+            } else if (reader->type == CARQUET_PHYSICAL_INT64) {
+                status = carquet_delta_decode_int64(
+                    ptr, remaining, (int64_t*)values, (int32_t)non_null_count, NULL);
+            } else {
+                CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ENCODING,
+                    "DELTA_BINARY_PACKED requires an INT32 or INT64 column");
+                return CARQUET_ERROR_INVALID_ENCODING;
+            }
+            break;
+
+        case CARQUET_ENCODING_DELTA_LENGTH_BYTE_ARRAY:
+        case CARQUET_ENCODING_DELTA_BYTE_ARRAY:
+            if (reader->type != CARQUET_PHYSICAL_BYTE_ARRAY) {
+                CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ENCODING,
+                    "Delta string encodings require a BYTE_ARRAY column");
+                return CARQUET_ERROR_INVALID_ENCODING;
+            }
+            if (non_null_count == 0) {
+                break;
+            }
+            status = decode_string_page(reader, encoding, ptr, remaining,
+                                        (carquet_byte_array_t*)values, first, non_null_count);
+            break;
+
+        case CARQUET_ENCODING_BYTE_STREAM_SPLIT:
+            /* Each byte stream spans the whole page, so the transpose covers
+             * skipped entries too; 4- and 8-byte types share the float and
+             * double kernels */
+            if (non_null_count == 0) {
+                break;
+            }
+            switch (reader->type) {
+                case CARQUET_PHYSICAL_FLOAT:
+                case CARQUET_PHYSICAL_INT32:
+                    status = carquet_byte_stream_split_decode_float(
+                        ptr, remaining, (float*)values, non_null_count);
+                    break;
+                case CARQUET_PHYSICAL_DOUBLE:
+                case CARQUET_PHYSICAL_INT64:
+                    status = carquet_byte_stream_split_decode_double(
+                        ptr, remaining, (double*)values, non_null_count);
+                    break;
+                case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+                    status = carquet_byte_stream_split_decode(
+                        ptr, remaining, reader->type_length, (uint8_t*)values, non_null_count);
+                    break;
+                default:
+                    CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ENCODING,
+                        "BYTE_STREAM_SPLIT requires a fixed-width column");
+                    return CARQUET_ERROR_INVALID_ENCODING;
+            }
+            break;
+
         default:
             CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ENCODING,
-                "Unsupported encoding: %d", header->encoding);
+                "Unsupported encoding: %d", encoding);
             return CARQUET_ERROR_INVALID_ENCODING;
     }
 
@@ -506,58 +891,388 @@ carquet_status_t carquet_read_data_page_v1(
         CARQUET_SET_ERROR(error, status, "Failed to decode values");
         return status;
     }
+    return CARQUET_OK;
+}
+
+/**
+ * Move the values of entries [first, num_values) from their stream slots to
+ * their entry slots (reader->spaced_values). Stream value k sits in slot k
+ * and never after its entry, so walking back from the end moves every
+ * value before its slot is overwritten. Entries without a value are zeroed.
+ * Presence comes from def_levels or, with validity_levels, page_validity;
+ * 4- and 8-byte values spaced by a bitmap go through the SIMD expand. A
+ * bitmap that disagrees with the decoded value count is rejected.
+ */
+static carquet_status_t space_page_values(
+    const carquet_column_reader_t* reader,
+    void* values,
+    int32_t first,
+    int32_t num_values,
+    int64_t skipped_non_null,
+    int64_t non_null_count,
+    const int16_t* def_levels) {
+
+    size_t value_size = reader->page_is_indices
+        ? sizeof(uint32_t) : get_value_size(reader->type, reader->type_length);
+    uint8_t* out = values;
+    int16_t max_def = reader->max_def_level;
+    const uint8_t* validity = reader->validity_levels ? reader->page_validity : NULL;
+    int64_t base = reader->page_validity_offset;
+    int64_t value_count = non_null_count - skipped_non_null;
+
+    /* The moves below index values by this count */
+    if (validity && first < num_values &&
+        carquet_bitmap_count(validity, base + first, num_values - first) != value_count) {
+        return CARQUET_ERROR_INVALID_RLE;
+    }
+
+    if (validity && (value_size == 4 || value_size == 8) && first < num_values) {
+        /* The expand wants the values of [first, num_values) packed at the
+         * front of their slots; skipped nulls leave them further back */
+        if (skipped_non_null != first && value_count > 0) {
+            memmove(out + (size_t)first * value_size,
+                    out + (size_t)skipped_non_null * value_size,
+                    (size_t)value_count * value_size);
+        }
+        if (value_size == 4) {
+            carquet_dispatch_expand_spaced_i32((uint32_t*)out + first, validity, base + first,
+                                               num_values - first, value_count);
+        } else {
+            carquet_dispatch_expand_spaced_i64((uint64_t*)out + first, validity, base + first,
+                                               num_values - first, value_count);
+        }
+        return CARQUET_OK;
+    }
+
+    int64_t k = non_null_count - 1;
+    for (int32_t i = num_values - 1; i >= first; i--) {
+        /* Every entry from first to i is present and already in its slot */
+        if (k == i) {
+            break;
+        }
+        uint8_t* slot = out + (size_t)i * value_size;
+        bool present = validity
+            ? (validity[(base + i) / 8] >> ((base + i) % 8)) & 1
+            : def_levels[i] == max_def;
+        if (!present) {
+            memset(slot, 0, value_size);
+        } else {
+            if (k != i) {
+                memmove(slot, out + (size_t)k * value_size, value_size);
+            }
+            k--;
+        }
+    }
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_read_data_page_v1(
+    carquet_column_reader_t* reader,
+    const uint8_t* page_data,
+    size_t page_size,
+    const parquet_data_page_header_t* header,
+    void* values,
+    int64_t max_values,
+    int32_t first_value,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error) {
+
+    const uint8_t* ptr = page_data;
+    size_t remaining = page_size;
+
+    int32_t num_values = header->num_values;
+    if (num_values > max_values) {
+        num_values = (int32_t)max_values;
+    }
+
+    /* Values before first_value are skipped: their levels and values are
+     * stepped over in the encoded streams and their slots left unwritten */
+    int32_t first = first_value;
+    if (first < 0) first = 0;
+    if (first > num_values) first = num_values;
+
+    /* Level streams each carry a 4-byte length prefix */
+    const uint8_t* rep_data = NULL;
+    uint32_t rep_size = 0;
+    if (reader->max_rep_level > 0 && rep_levels) {
+        if (remaining < 4) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Truncated rep levels");
+            return CARQUET_ERROR_DECODE;
+        }
+        rep_size = carquet_read_u32_le(ptr);
+        ptr += 4;
+        remaining -= 4;
+
+        if (rep_size > remaining) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Invalid rep level size");
+            return CARQUET_ERROR_DECODE;
+        }
+        rep_data = ptr;
+        ptr += rep_size;
+        remaining -= rep_size;
+    }
+
+    const uint8_t* def_data = NULL;
+    uint32_t def_size = 0;
+    if (reader->max_def_level > 0 && (def_levels || reader->validity_levels)) {
+        if (remaining < 4) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Truncated def levels");
+            return CARQUET_ERROR_DECODE;
+        }
+        def_size = carquet_read_u32_le(ptr);
+        ptr += 4;
+        remaining -= 4;
+
+        if (def_size > remaining) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_DECODE, "Invalid def level size");
+            return CARQUET_ERROR_DECODE;
+        }
+        def_data = ptr;
+        ptr += def_size;
+        remaining -= def_size;
+    }
+
+    int64_t skipped_non_null;
+    int64_t non_null_count;
+    carquet_status_t status = decode_page_levels(
+        reader, rep_data, rep_size, def_data, def_size, first, num_values,
+        def_levels, rep_levels, &skipped_non_null, &non_null_count, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    status = decode_page_values(reader, header->encoding, ptr, remaining,
+                                values, (int32_t)skipped_non_null, non_null_count, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+    if (reader->spaced_values && def_data) {
+        status = space_page_values(reader, values, first, num_values, skipped_non_null,
+                                   non_null_count, def_levels);
+        if (status != CARQUET_OK) {
+            CARQUET_SET_ERROR(error, status, "Validity bitmap does not match the value count");
+            return status;
+        }
+    }
 
     *values_read = num_values;
     return CARQUET_OK;
 }
 
+/**
+ * Decode a DATA_PAGE_V2 as stored in the file. Only the values section is
+ * compressed, and it is decompressed only if a value at or after
+ * first_value is present; *values_buffer then receives the decompressed
+ * section (owned by the caller, who may keep it for byte array views).
+ */
+carquet_status_t carquet_read_data_page_v2(
+    carquet_column_reader_t* reader,
+    const uint8_t* page_data,
+    size_t page_size,
+    const parquet_page_header_t* header,
+    carquet_compression_t codec,
+    void* values,
+    int64_t max_values,
+    int32_t first_value,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    uint8_t** values_buffer,
+    carquet_error_t* error) {
+
+    const parquet_data_page_header_v2_t* v2 = &header->data_page_header_v2;
+    *values_buffer = NULL;
+
+    /* Levels come first, uncompressed and without length prefixes */
+    int32_t rep_size = v2->repetition_levels_byte_length;
+    int32_t def_size = v2->definition_levels_byte_length;
+    if (rep_size < 0 || def_size < 0 || (size_t)rep_size + (size_t)def_size > page_size) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE, "Invalid level sizes in data page v2");
+        return CARQUET_ERROR_INVALID_PAGE;
+    }
+    size_t levels_size = (size_t)rep_size + (size_t)def_size;
+
+    int32_t num_values = v2->num_values;
+    if (num_values > max_values) {
+        num_values = (int32_t)max_values;
+    }
+
+    int32_t first = first_value;
+    if (first < 0) first = 0;
+    if (first > num_values) first = num_values;
+
+    const uint8_t* rep_data = reader->max_rep_level > 0 && rep_levels ? page_data : NULL;
+    const uint8_t* def_data = reader->max_def_level > 0 && (def_levels || reader->validity_levels)
+        ? page_data + rep_size : NULL;
+
+    int64_t skipped_non_null;
+    int64_t non_null_count;
+    carquet_status_t status = decode_page_levels(
+        reader, rep_data, (size_t)rep_size, def_data, (size_t)def_size, first, num_values,
+        def_levels, rep_levels, &skipped_non_null, &non_null_count, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    *values_read = num_values;
+
+    /* Nothing at or after first is present: the levels are all that is
+     * needed and the values section is never decompressed */
+    if (non_null_count <= skipped_non_null) {
+        if (reader->spaced_values && def_data) {
+            status = space_page_values(reader, values, first, num_values, skipped_non_null,
+                                       non_null_count, def_levels);
+            if (status != CARQUET_OK) {
+                CARQUET_SET_ERROR(error, status, "Validity bitmap does not match the value count");
+                return status;
+            }
+        }
+        return CARQUET_OK;
+    }
+
+    const uint8_t* values_data = page_data + levels_size;
+    size_t values_size = page_size - levels_size;
+
+    if (v2->is_compressed && codec != CARQUET_COMPRESSION_UNCOMPRESSED) {
+        if (header->uncompressed_page_size < 0 ||
+            (size_t)header->uncompressed_page_size < levels_size) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE, "Invalid uncompressed page size");
+            return CARQUET_ERROR_INVALID_PAGE;
+        }
+
+        size_t capacity = (size_t)header->uncompressed_page_size - levels_size;
+        uint8_t* buffer = malloc(capacity > 0 ? capacity : 1);
+        if (!buffer) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate decompress buffer");
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+
+        status = decompress_page(codec, values_data, values_size,
+                                 buffer, capacity, &values_size);
+        if (status != CARQUET_OK) {
+            free(buffer);
+            CARQUET_SET_ERROR(error, status, "Failed to decompress page");
+            return status;
+        }
+        values_data = buffer;
+        *values_buffer = buffer;
+    }
+
+    status = decode_page_values(reader, v2->encoding, values_data, values_size,
+                                values, (int32_t)skipped_non_null, non_null_count, error);
+    if (status != CARQUET_OK) {
+        free(*values_buffer);
+        *values_buffer = NULL;
+        return status;
+    }
+    if (reader->spaced_values && def_data) {
+        status = space_page_values(reader, values, first, num_values, skipped_non_null,
+                                   non_null_count, def_levels);
+        if (status != CARQUET_OK) {
+            CARQUET_SET_ERROR(error, status, "Validity bitmap does not match the value count");
+            return status;
+        }
+    }
+    return CARQUET_OK;
+}
+
 /* ============================================================================
- * Helper: Get value size for a physical type
+ * Helper: Resolve file bytes that are already in memory
  * ============================================================================
  */
 
-static size_t get_value_size(carquet_physical_type_t type, int32_t type_length) {
-    switch (type) {
-        case CARQUET_PHYSICAL_BOOLEAN:
-            return 1;
-        case CARQUET_PHYSICAL_INT32:
-        case CARQUET_PHYSICAL_FLOAT:
-            return 4;
-        case CARQUET_PHYSICAL_INT64:
-        case CARQUET_PHYSICAL_DOUBLE:
-            return 8;
-        case CARQUET_PHYSICAL_INT96:
-            return 12;
-        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
-            return type_length;
-        case CARQUET_PHYSICAL_BYTE_ARRAY:
-            return sizeof(carquet_byte_array_t);
-        default:
-            return 0;
+/**
+ * Map an absolute file offset to in-memory bytes: the mmap'd (or caller
+ * supplied) buffer, or the column chunk fetched by the pread path.
+ * Returns NULL if the offset is not covered; *available is the number of
+ * bytes readable from the returned pointer.
+ */
+static const uint8_t* resolve_file_bytes(
+    const carquet_column_reader_t* reader,
+    int64_t offset,
+    size_t* available) {
+
+    const carquet_reader_t* file_reader = reader->file_reader;
+
+    if (file_reader->mmap_data) {
+        if (offset < 0 || (uint64_t)offset >= file_reader->file_size) {
+            return NULL;
+        }
+        *available = file_reader->file_size - (size_t)offset;
+        return file_reader->mmap_data + offset;
+    }
+
+    if (reader->chunk_data &&
+        offset >= reader->chunk_offset &&
+        offset < reader->chunk_offset + reader->chunk_length) {
+        *available = (size_t)(reader->chunk_offset + reader->chunk_length - offset);
+        return reader->chunk_data + (offset - reader->chunk_offset);
     }
+
+    return NULL;
+}
+
+/**
+ * Parse a page header from in-memory file bytes and check that the page
+ * body lies within the same memory.
+ */
+static carquet_status_t parse_page_header_in_memory(
+    const carquet_column_reader_t* reader,
+    int64_t offset,
+    const uint8_t** header_ptr,
+    parquet_page_header_t* page_header,
+    size_t* header_size,
+    carquet_error_t* error) {
+
+    size_t available;
+    const uint8_t* ptr = resolve_file_bytes(reader, offset, &available);
+    if (!ptr) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE,
+            "Page offset %lld outside column data", (long long)offset);
+        return CARQUET_ERROR_INVALID_PAGE;
+    }
+
+    carquet_status_t status = parquet_parse_page_header(
+        ptr, available, page_header, header_size, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    if (page_header->compressed_page_size < 0 ||
+        (size_t)page_header->compressed_page_size > available - *header_size) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE,
+            "Page at offset %lld extends past column data", (long long)offset);
+        return CARQUET_ERROR_INVALID_PAGE;
+    }
+
+    *header_ptr = ptr;
+    return CARQUET_OK;
 }
 
 /* ============================================================================
- * Helper: Load dictionary page (mmap path)
+ * Helper: Load dictionary page (in-memory path: mmap, buffer or fetched chunk)
  * ============================================================================
  */
 
-static carquet_status_t load_dictionary_page_mmap(
+static carquet_status_t load_dictionary_page_memory(
     carquet_column_reader_t* reader,
     carquet_error_t* error) {
 
     carquet_reader_t* file_reader = reader->file_reader;
-    const uint8_t* mmap_data = file_reader->mmap_data;
     const parquet_column_metadata_t* col_meta = reader->col_meta;
 
-    /* Parse page header directly from mmap */
+    /* Parse page header directly from memory */
     int64_t dict_offset = col_meta->dictionary_page_offset;
-    const uint8_t* header_ptr = mmap_data + dict_offset;
+    const uint8_t* header_ptr;
+
+    carquet_mmap_chunk_advance(reader, dict_offset);
 
     parquet_page_header_t page_header;
     size_t header_size;
-    carquet_status_t status = parquet_parse_page_header(
-        header_ptr, 256, &page_header, &header_size, error);
+    carquet_status_t status = parse_page_header_in_memory(
+        reader, dict_offset, &header_ptr, &page_header, &header_size, error);
     if (status != CARQUET_OK) {
         return status;
     }
@@ -588,7 +1303,7 @@ static carquet_status_t load_dictionary_page_mmap(
     uint8_t* decompressed = NULL;
 
     if (col_meta->codec == CARQUET_COMPRESSION_UNCOMPRESSED) {
-        /* Zero-copy: point directly to mmap data */
+        /* Zero-copy: point directly to in-memory file data */
         page_data = compressed;
         page_size = page_header.compressed_page_size;
     } else {
@@ -630,36 +1345,59 @@ static carquet_status_t load_dictionary_page_mmap(
 }
 
 /* ============================================================================
- * Helper: Load dictionary page (fread path)
+ * Helper: Read and parse a page header at a file offset (pread path)
  * ============================================================================
  */
 
-static carquet_status_t load_dictionary_page_fread(
-    carquet_column_reader_t* reader,
+/* Page headers are small Thrift structs; probe this many bytes and let the
+ * parser report how many it actually consumed. */
+#define PAGE_HEADER_PROBE_SIZE 256
+
+static carquet_status_t read_page_header_at(
+    carquet_reader_t* file_reader,
+    int64_t offset,
+    parquet_page_header_t* page_header,
+    size_t* header_size,
     carquet_error_t* error) {
 
-    carquet_reader_t* file_reader = reader->file_reader;
-    FILE* file = file_reader->file;
-    const parquet_column_metadata_t* col_meta = reader->col_meta;
+    if (offset < 0 || (uint64_t)offset >= file_reader->file_size) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ,
+            "Page offset %lld outside file", (long long)offset);
+        return CARQUET_ERROR_FILE_READ;
+    }
 
-    /* Seek to dictionary page */
-    if (fseek(file, col_meta->dictionary_page_offset, SEEK_SET) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek to dictionary");
-        return CARQUET_ERROR_FILE_SEEK;
+    /* Clamp the probe to the end of the file */
+    uint8_t header_buf[PAGE_HEADER_PROBE_SIZE];
+    size_t probe = file_reader->file_size - (size_t)offset;
+    if (probe > sizeof(header_buf)) {
+        probe = sizeof(header_buf);
     }
 
-    /* Read page header */
-    uint8_t header_buf[256];
-    size_t header_read = fread(header_buf, 1, sizeof(header_buf), file);
-    if (header_read < 8) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read dictionary header");
-        return CARQUET_ERROR_FILE_READ;
+    carquet_status_t status = carquet_io_read_at(file_reader, offset, probe, header_buf, error);
+    if (status != CARQUET_OK) {
+        return status;
     }
 
+    return parquet_parse_page_header(header_buf, probe, page_header, header_size, error);
+}
+
+/* ============================================================================
+ * Helper: Load dictionary page (pread path)
+ * ============================================================================
+ */
+
+static carquet_status_t load_dictionary_page_pread(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error) {
+
+    carquet_reader_t* file_reader = reader->file_reader;
+    const parquet_column_metadata_t* col_meta = reader->col_meta;
+
+    /* Read page header */
     parquet_page_header_t page_header;
     size_t header_size;
-    carquet_status_t status = parquet_parse_page_header(
-        header_buf, header_read, &page_header, &header_size, error);
+    carquet_status_t status = read_page_header_at(
+        file_reader, col_meta->dictionary_page_offset, &page_header, &header_size, error);
     if (status != CARQUET_OK) {
         return status;
     }
@@ -669,12 +1407,6 @@ static carquet_status_t load_dictionary_page_fread(
         return CARQUET_ERROR_INVALID_PAGE;
     }
 
-    /* Seek past header and read page data */
-    if (fseek(file, col_meta->dictionary_page_offset + (long)header_size, SEEK_SET) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek past dict header");
-        return CARQUET_ERROR_FILE_SEEK;
-    }
-
     /* Allocate and read compressed data */
     uint8_t* compressed = malloc(page_header.compressed_page_size);
     if (!compressed) {
@@ -682,11 +1414,13 @@ static carquet_status_t load_dictionary_page_fread(
         return CARQUET_ERROR_OUT_OF_MEMORY;
     }
 
-    if (fread(compressed, 1, page_header.compressed_page_size, file) !=
-        (size_t)page_header.compressed_page_size) {
+    status = carquet_io_read_at(file_reader,
+        col_meta->dictionary_page_offset + (int64_t)header_size,
+        (size_t)page_header.compressed_page_size, compressed, error);
+    if (status != CARQUET_OK) {
         free(compressed);
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read dictionary data");
-        return CARQUET_ERROR_FILE_READ;
+        CARQUET_SET_ERROR(error, status, "Failed to read dictionary data");
+        return status;
     }
 
     /* Verify CRC32 if present */
@@ -734,54 +1468,190 @@ static carquet_status_t load_dictionary_page_fread(
         reader, page_data, page_size,
         &page_header.dictionary_page_header, error);
 
-    /* Compute actual first data page offset from dictionary page layout.
-     * Some writers (e.g. DuckDB) set data_page_offset incorrectly for
-     * dictionary-encoded columns. The reliable offset is always right
-     * after the dictionary page: dict_offset + header + compressed data. */
-    if (status == CARQUET_OK) {
-        reader->data_start_offset = col_meta->dictionary_page_offset +
-                                    (int64_t)header_size +
-                                    page_header.compressed_page_size;
+    /* Compute actual first data page offset from dictionary page layout.
+     * Some writers (e.g. DuckDB) set data_page_offset incorrectly for
+     * dictionary-encoded columns. The reliable offset is always right
+     * after the dictionary page: dict_offset + header + compressed data. */
+    if (status == CARQUET_OK) {
+        reader->data_start_offset = col_meta->dictionary_page_offset +
+                                    (int64_t)header_size +
+                                    page_header.compressed_page_size;
+    }
+
+    if (page_data != compressed) {
+        free(page_data);
+    } else {
+        free(compressed);
+    }
+
+    return status;
+}
+
+/* ============================================================================
+ * Helper: Load and decode a new page (in-memory path with zero-copy support)
+ * ============================================================================
+ */
+
+/**
+ * Arrays of the read that triggers a page load. When the read takes the
+ * whole page, the page is decoded straight into them instead of the
+ * reader's staging buffers, and used is set.
+ */
+typedef struct page_target {
+    void* values;
+    int16_t* def_levels;        /* NULL: levels go to staging */
+    int16_t* rep_levels;
+    uint8_t* validity;          /* Def levels as bits (validity_levels) */
+    int64_t validity_offset;
+    int64_t capacity;           /* Entries the arrays hold */
+    bool as_indices;            /* values takes dictionary indices */
+    bool used;
+} page_target_t;
+
+/**
+ * Decide where and how the next page's values are kept: in dictionary
+ * output mode a dictionary-encoded page keeps its indices, and a page the
+ * read takes in full goes to the target.
+ */
+static void begin_page_values(
+    carquet_column_reader_t* reader,
+    carquet_encoding_t encoding,
+    int32_t num_values,
+    page_target_t* target) {
+
+    reader->page_is_indices = reader->dictionary_indices &&
+        reader->type != CARQUET_PHYSICAL_BOOLEAN &&
+        (encoding == CARQUET_ENCODING_RLE_DICTIONARY ||
+         encoding == CARQUET_ENCODING_PLAIN_DICTIONARY);
+
+    /* A page read in full is never revisited, so values it would keep as
+     * indices can be looked up while decoding */
+    if (target && reader->page_skip == 0 && num_values <= target->capacity &&
+        (!target->as_indices || reader->page_is_indices) &&
+        !(reader->validity_levels && target->def_levels)) {
+        reader->page_is_indices = target->as_indices;
+        target->used = true;
+    }
+}
+
+/** Whether the page needs the staging buffers (levels the target lacks). */
+static bool page_needs_staging(const carquet_column_reader_t* reader,
+                               const page_target_t* target) {
+    if (!target || !target->used) {
+        return true;
+    }
+    bool def_missing = reader->validity_levels ? !target->validity : !target->def_levels;
+    return (reader->max_def_level > 0 && def_missing) ||
+           (reader->max_rep_level > 0 && !target->rep_levels);
+}
+
+/**
+ * Make the staging buffers hold num_values entries. Def levels are staged
+ * as bits for validity_levels readers.
+ */
+static carquet_status_t grow_staging(
+    carquet_column_reader_t* reader,
+    int32_t num_values,
+    size_t value_size,
+    carquet_error_t* error) {
+
+    if ((size_t)num_values <= reader->decoded_capacity) {
+        return CARQUET_OK;
     }
 
-    if (page_data != compressed) {
-        free(page_data);
+    free(reader->decoded_values);
+    free(reader->decoded_def_levels);
+    free(reader->decoded_validity);
+    free(reader->decoded_rep_levels);
+    reader->decoded_def_levels = NULL;
+    reader->decoded_validity = NULL;
+
+    reader->decoded_values = malloc(value_size * (size_t)num_values);
+    if (reader->validity_levels) {
+        reader->decoded_validity = malloc(((size_t)num_values + 7) / 8);
     } else {
-        free(compressed);
+        reader->decoded_def_levels = malloc(sizeof(int16_t) * num_values);
     }
+    reader->decoded_rep_levels = malloc(sizeof(int16_t) * num_values);
+    reader->decoded_capacity = num_values;
 
-    return status;
+    if (!reader->decoded_values || !reader->decoded_rep_levels ||
+        (!reader->decoded_def_levels && !reader->decoded_validity)) {
+        free(reader->decoded_values);
+        free(reader->decoded_def_levels);
+        free(reader->decoded_validity);
+        free(reader->decoded_rep_levels);
+        reader->decoded_values = NULL;
+        reader->decoded_def_levels = NULL;
+        reader->decoded_validity = NULL;
+        reader->decoded_rep_levels = NULL;
+        reader->decoded_capacity = 0;
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate decode buffers");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    return CARQUET_OK;
 }
 
-/* ============================================================================
- * Helper: Load and decode a new page (mmap path with zero-copy support)
- * ============================================================================
+/**
+ * Arrays the page decodes into. Levels a page decoded in place does not
+ * hand out are not decoded at all when the column has none. Index slots
+ * the page leaves unwritten (nulls) are zeroed so that gathering them
+ * later stays in bounds.
  */
+static void page_outputs(
+    carquet_column_reader_t* reader,
+    int32_t num_values,
+    const page_target_t* target,
+    uint8_t** values,
+    int16_t** def_levels,
+    int16_t** rep_levels) {
+
+    bool in_place = target && target->used;
+    *values = in_place ? (uint8_t*)target->values : reader->decoded_values;
+    *def_levels = in_place && target->def_levels ? target->def_levels : reader->decoded_def_levels;
+    *rep_levels = in_place && target->rep_levels ? target->rep_levels : reader->decoded_rep_levels;
+    if (in_place && !target->def_levels && reader->max_def_level == 0) *def_levels = NULL;
+    if (in_place && !target->rep_levels && reader->max_rep_level == 0) *rep_levels = NULL;
+
+    if (reader->validity_levels) {
+        *def_levels = NULL;
+        bool to_target = in_place && target->validity;
+        reader->page_validity = to_target ? target->validity : reader->decoded_validity;
+        reader->page_validity_offset = to_target ? target->validity_offset : 0;
+    }
+
+    if (reader->page_is_indices && reader->page_skip < num_values) {
+        memset((uint32_t*)*values + reader->page_skip, 0,
+               (size_t)(num_values - reader->page_skip) * sizeof(uint32_t));
+    }
+}
 
-static carquet_status_t load_next_page_mmap(
+static carquet_status_t load_next_page_memory(
     carquet_column_reader_t* reader,
+    page_target_t* target,
     carquet_error_t* error) {
 
     carquet_reader_t* file_reader = reader->file_reader;
-    const uint8_t* mmap_data = file_reader->mmap_data;
     const parquet_column_metadata_t* col_meta = reader->col_meta;
 
     /* Load dictionary if needed (may update data_start_offset) */
     if (col_meta->has_dictionary_page_offset && !reader->has_dictionary) {
-        carquet_status_t status = load_dictionary_page_mmap(reader, error);
+        carquet_status_t status = load_dictionary_page_memory(reader, error);
         if (status != CARQUET_OK) {
             return status;
         }
     }
 
-    /* Parse page header directly from mmap */
+    /* Parse page header directly from memory */
     int64_t page_offset = reader->data_start_offset + reader->current_page;
-    const uint8_t* header_ptr = mmap_data + page_offset;
+    const uint8_t* header_ptr;
+
+    carquet_mmap_chunk_advance(reader, page_offset);
 
     parquet_page_header_t page_header;
     size_t header_size;
-    carquet_status_t status = parquet_parse_page_header(
-        header_ptr, 256, &page_header, &header_size, error);
+    carquet_status_t status = parse_page_header_in_memory(
+        reader, page_offset, &header_ptr, &page_header, &header_size, error);
     if (status != CARQUET_OK) {
         return status;
     }
@@ -791,8 +1661,9 @@ static carquet_status_t load_next_page_mmap(
         return CARQUET_ERROR_INVALID_PAGE;
     }
 
-    /* Get pointer to page data in mmap */
+    /* Get pointer to page data in memory */
     const uint8_t* page_data_ptr = header_ptr + header_size;
+    bool is_v2 = page_header.type == CARQUET_PAGE_DATA_V2;
 
     /* Verify CRC32 if present */
     if (page_header.has_crc && file_reader->options.verify_checksums) {
@@ -806,21 +1677,36 @@ static carquet_status_t load_next_page_mmap(
         }
     }
 
-    int32_t num_values = page_header.data_page_header.num_values;
+    int32_t num_values = is_v2 ? page_header.data_page_header_v2.num_values
+                               : page_header.data_page_header.num_values;
+    carquet_encoding_t encoding = is_v2 ? page_header.data_page_header_v2.encoding
+                                        : page_header.data_page_header.encoding;
     size_t value_size = get_value_size(reader->type, reader->type_length);
 
+    /* V2 pages may store their values uncompressed whatever the codec */
+    carquet_compression_t codec = col_meta->codec;
+    if (is_v2 && !page_header.data_page_header_v2.is_compressed) {
+        codec = CARQUET_COMPRESSION_UNCOMPRESSED;
+    }
+
     /* Check if zero-copy is possible */
     bool zero_copy_eligible = carquet_page_is_zero_copy_eligible(
-        col_meta->codec,
-        page_header.data_page_header.encoding,
-        reader->type);
+        codec, encoding, reader->type);
 
     /* Additional constraint: no definition/repetition levels for zero-copy
      * (levels require RLE decoding which modifies data layout) */
     bool has_levels = (reader->max_def_level > 0 || reader->max_rep_level > 0);
+    if (is_v2 && (page_header.data_page_header_v2.definition_levels_byte_length != 0 ||
+                  page_header.data_page_header_v2.repetition_levels_byte_length != 0)) {
+        has_levels = true;
+    }
 
-    if (zero_copy_eligible && !has_levels) {
+    /* Views are only handed out for mmap/buffer readers, whose memory lives
+     * as long as the file reader; fetched chunks are decoded into owned
+     * buffers like any other page. */
+    if (zero_copy_eligible && !has_levels && file_reader->mmap_data != NULL) {
         /* ====== ZERO-COPY PATH ====== */
+        reader->page_is_indices = false;
 
         /* Free previous owned buffer if any */
         if (reader->decoded_ownership == CARQUET_DATA_OWNED) {
@@ -847,7 +1733,8 @@ static carquet_status_t load_next_page_mmap(
 
         reader->page_loaded = true;
         reader->page_num_values = num_values;
-        reader->page_values_read = 0;
+        reader->page_values_read = reader->page_skip < num_values ? reader->page_skip : num_values;
+        reader->page_skip = 0;
         reader->page_header_size = (int32_t)header_size;
         reader->page_compressed_size = page_header.compressed_page_size;
 
@@ -860,7 +1747,8 @@ static carquet_status_t load_next_page_mmap(
     size_t page_size;
     uint8_t* decompressed = NULL;
 
-    if (col_meta->codec == CARQUET_COMPRESSION_UNCOMPRESSED) {
+    /* V2 pages decompress their values section while decoding */
+    if (is_v2 || col_meta->codec == CARQUET_COMPRESSION_UNCOMPRESSED) {
         page_data = page_data_ptr;
         page_size = page_header.compressed_page_size;
     } else {
@@ -890,60 +1778,60 @@ static carquet_status_t load_next_page_mmap(
         reader->decoded_capacity = 0;
     }
 
-    size_t values_buffer_size = value_size * (size_t)num_values;
-    if ((size_t)num_values > reader->decoded_capacity) {
-        free(reader->decoded_values);
-        free(reader->decoded_def_levels);
-        free(reader->decoded_rep_levels);
-
-        reader->decoded_values = malloc(values_buffer_size);
-        reader->decoded_def_levels = malloc(sizeof(int16_t) * num_values);
-        reader->decoded_rep_levels = malloc(sizeof(int16_t) * num_values);
-        reader->decoded_capacity = num_values;
-
-        if (!reader->decoded_values || !reader->decoded_def_levels || !reader->decoded_rep_levels) {
-            free(reader->decoded_values);
-            free(reader->decoded_def_levels);
-            free(reader->decoded_rep_levels);
-            reader->decoded_values = NULL;
-            reader->decoded_def_levels = NULL;
-            reader->decoded_rep_levels = NULL;
-            reader->decoded_capacity = 0;
+    begin_page_values(reader, encoding, num_values, target);
+    if (page_needs_staging(reader, target)) {
+        status = grow_staging(reader, num_values, value_size, error);
+        if (status != CARQUET_OK) {
             free(decompressed);
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate decode buffers");
-            return CARQUET_ERROR_OUT_OF_MEMORY;
+            return status;
         }
     }
     reader->decoded_ownership = CARQUET_DATA_OWNED;
 
     /* Decode the page */
+    uint8_t* out_values;
+    int16_t* out_def_levels;
+    int16_t* out_rep_levels;
+    page_outputs(reader, num_values, target, &out_values, &out_def_levels, &out_rep_levels);
     int64_t decoded_count;
-    status = carquet_read_data_page_v1(
-        reader, page_data, page_size,
-        &page_header.data_page_header,
-        reader->decoded_values, num_values,
-        reader->decoded_def_levels, reader->decoded_rep_levels,
-        &decoded_count, error);
-
-    /* For BYTE_ARRAY PLAIN columns with compressed data, retain the
-     * decompressed buffer since carquet_byte_array_t.data pointers
-     * reference it. For uncompressed mmap, pointers go directly to mmap
-     * which persists for the reader's lifetime, so no retention needed. */
-    if (decompressed && reader->type == CARQUET_PHYSICAL_BYTE_ARRAY &&
-        page_header.data_page_header.encoding == CARQUET_ENCODING_PLAIN) {
-        free(reader->page_data_for_values);
-        reader->page_data_for_values = decompressed;
+    if (is_v2) {
+        status = carquet_read_data_page_v2(
+            reader, page_data, page_size, &page_header, col_meta->codec,
+            out_values, num_values, reader->page_skip,
+            out_def_levels, out_rep_levels,
+            &decoded_count, &decompressed, error);
+    } else {
+        status = carquet_read_data_page_v1(
+            reader, page_data, page_size,
+            &page_header.data_page_header,
+            out_values, num_values, reader->page_skip,
+            out_def_levels, out_rep_levels,
+            &decoded_count, error);
+    }
+
+    /* For BYTE_ARRAY PLAIN and DELTA_LENGTH_BYTE_ARRAY columns with
+     * compressed data, retain the decompressed buffer since
+     * carquet_byte_array_t.data pointers reference it. For uncompressed
+     * data, pointers go directly to the mmap or fetched chunk, which
+     * outlive the page, so no retention needed. */
+    if (decompressed && views_page_data(reader, encoding)) {
+        retain_page_data(reader, decompressed);
     } else {
         free(decompressed);
     }
 
     if (status != CARQUET_OK) {
+        if (target) {
+            target->used = false;
+        }
         return status;
     }
 
     reader->page_loaded = true;
     reader->page_num_values = (int32_t)decoded_count;
-    reader->page_values_read = 0;
+    reader->page_values_read = reader->page_skip < decoded_count && !(target && target->used)
+        ? reader->page_skip : (int32_t)decoded_count;
+    reader->page_skip = 0;
     reader->page_header_size = (int32_t)header_size;
     reader->page_compressed_size = page_header.compressed_page_size;
 
@@ -951,45 +1839,32 @@ static carquet_status_t load_next_page_mmap(
 }
 
 /* ============================================================================
- * Helper: Load and decode a new page (fread path)
+ * Helper: Load and decode a new page (pread path)
  * ============================================================================
  */
 
-static carquet_status_t load_next_page_fread(
+static carquet_status_t load_next_page_pread(
     carquet_column_reader_t* reader,
+    page_target_t* target,
     carquet_error_t* error) {
 
     carquet_reader_t* file_reader = reader->file_reader;
-    FILE* file = file_reader->file;
     const parquet_column_metadata_t* col_meta = reader->col_meta;
 
     /* Load dictionary if needed (may update data_start_offset) */
     if (col_meta->has_dictionary_page_offset && !reader->has_dictionary) {
-        carquet_status_t status = load_dictionary_page_fread(reader, error);
+        carquet_status_t status = load_dictionary_page_pread(reader, error);
         if (status != CARQUET_OK) {
             return status;
         }
     }
 
-    /* Seek to data page */
-    int64_t data_offset = reader->data_start_offset;
-    if (fseek(file, data_offset + reader->current_page, SEEK_SET) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek to data page");
-        return CARQUET_ERROR_FILE_SEEK;
-    }
-
     /* Read page header */
-    uint8_t header_buf[256];
-    size_t header_read = fread(header_buf, 1, sizeof(header_buf), file);
-    if (header_read < 8) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read page header");
-        return CARQUET_ERROR_FILE_READ;
-    }
-
+    int64_t data_offset = reader->data_start_offset;
     parquet_page_header_t page_header;
     size_t header_size;
-    carquet_status_t status = parquet_parse_page_header(
-        header_buf, header_read, &page_header, &header_size, error);
+    carquet_status_t status = read_page_header_at(
+        file_reader, data_offset + reader->current_page, &page_header, &header_size, error);
     if (status != CARQUET_OK) {
         return status;
     }
@@ -999,12 +1874,6 @@ static carquet_status_t load_next_page_fread(
         return CARQUET_ERROR_INVALID_PAGE;
     }
 
-    /* Seek past header and read page data */
-    if (fseek(file, data_offset + reader->current_page + (long)header_size, SEEK_SET) != 0) {
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_SEEK, "Failed to seek past header");
-        return CARQUET_ERROR_FILE_SEEK;
-    }
-
     /* Allocate and read compressed data */
     uint8_t* compressed = malloc(page_header.compressed_page_size);
     if (!compressed) {
@@ -1012,11 +1881,13 @@ static carquet_status_t load_next_page_fread(
         return CARQUET_ERROR_OUT_OF_MEMORY;
     }
 
-    if (fread(compressed, 1, page_header.compressed_page_size, file) !=
-        (size_t)page_header.compressed_page_size) {
+    status = carquet_io_read_at(file_reader,
+        data_offset + reader->current_page + (int64_t)header_size,
+        (size_t)page_header.compressed_page_size, compressed, error);
+    if (status != CARQUET_OK) {
         free(compressed);
-        CARQUET_SET_ERROR(error, CARQUET_ERROR_FILE_READ, "Failed to read page data");
-        return CARQUET_ERROR_FILE_READ;
+        CARQUET_SET_ERROR(error, status, "Failed to read page data");
+        return status;
     }
 
     /* Verify CRC32 if present */
@@ -1032,11 +1903,13 @@ static carquet_status_t load_next_page_fread(
         }
     }
 
-    /* Decompress if needed */
+    /* Decompress if needed (V2 pages decompress their values section
+     * while decoding) */
+    bool is_v2 = page_header.type == CARQUET_PAGE_DATA_V2;
     uint8_t* page_data;
     size_t page_size;
 
-    if (col_meta->codec == CARQUET_COMPRESSION_UNCOMPRESSED) {
+    if (is_v2 || col_meta->codec == CARQUET_COMPRESSION_UNCOMPRESSED) {
         page_data = compressed;
         page_size = page_header.compressed_page_size;
     } else {
@@ -1068,54 +1941,56 @@ static carquet_status_t load_next_page_fread(
     reader->decoded_ownership = CARQUET_DATA_OWNED;
 
     /* Allocate buffers for decoded page data */
-    int32_t num_values = page_header.data_page_header.num_values;
+    int32_t num_values = is_v2 ? page_header.data_page_header_v2.num_values
+                               : page_header.data_page_header.num_values;
+    carquet_encoding_t encoding = is_v2 ? page_header.data_page_header_v2.encoding
+                                        : page_header.data_page_header.encoding;
     size_t value_size = get_value_size(reader->type, reader->type_length);
-    size_t values_buffer_size = value_size * (size_t)num_values;
 
     /* Ensure we have enough buffer capacity */
-    if ((size_t)num_values > reader->decoded_capacity) {
-        free(reader->decoded_values);
-        free(reader->decoded_def_levels);
-        free(reader->decoded_rep_levels);
-
-        reader->decoded_values = malloc(values_buffer_size);
-        reader->decoded_def_levels = malloc(sizeof(int16_t) * num_values);
-        reader->decoded_rep_levels = malloc(sizeof(int16_t) * num_values);
-        reader->decoded_capacity = num_values;
-
-        if (!reader->decoded_values || !reader->decoded_def_levels || !reader->decoded_rep_levels) {
-            free(reader->decoded_values);
-            free(reader->decoded_def_levels);
-            free(reader->decoded_rep_levels);
-            reader->decoded_values = NULL;
-            reader->decoded_def_levels = NULL;
-            reader->decoded_rep_levels = NULL;
-            reader->decoded_capacity = 0;
+    begin_page_values(reader, encoding, num_values, target);
+    if (page_needs_staging(reader, target)) {
+        status = grow_staging(reader, num_values, value_size, error);
+        if (status != CARQUET_OK) {
             if (page_data != compressed) free(page_data);
             if (compressed) free(compressed);
-            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate decode buffers");
-            return CARQUET_ERROR_OUT_OF_MEMORY;
+            return status;
         }
     }
 
-    /* Decode the entire page into our buffers */
+    /* Decode the entire page into the target or our buffers */
+    uint8_t* out_values;
+    int16_t* out_def_levels;
+    int16_t* out_rep_levels;
+    page_outputs(reader, num_values, target, &out_values, &out_def_levels, &out_rep_levels);
     int64_t decoded_count;
-    status = carquet_read_data_page_v1(
-        reader, page_data, page_size,
-        &page_header.data_page_header,
-        reader->decoded_values, num_values,
-        reader->decoded_def_levels, reader->decoded_rep_levels,
-        &decoded_count, error);
+    if (is_v2) {
+        uint8_t* values_buffer = NULL;
+        status = carquet_read_data_page_v2(
+            reader, page_data, page_size, &page_header, col_meta->codec,
+            out_values, num_values, reader->page_skip,
+            out_def_levels, out_rep_levels,
+            &decoded_count, &values_buffer, error);
+        if (values_buffer) {
+            page_data = values_buffer;  /* Views point here, not at the raw page */
+        }
+    } else {
+        status = carquet_read_data_page_v1(
+            reader, page_data, page_size,
+            &page_header.data_page_header,
+            out_values, num_values, reader->page_skip,
+            out_def_levels, out_rep_levels,
+            &decoded_count, error);
+    }
 
-    /* For BYTE_ARRAY PLAIN columns, the decoded carquet_byte_array_t structs
-     * have .data pointers into the page data buffer. Retain the buffer so
-     * these pointers remain valid until the next page is loaded. */
-    bool retain = (reader->type == CARQUET_PHYSICAL_BYTE_ARRAY &&
-                   page_header.data_page_header.encoding == CARQUET_ENCODING_PLAIN);
+    /* For BYTE_ARRAY PLAIN and DELTA_LENGTH_BYTE_ARRAY columns, the decoded
+     * carquet_byte_array_t structs have .data pointers into the page data
+     * buffer. Retain the buffer so these pointers remain valid for the
+     * rest of the batch. */
+    bool retain = views_page_data(reader, encoding);
 
     if (retain) {
-        free(reader->page_data_for_values);
-        reader->page_data_for_values = page_data;
+        retain_page_data(reader, page_data);
         /* Free compressed buffer only if it's a separate allocation */
         if (compressed && compressed != page_data) {
             free(compressed);
@@ -1130,13 +2005,18 @@ static carquet_status_t load_next_page_fread(
     }
 
     if (status != CARQUET_OK) {
+        if (target) {
+            target->used = false;
+        }
         return status;
     }
 
-    /* Update page tracking state */
+    /* Update page tracking state; a page decoded into the target is read */
     reader->page_loaded = true;
     reader->page_num_values = (int32_t)decoded_count;
-    reader->page_values_read = 0;
+    reader->page_values_read = reader->page_skip < decoded_count && !(target && target->used)
+        ? reader->page_skip : (int32_t)decoded_count;
+    reader->page_skip = 0;
     reader->page_header_size = (int32_t)header_size;
     reader->page_compressed_size = page_header.compressed_page_size;
 
@@ -1150,21 +2030,251 @@ static carquet_status_t load_next_page_fread(
 
 static carquet_status_t load_next_page(
     carquet_column_reader_t* reader,
+    page_target_t* target,
     carquet_error_t* error) {
 
     carquet_reader_t* file_reader = reader->file_reader;
 
-    /* Use mmap/buffer path if memory-mapped or buffer-based reader */
+    /* Use in-memory path if memory-mapped or buffer-based reader */
     if (file_reader->mmap_data != NULL) {
-        return load_next_page_mmap(reader, error);
+        return load_next_page_memory(reader, target, error);
+    }
+
+    /* Otherwise positional reads (requires a file handle or input source) */
+    if (!carquet_io_is_positional(file_reader)) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_STATE, "No data source available");
+        return CARQUET_ERROR_INVALID_STATE;
+    }
+
+    /* Fetch the whole column chunk with one read, then parse pages from
+     * memory. If the chunk metadata is unusable, or the page lies outside
+     * the advertised range, read that page on its own. After a seek only
+     * the pages actually visited are read. */
+    if (!reader->sparse_reads) {
+        carquet_status_t status = carquet_column_reader_fetch_chunk(reader, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    size_t available;
+    int64_t next_offset = (reader->col_meta->has_dictionary_page_offset && !reader->has_dictionary)
+        ? reader->col_meta->dictionary_page_offset
+        : reader->data_start_offset + reader->current_page;
+    if (resolve_file_bytes(reader, next_offset, &available) != NULL) {
+        return load_next_page_memory(reader, target, error);
+    }
+    return load_next_page_pread(reader, target, error);
+}
+
+/* ============================================================================
+ * Page Seeking (OffsetIndex)
+ * ============================================================================
+ */
+
+static carquet_status_t load_dictionary(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error) {
+
+    size_t available;
+    if (resolve_file_bytes(reader, reader->col_meta->dictionary_page_offset, &available)) {
+        return load_dictionary_page_memory(reader, error);
+    }
+    if (!carquet_io_is_positional(reader->file_reader)) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_STATE, "No data source available");
+        return CARQUET_ERROR_INVALID_STATE;
+    }
+    return load_dictionary_page_pread(reader, error);
+}
+
+/**
+ * Count the values preceding each page of the OffsetIndex from the page
+ * headers (for repeated columns, where rows and values differ).
+ */
+static carquet_status_t count_page_values(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error) {
+
+    const parquet_offset_index_t* index = &reader->offset_index;
+    int64_t* before = carquet_arena_calloc(&reader->page_index_arena,
+                                           (size_t)index->num_pages, sizeof(int64_t));
+    if (!before) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate page counts");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    int64_t total = 0;
+    for (int32_t i = 0; i < index->num_pages; i++) {
+        before[i] = total;
+        if (i + 1 == index->num_pages) {
+            break;  /* The last page's count is never needed */
+        }
+
+        int64_t offset = index->page_locations[i].offset;
+        parquet_page_header_t header;
+        size_t header_size;
+        size_t available;
+        const uint8_t* ptr = resolve_file_bytes(reader, offset, &available);
+        carquet_status_t status = ptr
+            ? parquet_parse_page_header(ptr, available, &header, &header_size, error)
+            : read_page_header_at(reader->file_reader, offset, &header, &header_size, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        total += header.type == CARQUET_PAGE_DATA_V2
+            ? header.data_page_header_v2.num_values
+            : header.data_page_header.num_values;
     }
 
-    /* Fall back to fread path (requires valid file handle) */
-    if (file_reader->file == NULL) {
+    reader->page_values_before = before;
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_column_reader_seek_page(
+    carquet_column_reader_t* reader,
+    int32_t page,
+    carquet_error_t* error) {
+
+    const parquet_page_location_t* loc = &reader->offset_index.page_locations[page];
+
+    /* Page positions are relative to the first data page, which is only
+     * known for sure once the dictionary has been read */
+    if (reader->col_meta->has_dictionary_page_offset && !reader->has_dictionary) {
+        carquet_status_t status = load_dictionary(reader, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    int64_t values_before = loc->first_row_index;
+    if (reader->max_rep_level > 0) {
+        if (!reader->page_values_before) {
+            carquet_status_t status = count_page_values(reader, error);
+            if (status != CARQUET_OK) {
+                return status;
+            }
+        }
+        values_before = reader->page_values_before[page];
+    }
+
+    if (loc->offset < reader->data_start_offset || values_before > reader->col_meta->num_values) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_METADATA,
+            "Offset index page %d does not match the column chunk", (int)page);
+        return CARQUET_ERROR_INVALID_METADATA;
+    }
+
+    if (!reader->chunk_data) {
+        reader->sparse_reads = true;
+    }
+
+    reader->page_loaded = false;
+    reader->page_skip = 0;
+    reader->current_page = loc->offset - reader->data_start_offset;
+    reader->values_remaining = reader->col_meta->num_values - values_before;
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Page Skipping
+ * ============================================================================
+ */
+
+/**
+ * Read the header of the next (unloaded) page, which must be a data page,
+ * from memory when the page is there, otherwise with a header-sized read.
+ */
+static carquet_status_t peek_data_page(
+    carquet_column_reader_t* reader,
+    parquet_page_header_t* header,
+    size_t* header_size,
+    carquet_error_t* error) {
+
+    /* Page positions are relative to the first data page */
+    if (reader->col_meta->has_dictionary_page_offset && !reader->has_dictionary) {
+        carquet_status_t status = load_dictionary(reader, error);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    int64_t offset = reader->data_start_offset + reader->current_page;
+    size_t available;
+    carquet_status_t status;
+    const uint8_t* ptr = resolve_file_bytes(reader, offset, &available);
+    if (ptr) {
+        status = parquet_parse_page_header(ptr, available, header, header_size, error);
+    } else if (carquet_io_is_positional(reader->file_reader)) {
+        status = read_page_header_at(reader->file_reader, offset, header, header_size, error);
+    } else {
         CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_STATE, "No data source available");
         return CARQUET_ERROR_INVALID_STATE;
     }
-    return load_next_page_fread(reader, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    if (header->type != CARQUET_PAGE_DATA && header->type != CARQUET_PAGE_DATA_V2) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE, "Expected data page");
+        return CARQUET_ERROR_INVALID_PAGE;
+    }
+    if (header->compressed_page_size < 0) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_PAGE,
+            "Invalid page size at offset %lld", (long long)offset);
+        return CARQUET_ERROR_INVALID_PAGE;
+    }
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_column_reader_skip_page(
+    carquet_column_reader_t* reader,
+    int64_t max_values,
+    int32_t* page_values,
+    carquet_error_t* error) {
+
+    parquet_page_header_t header;
+    size_t header_size;
+    carquet_status_t status = peek_data_page(reader, &header, &header_size, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    *page_values = header.type == CARQUET_PAGE_DATA_V2
+        ? header.data_page_header_v2.num_values
+        : header.data_page_header.num_values;
+
+    if (*page_values <= max_values) {
+        reader->current_page += (int64_t)header_size + header.compressed_page_size;
+    }
+    return CARQUET_OK;
+}
+
+carquet_status_t carquet_column_reader_skip_page_rows(
+    carquet_column_reader_t* reader,
+    int64_t max_rows,
+    int32_t* page_rows,
+    int32_t* page_values,
+    carquet_error_t* error) {
+
+    parquet_page_header_t header;
+    size_t header_size;
+    carquet_status_t status = peek_data_page(reader, &header, &header_size, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    /* Only V2 headers count rows; V1 pages need their levels decoded */
+    if (header.type != CARQUET_PAGE_DATA_V2) {
+        *page_rows = -1;
+        *page_values = header.data_page_header.num_values;
+        return CARQUET_OK;
+    }
+
+    *page_rows = header.data_page_header_v2.num_rows;
+    *page_values = header.data_page_header_v2.num_values;
+    if (*page_rows >= 0 && *page_rows <= max_rows) {
+        reader->current_page += (int64_t)header_size + header.compressed_page_size;
+    }
+    return CARQUET_OK;
 }
 
 /* ============================================================================
@@ -1172,13 +2282,37 @@ static carquet_status_t load_next_page(
  * ============================================================================
  */
 
-carquet_status_t carquet_read_next_page(
+/**
+ * Stream index of the value of entry page_values_read in a packed page.
+ * Entries skipped since the last read are counted forward from there.
+ */
+static int32_t packed_value_index(carquet_column_reader_t* reader) {
+    for (int32_t i = reader->page_value_entry; i < reader->page_values_read; i++) {
+        reader->page_value_index += reader->decoded_def_levels[i] == reader->max_def_level;
+    }
+    reader->page_value_entry = reader->page_values_read;
+    return reader->page_value_index;
+}
+
+/**
+ * Hand out up to max_values entries of the current page, loading the next
+ * page first if needed. A page loaded for a read that takes all of it is
+ * decoded directly into the caller's arrays; only partially read pages are
+ * staged in decoded_values. With as_indices the entries are dictionary
+ * indices; a page without them is left unread (*values_read = 0). A
+ * validity_levels reader can hand out def levels as validity bits, from
+ * bit validity_offset of validity on.
+ */
+static carquet_status_t read_page_entries(
     carquet_column_reader_t* reader,
     void* values,
     int64_t max_values,
     int16_t* def_levels,
     int16_t* rep_levels,
+    uint8_t* validity,
+    int64_t validity_offset,
     int64_t* values_read,
+    bool as_indices,
     carquet_error_t* error) {
 
     if (!reader || !values || !values_read) {
@@ -1194,10 +2328,26 @@ carquet_status_t carquet_read_next_page(
             reader->page_loaded = false;
         }
 
-        carquet_status_t status = load_next_page(reader, error);
+        page_target_t target = {
+            values, def_levels, rep_levels, validity, validity_offset,
+            max_values, as_indices, false
+        };
+        carquet_status_t status = load_next_page(reader, &target, error);
         if (status != CARQUET_OK) {
             return status;
         }
+
+        /* Decoded in place: the page went straight to the caller */
+        if (target.used) {
+            reader->values_remaining -= reader->page_num_values;
+            *values_read = reader->page_num_values;
+            return CARQUET_OK;
+        }
+    }
+
+    if (as_indices && !reader->page_is_indices) {
+        *values_read = 0;
+        return CARQUET_OK;
     }
 
     /* Calculate how many values to return from the current page */
@@ -1207,13 +2357,49 @@ carquet_status_t carquet_read_next_page(
         to_copy = available;
     }
 
-    /* Copy values from decoded buffers */
-    size_t value_size = get_value_size(reader->type, reader->type_length);
-    size_t offset = (size_t)reader->page_values_read * value_size;
+    /* Packed pages hold only the values of present entries, so the entries
+     * handed out map to fewer values, further back in decoded_values */
+    int32_t first_value = reader->page_values_read;
+    int32_t num_copy = to_copy;
+    if (!reader->spaced_values && reader->max_def_level > 0) {
+        first_value = packed_value_index(reader);
+        num_copy = 0;
+        for (int32_t i = 0; i < to_copy; i++) {
+            num_copy += reader->decoded_def_levels[reader->page_values_read + i] ==
+                        reader->max_def_level;
+        }
+        reader->page_value_entry += to_copy;
+        reader->page_value_index += num_copy;
+    }
 
-    memcpy(values, (uint8_t*)reader->decoded_values + offset, (size_t)to_copy * value_size);
+    /* Copy values from decoded buffers; kept indices are looked up only
+     * when values are asked for */
+    if (reader->page_is_indices) {
+        const uint32_t* indices = (const uint32_t*)reader->decoded_values + first_value;
+        if (as_indices) {
+            memcpy(values, indices, (size_t)num_copy * sizeof(uint32_t));
+        } else if (reader->dictionary_count > 0) {
+            carquet_column_reader_gather_dictionary(reader, indices, num_copy, values);
+        } else {
+            /* All entries are null */
+            memset(values, 0, (size_t)num_copy * get_value_size(reader->type, reader->type_length));
+        }
+    } else {
+        size_t value_size = get_value_size(reader->type, reader->type_length);
+        size_t offset = (size_t)first_value * value_size;
+        memcpy(values, (uint8_t*)reader->decoded_values + offset, (size_t)num_copy * value_size);
+    }
 
-    if (def_levels) {
+    if (reader->validity_levels) {
+        if (validity) {
+            carquet_bitmap_copy(validity, validity_offset, reader->decoded_validity,
+                                reader->page_values_read, to_copy);
+        }
+        for (int32_t i = 0; def_levels && i < to_copy; i++) {
+            int64_t bit = reader->page_values_read + i;
+            def_levels[i] = (int16_t)((reader->decoded_validity[bit / 8] >> (bit % 8)) & 1);
+        }
+    } else if (def_levels) {
         memcpy(def_levels, reader->decoded_def_levels + reader->page_values_read,
                (size_t)to_copy * sizeof(int16_t));
     }
@@ -1229,3 +2415,43 @@ carquet_status_t carquet_read_next_page(
 
     return CARQUET_OK;
 }
+
+carquet_status_t carquet_read_next_page(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error) {
+
+    return read_page_entries(reader, values, max_values, def_levels, rep_levels,
+                             NULL, 0, values_read, false, error);
+}
+
+carquet_status_t carquet_read_next_page_indices(
+    carquet_column_reader_t* reader,
+    int32_t* indices,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error) {
+
+    return read_page_entries(reader, indices, max_values, def_levels, rep_levels,
+                             NULL, 0, values_read, true, error);
+}
+
+carquet_status_t carquet_read_next_page_validity(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t validity_offset,
+    bool as_indices,
+    int64_t* values_read,
+    carquet_error_t* error) {
+
+    return read_page_entries(reader, values, max_values, NULL, NULL,
+                             validity, validity_offset, values_read, as_indices, error);
+}
@@ -12,6 +12,8 @@
 #include <carquet/carquet.h>
 #include "thrift/parquet_types.h"
 #include "core/arena.h"
+#include "core/thread.h"
+#include "core/pool.h"
 #include <stdio.h>
 
 #ifdef _WIN32
@@ -48,8 +50,75 @@ typedef struct carquet_mmap_info {
     int fd;
 #endif
     bool is_valid;
+
+    /* Residency control (see carquet_mmap_chunk_advance) */
+    carquet_mutex_t advice_mutex;
+    int64_t resident;           /* Bytes advised WILLNEED and not yet released */
+    size_t max_resident;        /* 0 = no cap */
 } carquet_mmap_info_t;
 
+/* ============================================================================
+ * Row Batches (batch_reader.c, arrow_export.c)
+ * ============================================================================
+ */
+
+typedef struct carquet_column_data {
+    void* data;                 /* Column values, one slot per entry */
+    uint8_t* null_bitmap;       /* 1 bit per value: set = null, or set = valid
+                                 * with validity; NULL if there are none */
+    size_t bitmap_capacity;
+    int64_t num_values;         /* Number of values */
+    int64_t null_count;
+    size_t data_capacity;       /* Allocated capacity for data */
+    carquet_physical_type_t type;
+    int32_t type_length;        /* For fixed-length types */
+    carquet_data_ownership_t ownership;  /* OWNED or VIEW (for future zero-copy) */
+    const char* name;           /* Leaf name, owned by the file reader's schema */
+    bool is_string;             /* BYTE_ARRAY annotated as UTF-8 text */
+    bool validity;              /* null_bitmap uses Arrow polarity */
+    int16_t max_def_level;
+    int16_t max_rep_level;
+
+    /* Arrow layout BYTE_ARRAY: value i spans [offsets[i], offsets[i + 1])
+     * of chars; both are owned */
+    int32_t* offsets;
+    uint8_t* chars;
+    size_t offsets_capacity;
+    size_t chars_capacity;
+
+    /* Dictionary output: data holds int32 indices into dictionary, which
+     * is owned by the column reader of the row group */
+    const void* dictionary;
+    int32_t dictionary_size;
+    bool dictionary_changed;
+} carquet_column_data_t;
+
+/* Every owned buffer of a batch is a malloc() block whose size is kept
+ * next to it, so carquet_batch_reader_next_into() can hand the buffers of
+ * the previous batch back to the reader's buffer pool. */
+struct carquet_row_batch {
+    carquet_column_data_t* columns;
+    int32_t num_columns;
+    int32_t column_capacity;    /* Entries allocated in columns */
+    int64_t num_rows;
+    carquet_arena_t arena;
+};
+
+/**
+ * Arrow binary layout of count views: *offsets gets count + 1 int32
+ * offsets into *chars, one run of all their bytes. Both come from pool
+ * (malloc() with a NULL pool); their sizes go to the capacities.
+ * Fails if the bytes do not fit int32 offsets.
+ */
+carquet_status_t carquet_byte_arrays_to_arrow(
+    const carquet_byte_array_t* values,
+    int64_t count,
+    carquet_buffer_pool_t* pool,
+    int32_t** offsets,
+    size_t* offsets_capacity,
+    uint8_t** chars,
+    size_t* chars_capacity);
+
 /* ============================================================================
  * Internal Schema Structure
  * ============================================================================
@@ -68,6 +137,46 @@ struct carquet_schema {
     int16_t* max_rep_levels;    /* Max repetition level per leaf */
 };
 
+/* ============================================================================
+ * Metadata Cache Types
+ * ============================================================================
+ */
+
+/**
+ * Identity of a file's contents in a carquet_metadata_cache_t: a name (path
+ * or caller-supplied key) plus the file size and modification time.
+ */
+typedef struct carquet_metadata_key {
+    const char* name;
+    int64_t size;
+    int64_t mtime;              /* Nanoseconds; 0 for caller-supplied keys */
+} carquet_metadata_key_t;
+
+/**
+ * Parsed footer and schema shared by every reader of the same file.
+ * Immutable once inserted; freed when evicted and no reader holds it.
+ */
+typedef struct carquet_metadata_entry {
+    carquet_metadata_cache_t* cache;
+    char* name;
+    size_t name_len;
+    int64_t size;
+    int64_t mtime;
+    uint64_t hash;
+
+    carquet_arena_t arena;      /* Owns metadata and schema */
+    parquet_file_metadata_t metadata;
+    carquet_schema_t* schema;
+
+    /* Guarded by the cache mutex */
+    size_t bytes;
+    int32_t refcount;
+    bool cached;                /* Linked into the cache index */
+    struct carquet_metadata_entry* hash_next;
+    struct carquet_metadata_entry* lru_prev;
+    struct carquet_metadata_entry* lru_next;
+} carquet_metadata_entry_t;
+
 /* ============================================================================
  * Internal Reader Structure
  * ============================================================================
@@ -77,6 +186,19 @@ struct carquet_reader {
     FILE* file;
     bool owns_file;
 
+    /* OS handle for positional reads (see file_io.c) */
+#ifdef _WIN32
+    HANDLE file_handle;
+#else
+    int fd;
+#endif
+    bool use_io_uring;  /* Bulk reads go through io_uring (io_uring.c) */
+
+    /* Caller-provided byte source (carquet_reader_open_source); when set,
+     * all positional reads go through it instead of the file handle */
+    carquet_input_source_t source;
+    bool has_source;
+
     /* Memory-mapped data */
     const uint8_t* mmap_data;
     size_t file_size;
@@ -86,10 +208,19 @@ struct carquet_reader {
     carquet_arena_t arena;
     parquet_file_metadata_t metadata;
     carquet_schema_t* schema;
+    carquet_metadata_entry_t* metadata_entry;  /* Owner of metadata/schema when
+                                                * opened with a metadata cache */
 
     /* Options */
     carquet_reader_options_t options;
 
+    /* Column chunk bloom filters, loaded on first use (see statistics.c).
+     * One slot per row group and column, allocated with the first load;
+     * a NULL filter in a loaded slot means the chunk has none. */
+    carquet_mutex_t bloom_mutex;
+    carquet_bloom_filter_t** bloom_filters;
+    bool* bloom_loaded;
+
     /* State */
     bool is_open;
 };
@@ -119,6 +250,22 @@ struct carquet_column_reader {
     int64_t data_start_offset;    /* Actual offset of first data page in file */
     int64_t current_page;
 
+    /* Column chunk bytes on the non-mmap path, fetched with a single read.
+     * chunk_data covers file range [chunk_offset, chunk_offset + chunk_length)
+     * and either points into chunk_buffer or is borrowed from a coalesced
+     * read owned by the batch reader. */
+    const uint8_t* chunk_data;
+    int64_t chunk_offset;
+    int64_t chunk_length;
+    uint8_t* chunk_buffer;
+    size_t chunk_buffer_capacity;
+
+    /* mmap residency window over this column chunk (file offsets, see
+     * mmap_reader.c); mmap_chunk_end is 0 until the first page is loaded */
+    int64_t mmap_chunk_end;
+    int64_t mmap_advised_end;
+    int64_t mmap_released_end;
+
     /* Page data */
     uint8_t* page_buffer;
     size_t page_buffer_size;
@@ -130,18 +277,57 @@ struct carquet_column_reader {
     size_t dictionary_size;
     int32_t dictionary_count;
     uint32_t* dictionary_offsets;  /* Offset cache for O(1) BYTE_ARRAY lookup */
+    carquet_byte_array_t* dictionary_values; /* BYTE_ARRAY entries as views, built on demand */
+
+    /* Dictionary output mode (batch reader): dictionary-encoded pages keep
+     * their int32 indices in decoded_values and values are looked up only
+     * when read through carquet_column_read_batch */
+    bool dictionary_indices;
+    bool page_is_indices;       /* decoded_values of the current page hold indices */
+
+    /* Values are written at the slot of their entry, with zeroed slots for
+     * entries below max_def_level, instead of packed (batch reader) */
+    bool spaced_values;
+
+    /* Flat columns with max_def_level 1 (batch reader): def levels are kept
+     * as validity bits, set for present entries, instead of int16 levels.
+     * While a page decodes, its entry i goes to bit page_validity_offset + i
+     * of page_validity (decoded_validity or the caller's bitmap). */
+    bool validity_levels;
+    uint8_t* page_validity;
+    int64_t page_validity_offset;
 
     /* Retained page data for BYTE_ARRAY value pointers */
     uint8_t* page_data_for_values;
 
+    /* DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY pages: value j of the
+     * current page spans [string_offsets[j], string_offsets[j + 1]) of
+     * string_data, which is the page's own bytes or, for prefix-coded
+     * pages, string_buffer */
+    const uint8_t* string_data;
+    int32_t* string_offsets;
+    size_t string_offsets_capacity;
+    uint8_t* string_buffer;
+    size_t string_buffer_capacity;
+
+    /* Buffers of earlier pages that byte array views handed out since the
+     * last batch may still point into; freed when the next batch starts */
+    uint8_t** retired_buffers;
+    int32_t num_retired_buffers;
+    int32_t retired_buffers_capacity;
+
     /* Current page state for partial reads */
     bool page_loaded;           /* Is a page currently loaded? */
     int32_t page_num_values;    /* Total values in current page */
     int32_t page_values_read;   /* Values already read from current page */
     int32_t page_header_size;   /* Size of current page header */
     int32_t page_compressed_size; /* Size of current page compressed data */
+    int32_t page_skip;          /* Leading values of the next page to skip, not decode */
+    int32_t page_value_entry;   /* Packed pages: entry page_value_entry's value */
+    int32_t page_value_index;   /* is value page_value_index of the stream */
     uint8_t* decoded_values;    /* Buffer for decoded values from current page */
     int16_t* decoded_def_levels; /* Buffer for decoded definition levels */
+    uint8_t* decoded_validity;  /* Validity bits instead of them (validity_levels) */
     int16_t* decoded_rep_levels; /* Buffer for decoded repetition levels */
     size_t decoded_capacity;    /* Capacity of decoded buffers */
     carquet_data_ownership_t decoded_ownership; /* OWNED or VIEW (mmap) */
@@ -149,6 +335,14 @@ struct carquet_column_reader {
     /* Reusable buffers to reduce allocations */
     uint32_t* indices_buffer;   /* Reusable buffer for dictionary indices */
     size_t indices_capacity;    /* Capacity of indices buffer */
+
+    /* OffsetIndex of the chunk, loaded by the first carquet_column_seek_row */
+    bool offset_index_loaded;   /* Load attempted; page_index_arena is live */
+    bool has_offset_index;
+    carquet_arena_t page_index_arena;
+    parquet_offset_index_t offset_index;
+    int64_t* page_values_before; /* Values preceding each page (repeated columns) */
+    bool sparse_reads;          /* Read pages one by one instead of fetching the chunk */
 };
 
 /* ============================================================================
@@ -164,9 +358,67 @@ carquet_schema_t* build_schema(
     const parquet_file_metadata_t* metadata,
     carquet_error_t* error);
 
+/**
+ * Cache key for an opened reader, or NULL when it has no metadata cache or
+ * cannot be identified (no caller key and no path). `path` may be NULL.
+ */
+const carquet_metadata_key_t* carquet_reader_cache_key(
+    const carquet_reader_t* reader,
+    const char* path,
+    carquet_metadata_key_t* key);
+
+/**
+ * Parse the Thrift footer and build the schema. With a cache key (and a
+ * metadata cache in the options) the result goes into a shared cache entry,
+ * otherwise into the reader's arena.
+ */
+carquet_status_t carquet_reader_parse_footer(
+    carquet_reader_t* reader,
+    const carquet_metadata_key_t* key,
+    const uint8_t* footer_data,
+    size_t footer_size,
+    carquet_error_t* error);
+
+/**
+ * Use the cached footer for `key` if the reader's metadata cache has it.
+ * Returns true on a hit; the reader then holds a reference to the entry.
+ */
+bool carquet_reader_use_cached_footer(
+    carquet_reader_t* reader,
+    const carquet_metadata_key_t* key);
+
+/**
+ * Look up a parsed footer. On a hit the entry is returned with an extra
+ * reference; NULL on a miss.
+ */
+carquet_metadata_entry_t* carquet_metadata_cache_lookup(
+    carquet_metadata_cache_t* cache,
+    const carquet_metadata_key_t* key);
+
+/**
+ * Create an empty, unlinked entry for `key` holding one reference.
+ */
+carquet_metadata_entry_t* carquet_metadata_entry_create(
+    carquet_metadata_cache_t* cache,
+    const carquet_metadata_key_t* key);
+
+/**
+ * Publish a filled entry, replacing any entry with the same key and
+ * evicting least recently used entries beyond the byte budget. The
+ * caller's reference is kept.
+ */
+void carquet_metadata_cache_insert(
+    carquet_metadata_cache_t* cache,
+    carquet_metadata_entry_t* entry);
+
+/**
+ * Drop one reference to an entry.
+ */
+void carquet_metadata_entry_release(carquet_metadata_entry_t* entry);
+
 /**
  * Open file with memory mapping.
- * Returns mmap_info on success, NULL on failure (fallback to fread).
+ * Returns mmap_info on success, NULL on failure (fallback to pread).
  */
 carquet_mmap_info_t* carquet_mmap_open(const char* path, carquet_error_t* error);
 
@@ -175,6 +427,309 @@ carquet_mmap_info_t* carquet_mmap_open(const char* path, carquet_error_t* error)
  */
 void carquet_mmap_close(carquet_mmap_info_t* mmap_info);
 
+/**
+ * Tell the kernel a column reader on an mmap reader is about to parse the
+ * page at file offset `page_offset`: bytes of its chunk already passed are
+ * dropped from the mapping (MADV_DONTNEED) and the next window of the chunk
+ * is read ahead (MADV_SEQUENTIAL + MADV_WILLNEED), within max_resident.
+ */
+void carquet_mmap_chunk_advance(carquet_column_reader_t* reader, int64_t page_offset);
+
+/**
+ * Release whatever remains of a column reader's chunk window.
+ */
+void carquet_mmap_chunk_end(carquet_column_reader_t* reader);
+
+/**
+ * Bind the positional I/O layer to an open FILE handle and record the
+ * file size. The FILE's own seek position is never used afterwards.
+ */
+carquet_status_t carquet_io_init(
+    carquet_reader_t* reader,
+    FILE* file,
+    carquet_error_t* error);
+
+/**
+ * Bind the positional I/O layer to a caller-provided byte source and record
+ * its size.
+ */
+carquet_status_t carquet_io_init_source(
+    carquet_reader_t* reader,
+    const carquet_input_source_t* source,
+    carquet_error_t* error);
+
+/**
+ * Check whether the reader has a positional data source (file or custom
+ * source), as opposed to being memory-backed.
+ */
+static inline bool carquet_io_is_positional(const carquet_reader_t* reader) {
+    return reader->file != NULL || reader->has_source;
+}
+
+/**
+ * Read exactly `length` bytes at absolute `offset` into `buffer`.
+ * Does not use or modify any shared seek state, so it is safe to call
+ * concurrently from multiple column readers of the same file reader.
+ */
+carquet_status_t carquet_io_read_at(
+    carquet_reader_t* reader,
+    int64_t offset,
+    size_t length,
+    void* buffer,
+    carquet_error_t* error);
+
+/**
+ * A byte range of the file. buffer_offset is the position of the range's
+ * bytes within a coalesced read buffer (filled in by carquet_io_plan_ranges).
+ */
+typedef struct carquet_io_range {
+    int64_t offset;
+    int64_t length;
+    int64_t buffer_offset;
+} carquet_io_range_t;
+
+/**
+ * Get the file byte range of a column chunk (dictionary page included).
+ * Returns false if the chunk metadata does not describe a usable range.
+ */
+bool carquet_io_chunk_range(
+    const carquet_reader_t* reader,
+    const parquet_column_metadata_t* col_meta,
+    int64_t* offset,
+    int64_t* length);
+
+/**
+ * Plan reads for a set of ranges: ranges separated by at most max_gap bytes
+ * are merged (max_gap < 0 disables merging). The merged reads are written to
+ * `merged` (capacity >= count) and each input range gets its buffer_offset
+ * within a buffer of *buffer_size bytes laid out as the merged reads back to
+ * back.
+ */
+carquet_status_t carquet_io_plan_ranges(
+    carquet_io_range_t* ranges,
+    int32_t count,
+    int64_t max_gap,
+    carquet_io_range_t* merged,
+    int32_t* num_merged,
+    int64_t* buffer_size);
+
+/**
+ * Execute planned reads into `buffer` (one read per merged range), through
+ * io_uring when the reader uses it and with pread otherwise.
+ */
+carquet_status_t carquet_io_read_ranges(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* merged,
+    int32_t num_merged,
+    uint8_t* buffer,
+    carquet_error_t* error);
+
+/**
+ * carquet_io_read_ranges() with one blocking pread per merged range.
+ */
+carquet_status_t carquet_io_read_ranges_pread(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* merged,
+    int32_t num_merged,
+    uint8_t* buffer,
+    carquet_error_t* error);
+
+/**
+ * Check that io_uring can be used from the calling thread (sets up the
+ * thread's ring on first call). Always false without CARQUET_HAVE_IO_URING.
+ */
+bool carquet_uring_available(void);
+
+/**
+ * carquet_io_read_ranges() through the calling thread's io_uring, keeping
+ * up to options.io_queue_depth reads in flight. Falls back to pread if the
+ * thread cannot set up a ring.
+ */
+carquet_status_t carquet_uring_read_ranges(
+    carquet_reader_t* reader,
+    const carquet_io_range_t* ranges,
+    int32_t count,
+    uint8_t* buffer,
+    carquet_error_t* error);
+
+/**
+ * Give a column reader the bytes of its chunk, read elsewhere. The memory
+ * is borrowed and must outlive the column reader.
+ */
+void carquet_column_reader_attach_chunk(
+    carquet_column_reader_t* reader,
+    const uint8_t* data,
+    int64_t offset,
+    int64_t length);
+
+/**
+ * Read the column reader's whole chunk into its own buffer, unless a chunk
+ * is already attached. Leaves chunk_data NULL (and returns CARQUET_OK) when
+ * the chunk metadata is unusable, in which case pages are read one by one.
+ */
+carquet_status_t carquet_column_reader_fetch_chunk(
+    carquet_column_reader_t* reader,
+    carquet_error_t* error);
+
+/**
+ * Load and parse a column chunk's ColumnIndex into `arena`. The chunk must
+ * have column_index_offset/length.
+ */
+carquet_status_t carquet_reader_load_column_index(
+    carquet_reader_t* reader,
+    const parquet_column_chunk_t* chunk,
+    carquet_arena_t* arena,
+    parquet_column_index_t* index,
+    carquet_error_t* error);
+
+/**
+ * Load and parse a column chunk's OffsetIndex into `arena`. The chunk must
+ * have offset_index_offset/length.
+ */
+carquet_status_t carquet_reader_load_offset_index(
+    carquet_reader_t* reader,
+    const parquet_column_chunk_t* chunk,
+    carquet_arena_t* arena,
+    parquet_offset_index_t* index,
+    carquet_error_t* error);
+
+/**
+ * Position a column reader at the start of a page of its OffsetIndex. The
+ * pages before it are not read (only their headers, once, for repeated
+ * columns, to count values); the page itself is loaded by the next read.
+ * From then on the non-mmap path reads pages individually instead of
+ * fetching the whole chunk.
+ */
+carquet_status_t carquet_column_reader_seek_page(
+    carquet_column_reader_t* reader,
+    int32_t page,
+    carquet_error_t* error);
+
+/**
+ * Step over the next (unloaded) data page if it holds at most max_values
+ * values, reading only its header. *page_values receives its value count;
+ * a larger page is left in place for decoding.
+ */
+carquet_status_t carquet_column_reader_skip_page(
+    carquet_column_reader_t* reader,
+    int64_t max_values,
+    int32_t* page_values,
+    carquet_error_t* error);
+
+/**
+ * Step over the next (unloaded) data page if it holds at most max_rows
+ * rows, reading only its header. Only DATA_PAGE_V2 headers carry a row
+ * count (V2 pages start on row boundaries): for a V1 page *page_rows is -1
+ * and the page is left in place. *page_values receives its value count.
+ */
+carquet_status_t carquet_column_reader_skip_page_rows(
+    carquet_column_reader_t* reader,
+    int64_t max_rows,
+    int32_t* page_rows,
+    int32_t* page_values,
+    carquet_error_t* error);
+
+/**
+ * Free the page buffers kept alive for the byte array views of the previous
+ * batch. Called as each public read, skip or seek on the column starts.
+ */
+void carquet_column_reader_release_batch(carquet_column_reader_t* reader);
+
+/**
+ * Look up count validated dictionary indices into values (laid out as
+ * carquet_column_read_batch returns them).
+ */
+void carquet_column_reader_gather_dictionary(
+    const carquet_column_reader_t* reader,
+    const uint32_t* indices,
+    int64_t count,
+    void* values);
+
+/**
+ * The chunk's dictionary as an array of *count values (carquet_byte_array_t
+ * views for BYTE_ARRAY), owned by the reader. NULL before the dictionary
+ * page is loaded or when the chunk has none.
+ */
+const void* carquet_column_reader_dictionary(
+    carquet_column_reader_t* reader,
+    int32_t* count);
+
+/**
+ * Read dictionary indices in place of values while the pages are
+ * dictionary-encoded and reader->dictionary_indices is set. Stops before
+ * the first page that is not, leaving it loaded. Returns the number of
+ * entries read, or -1 on error.
+ */
+int64_t carquet_column_read_indices(
+    carquet_column_reader_t* reader,
+    int32_t* indices,
+    int64_t max_values,
+    int16_t* def_levels,
+    int16_t* rep_levels);
+
+/**
+ * Read values (or, with as_indices, dictionary indices as
+ * carquet_column_read_indices does) of a validity_levels reader, writing
+ * their validity to bits [validity_offset, validity_offset + count) of
+ * validity instead of def levels. Returns the number of entries read, or
+ * -1 on error.
+ */
+int64_t carquet_column_read_validity(
+    carquet_column_reader_t* reader,
+    void* values,
+    int64_t max_values,
+    uint8_t* validity,
+    int64_t validity_offset,
+    bool as_indices);
+
+/* ============================================================================
+ * Nested Column Assembly
+ * ============================================================================
+ */
+
+/**
+ * Rebuilds list offsets and validity from the def/rep levels of one leaf
+ * column (nested_reader.c). rep_def[i] is the definition level at which
+ * repeated level i (outermost first) has an element: a list of level i
+ * exists when its parent element does (def >= rep_def[i - 1], always for
+ * level 0) and is non-null from def rep_def[i] - 1. A value slot exists
+ * from def rep_def[num_levels - 1] and holds a value at max_def_level.
+ */
+typedef struct carquet_list_assembler {
+    int32_t num_levels;
+    int16_t max_def_level;
+    int16_t* rep_def;
+    carquet_list_level_t* levels;   /* offsets/validity point at the arrays below */
+    int32_t** offsets;
+    uint8_t** validity;
+    uint8_t* value_validity;
+    int64_t num_values;             /* Value slots of the last run */
+    int64_t null_count;             /* Null values among them */
+    int64_t capacity;               /* Entries the arrays have room for */
+} carquet_list_assembler_t;
+
+/**
+ * Set up an assembler for num_levels repeated levels (may be 0).
+ */
+carquet_status_t carquet_list_assembler_init(
+    carquet_list_assembler_t* assembler,
+    const int16_t* rep_def,
+    int32_t num_levels,
+    int16_t max_def_level);
+
+void carquet_list_assembler_destroy(carquet_list_assembler_t* assembler);
+
+/**
+ * Assemble count entries holding whole records (rep_levels[0] == 0) into
+ * the level arrays and value validity, replacing the previous run.
+ * rep_levels may be NULL when there are no levels.
+ */
+carquet_status_t carquet_list_assembler_run(
+    carquet_list_assembler_t* assembler,
+    const int16_t* def_levels,
+    const int16_t* rep_levels,
+    int64_t count);
+
 /**
  * Check if a page is eligible for zero-copy reading.
  * Requires: uncompressed, PLAIN encoding, fixed-size type.
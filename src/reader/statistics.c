@@ -4,13 +4,28 @@
  *
  * Provides access to column statistics for intelligent row group filtering.
  * This enables predicate pushdown, allowing queries to skip entire row groups
- * that cannot contain matching data.
+ * that cannot contain matching data. Equality predicates also consult the
+ * column chunk bloom filters. Within a row group, the page index
+ * (ColumnIndex + OffsetIndex) narrows a predicate down to row ranges.
  */
 
 #include <carquet/carquet.h>
 #include "reader_internal.h"
 #include "thrift/parquet_types.h"
+#include <stdlib.h>
 #include <string.h>
+#include <math.h>
+
+/* From metadata/bloom_filter.c and util/xxhash.c */
+extern carquet_bloom_filter_t* carquet_bloom_filter_from_data(const uint8_t* data, size_t size);
+extern bool carquet_bloom_filter_check_hash(const carquet_bloom_filter_t* filter, uint64_t hash);
+extern uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
+
+/* Bytes read to find the end of a BloomFilterHeader when the chunk does not
+ * record the filter length */
+#define BLOOM_HEADER_PROBE 64
+/* Largest bitset the spec allows */
+#define BLOOM_FILTER_MAX_BYTES (128 * 1024 * 1024)
 
 /* ============================================================================
  * Type-specific comparison
@@ -70,6 +85,96 @@ static compare_fn_t get_compare_fn(carquet_physical_type_t type) {
     }
 }
 
+/* Bytes read by the get_compare_fn() comparison, 0 for byte comparison */
+static int32_t compare_width(carquet_physical_type_t type) {
+    switch (type) {
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_BOOLEAN:
+        case CARQUET_PHYSICAL_FLOAT:
+            return 4;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+static carquet_physical_type_t leaf_type(const carquet_reader_t* reader, int32_t column_index) {
+    int32_t schema_idx = reader->schema->leaf_indices[column_index];
+    const parquet_schema_element_t* elem = &reader->schema->elements[schema_idx];
+    return elem->has_type ? elem->type : CARQUET_PHYSICAL_BYTE_ARRAY;
+}
+
+/**
+ * Check whether values in [min, max] might satisfy `x op value`.
+ */
+static bool bounds_might_match(
+    carquet_physical_type_t type,
+    carquet_compare_op_t op,
+    const void* value,
+    int32_t value_size,
+    const void* min_value,
+    int32_t min_size,
+    const void* max_value,
+    int32_t max_size) {
+
+    compare_fn_t cmp_fn = get_compare_fn(type);
+
+    int cmp_min, cmp_max;
+
+    if (cmp_fn) {
+        cmp_min = cmp_fn(value, min_value);
+        cmp_max = cmp_fn(value, max_value);
+    } else {
+        /* Byte comparison for variable-length types */
+        cmp_min = compare_bytes(value, (size_t)value_size,
+                                min_value, (size_t)min_size);
+        cmp_max = compare_bytes(value, (size_t)value_size,
+                                max_value, (size_t)max_size);
+    }
+
+    /*
+     * Determine if the range can be skipped based on comparison:
+     *
+     * For value comparison against [min, max] range:
+     * - EQ: skip if value < min OR value > max
+     * - NE: skip if min == max == value (all values are the same)
+     * - LT: skip if min >= value (all values >= value)
+     * - LE: skip if min > value
+     * - GT: skip if max <= value
+     * - GE: skip if max < value
+     */
+
+    switch (op) {
+        case CARQUET_COMPARE_EQ:
+            /* value == x: skip if value not in [min, max] */
+            return !(cmp_min < 0 || cmp_max > 0);
+
+        case CARQUET_COMPARE_NE:
+            /* value != x: skip only if all values equal x */
+            return !(cmp_min == 0 && cmp_max == 0);
+
+        case CARQUET_COMPARE_LT:
+            /* x < value: skip if min >= value */
+            return !(cmp_min <= 0);
+
+        case CARQUET_COMPARE_LE:
+            /* x <= value: skip if min > value */
+            return !(cmp_min < 0);
+
+        case CARQUET_COMPARE_GT:
+            /* x > value: skip if max <= value */
+            return !(cmp_max >= 0);
+
+        case CARQUET_COMPARE_GE:
+            /* x >= value: skip if max < value */
+            return !(cmp_max > 0);
+    }
+
+    return true;
+}
+
 /* ============================================================================
  * Statistics Access
  * ============================================================================
@@ -97,7 +202,11 @@ carquet_status_t carquet_reader_column_statistics(
         return CARQUET_ERROR_COLUMN_NOT_FOUND;
     }
 
-    const parquet_column_chunk_t* chunk = &rg->columns[column_index];
+    const parquet_column_chunk_t* chunk =
+        parquet_row_group_column(&reader->metadata, row_group_index, column_index, NULL);
+    if (!chunk) {
+        return CARQUET_ERROR_INVALID_METADATA;
+    }
     if (!chunk->has_metadata) {
         return CARQUET_OK;  /* No statistics available */
     }
@@ -170,86 +279,22 @@ carquet_status_t carquet_reader_row_group_matches(
         return status;
     }
 
-    /* If no min/max stats, we can't filter */
-    if (!stats.has_min_max) {
-        return CARQUET_OK;
-    }
-
-    /* Get column type */
-    int32_t schema_idx = reader->schema->leaf_indices[column_index];
-    const parquet_schema_element_t* elem = &reader->schema->elements[schema_idx];
-    carquet_physical_type_t type = elem->has_type ? elem->type : CARQUET_PHYSICAL_BYTE_ARRAY;
-
-    compare_fn_t cmp_fn = get_compare_fn(type);
-
-    int cmp_min, cmp_max;
-
-    if (cmp_fn) {
-        cmp_min = cmp_fn(value, stats.min_value);
-        cmp_max = cmp_fn(value, stats.max_value);
-    } else {
-        /* Byte comparison for variable-length types */
-        cmp_min = compare_bytes(value, (size_t)value_size,
-                                stats.min_value, (size_t)stats.min_value_size);
-        cmp_max = compare_bytes(value, (size_t)value_size,
-                                stats.max_value, (size_t)stats.max_value_size);
+    /* Without min/max stats only the bloom filter can rule the group out */
+    if (stats.has_min_max) {
+        *might_match = bounds_might_match(leaf_type(reader, column_index), op,
+                                          value, value_size,
+                                          stats.min_value, stats.min_value_size,
+                                          stats.max_value, stats.max_value_size);
     }
 
-    /*
-     * Determine if row group can be skipped based on comparison:
-     *
-     * For value comparison against [min, max] range:
-     * - EQ: skip if value < min OR value > max
-     * - NE: skip if min == max == value (all values are the same)
-     * - LT: skip if min >= value (all values >= value)
-     * - LE: skip if min > value
-     * - GT: skip if max <= value
-     * - GE: skip if max < value
-     */
-
-    switch (op) {
-        case CARQUET_COMPARE_EQ:
-            /* value == x: skip if value not in [min, max] */
-            if (cmp_min < 0 || cmp_max > 0) {
-                *might_match = false;
-            }
-            break;
-
-        case CARQUET_COMPARE_NE:
-            /* value != x: skip only if all values equal x */
-            if (cmp_min == 0 && cmp_max == 0) {
-                /* min == max == value, all values equal the search value */
-                *might_match = false;
-            }
-            break;
-
-        case CARQUET_COMPARE_LT:
-            /* x < value: skip if min >= value */
-            if (cmp_min <= 0) {
-                *might_match = false;
-            }
-            break;
-
-        case CARQUET_COMPARE_LE:
-            /* x <= value: skip if min > value */
-            if (cmp_min < 0) {
-                *might_match = false;
-            }
-            break;
-
-        case CARQUET_COMPARE_GT:
-            /* x > value: skip if max <= value */
-            if (cmp_max >= 0) {
-                *might_match = false;
-            }
-            break;
-
-        case CARQUET_COMPARE_GE:
-            /* x >= value: skip if max < value */
-            if (cmp_max > 0) {
-                *might_match = false;
-            }
-            break;
+    /* A value inside [min, max] may still be absent; the bloom filter can
+     * tell. Its errors only mean it cannot rule anything out. */
+    if (*might_match && op == CARQUET_COMPARE_EQ) {
+        bool might_contain = true;
+        if (carquet_reader_bloom_filter_check(reader, row_group_index, column_index,
+                                              value, value_size, &might_contain) == CARQUET_OK) {
+            *might_match = might_contain;
+        }
     }
 
     return CARQUET_OK;
@@ -290,3 +335,381 @@ int32_t carquet_reader_filter_row_groups(
 
     return num_matching;
 }
+
+/* ============================================================================
+ * Page Index
+ * ============================================================================
+ */
+
+/**
+ * Get the bytes of a page index or bloom filter at [offset, offset + length):
+ * a view into the mapping, or one positional read into *owned (caller frees).
+ */
+static const uint8_t* index_bytes(
+    carquet_reader_t* reader,
+    int64_t offset,
+    int32_t length,
+    uint8_t** owned,
+    carquet_error_t* error) {
+
+    *owned = NULL;
+    if (offset < 0 || length <= 0 || (uint64_t)offset + (uint64_t)length > reader->file_size) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_METADATA,
+            "Index data at offset %lld (%d bytes) outside file", (long long)offset, (int)length);
+        return NULL;
+    }
+
+    if (reader->mmap_data) {
+        return reader->mmap_data + offset;
+    }
+
+    *owned = malloc((size_t)length);
+    if (!*owned) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate index buffer");
+        return NULL;
+    }
+
+    if (carquet_io_read_at(reader, offset, (size_t)length, *owned, error) != CARQUET_OK) {
+        free(*owned);
+        *owned = NULL;
+        return NULL;
+    }
+    return *owned;
+}
+
+carquet_status_t carquet_reader_load_column_index(
+    carquet_reader_t* reader,
+    const parquet_column_chunk_t* chunk,
+    carquet_arena_t* arena,
+    parquet_column_index_t* index,
+    carquet_error_t* error) {
+
+    uint8_t* owned;
+    const uint8_t* data = index_bytes(reader, chunk->column_index_offset,
+                                           chunk->column_index_length, &owned, error);
+    if (!data) {
+        return error ? error->code : CARQUET_ERROR_INVALID_METADATA;
+    }
+
+    carquet_status_t status = parquet_parse_column_index(
+        data, (size_t)chunk->column_index_length, arena, index, error);
+    free(owned);
+    return status;
+}
+
+carquet_status_t carquet_reader_load_offset_index(
+    carquet_reader_t* reader,
+    const parquet_column_chunk_t* chunk,
+    carquet_arena_t* arena,
+    parquet_offset_index_t* index,
+    carquet_error_t* error) {
+
+    uint8_t* owned;
+    const uint8_t* data = index_bytes(reader, chunk->offset_index_offset,
+                                           chunk->offset_index_length, &owned, error);
+    if (!data) {
+        return error ? error->code : CARQUET_ERROR_INVALID_METADATA;
+    }
+
+    carquet_status_t status = parquet_parse_offset_index(
+        data, (size_t)chunk->offset_index_length, arena, index, error);
+    free(owned);
+    return status;
+}
+
+/**
+ * Check one page of a ColumnIndex against a predicate.
+ */
+static bool page_might_match(
+    const parquet_column_index_t* index,
+    int32_t page,
+    carquet_physical_type_t type,
+    carquet_compare_op_t op,
+    const void* value,
+    int32_t value_size) {
+
+    /* Null pages never match a comparison */
+    if (index->null_pages[page]) {
+        return false;
+    }
+
+    const uint8_t* min_value = index->min_values[page];
+    const uint8_t* max_value = index->max_values[page];
+    int32_t min_size = index->min_value_lens[page];
+    int32_t max_size = index->max_value_lens[page];
+
+    /* Missing bounds, or bounds too short for the typed comparison, rule
+     * nothing out */
+    int32_t width = compare_width(type);
+    if (!min_value || !max_value || min_size < width || max_size < width) {
+        return true;
+    }
+
+    return bounds_might_match(type, op, value, value_size,
+                              min_value, min_size, max_value, max_size);
+}
+
+int32_t carquet_reader_filter_pages(
+    carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_compare_op_t op,
+    const void* value,
+    int32_t value_size,
+    carquet_row_range_t* ranges,
+    int32_t max_ranges) {
+
+    /* reader, value, ranges are nonnull per API contract */
+    if (max_ranges <= 0 ||
+        row_group_index < 0 || row_group_index >= reader->metadata.num_row_groups ||
+        column_index < 0 || column_index >= reader->schema->num_leaves ||
+        column_index >= reader->metadata.row_groups[row_group_index].num_columns) {
+        return -1;
+    }
+
+    int64_t num_rows = reader->metadata.row_groups[row_group_index].num_rows;
+    const parquet_column_chunk_t* chunk =
+        parquet_row_group_column(&reader->metadata, row_group_index, column_index, NULL);
+    if (!chunk) {
+        return -1;
+    }
+
+    carquet_arena_t arena;
+    if (carquet_arena_init_size(&arena, 4096) != CARQUET_OK) {
+        return -1;
+    }
+
+    parquet_column_index_t column_index_data;
+    parquet_offset_index_t offset_index;
+    bool indexed = chunk->has_column_index_offset && chunk->has_column_index_length &&
+                   chunk->has_offset_index_offset && chunk->has_offset_index_length &&
+                   carquet_reader_load_column_index(reader, chunk, &arena,
+                                                    &column_index_data, NULL) == CARQUET_OK &&
+                   carquet_reader_load_offset_index(reader, chunk, &arena,
+                                                    &offset_index, NULL) == CARQUET_OK &&
+                   column_index_data.num_pages == offset_index.num_pages;
+
+    /* Without a usable page index every row might match (conservative) */
+    if (!indexed) {
+        carquet_arena_destroy(&arena);
+        if (num_rows <= 0) {
+            return 0;
+        }
+        ranges[0].first_row = 0;
+        ranges[0].num_rows = num_rows;
+        return 1;
+    }
+
+    carquet_physical_type_t type = leaf_type(reader, column_index);
+    int32_t num_ranges = 0;
+
+    for (int32_t i = 0; i < offset_index.num_pages; i++) {
+        if (!page_might_match(&column_index_data, i, type, op, value, value_size)) {
+            continue;
+        }
+
+        int64_t first = offset_index.page_locations[i].first_row_index;
+        int64_t end = i + 1 < offset_index.num_pages
+            ? offset_index.page_locations[i + 1].first_row_index
+            : num_rows;
+        if (end <= first) {
+            continue;
+        }
+
+        carquet_row_range_t* last = num_ranges > 0 ? &ranges[num_ranges - 1] : NULL;
+        if (last && (last->first_row + last->num_rows == first || num_ranges == max_ranges)) {
+            /* Adjacent page, or out of room: widen the last range */
+            last->num_rows = end - last->first_row;
+        } else {
+            ranges[num_ranges].first_row = first;
+            ranges[num_ranges].num_rows = end - first;
+            num_ranges++;
+        }
+    }
+
+    carquet_arena_destroy(&arena);
+    return num_ranges;
+}
+
+/* ============================================================================
+ * Bloom Filters
+ * ============================================================================
+ */
+
+/**
+ * Read and parse the bloom filter of a column chunk. Returns NULL if the
+ * chunk has none or it is not a split-block xxHash filter we can use.
+ */
+static carquet_bloom_filter_t* load_bloom_filter(
+    carquet_reader_t* reader,
+    const parquet_column_metadata_t* meta) {
+
+    if (!meta->has_bloom_filter_offset || meta->bloom_filter_offset < 0 ||
+        (uint64_t)meta->bloom_filter_offset >= reader->file_size) {
+        return NULL;
+    }
+
+    int64_t offset = meta->bloom_filter_offset;
+    int64_t remaining = (int64_t)reader->file_size - offset;
+
+    /* Header and bitset in one read when the length is recorded; otherwise
+     * probe for the header first */
+    int64_t span = meta->has_bloom_filter_length && meta->bloom_filter_length > 0
+        ? meta->bloom_filter_length
+        : (remaining < BLOOM_HEADER_PROBE ? remaining : BLOOM_HEADER_PROBE);
+
+    uint8_t* owned;
+    const uint8_t* data = index_bytes(reader, offset, (int32_t)span, &owned, NULL);
+    if (!data) {
+        return NULL;
+    }
+
+    parquet_bloom_filter_header_t header;
+    size_t header_size;
+    carquet_bloom_filter_t* filter = NULL;
+
+    if (parquet_parse_bloom_filter_header(data, (size_t)span, &header,
+                                          &header_size, NULL) != CARQUET_OK ||
+        header.algorithm != PARQUET_BLOOM_ALGORITHM_SPLIT_BLOCK ||
+        header.hash != PARQUET_BLOOM_HASH_XXHASH ||
+        header.compression != PARQUET_BLOOM_COMPRESSION_UNCOMPRESSED ||
+        header.num_bytes <= 0 || header.num_bytes > BLOOM_FILTER_MAX_BYTES ||
+        (int64_t)header_size + header.num_bytes > remaining) {
+        free(owned);
+        return NULL;
+    }
+
+    if ((int64_t)header_size + header.num_bytes <= span) {
+        filter = carquet_bloom_filter_from_data(data + header_size, (size_t)header.num_bytes);
+    } else {
+        free(owned);
+        data = index_bytes(reader, offset + (int64_t)header_size, header.num_bytes, &owned, NULL);
+        if (data) {
+            filter = carquet_bloom_filter_from_data(data, (size_t)header.num_bytes);
+        }
+    }
+
+    free(owned);
+    return filter;
+}
+
+/**
+ * Hash a predicate value the way writers hash column values: xxHash64 of
+ * its plain encoding. Returns false for values a filter cannot answer for.
+ */
+static bool bloom_hash(
+    carquet_physical_type_t type,
+    int32_t type_length,
+    const void* value,
+    int32_t value_size,
+    uint64_t* hash) {
+
+    size_t size;
+    switch (type) {
+        case CARQUET_PHYSICAL_INT32:
+            size = 4;
+            break;
+        case CARQUET_PHYSICAL_INT64:
+            size = 8;
+            break;
+        case CARQUET_PHYSICAL_FLOAT: {
+            /* -0.0 == 0.0 and NaN != NaN, but their hashes disagree */
+            float f;
+            memcpy(&f, value, sizeof(f));
+            if (f == 0.0f || isnan(f)) return false;
+            size = 4;
+            break;
+        }
+        case CARQUET_PHYSICAL_DOUBLE: {
+            double d;
+            memcpy(&d, value, sizeof(d));
+            if (d == 0.0 || isnan(d)) return false;
+            size = 8;
+            break;
+        }
+        case CARQUET_PHYSICAL_INT96:
+            size = 12;
+            break;
+        case CARQUET_PHYSICAL_FIXED_LEN_BYTE_ARRAY:
+            if (value_size != type_length) return false;
+            size = (size_t)value_size;
+            break;
+        case CARQUET_PHYSICAL_BYTE_ARRAY:
+            if (value_size < 0) return false;
+            size = (size_t)value_size;
+            break;
+        default:
+            return false;
+    }
+
+    *hash = carquet_xxhash64(value, size, 0);
+    return true;
+}
+
+carquet_status_t carquet_reader_bloom_filter_check(
+    const carquet_reader_t* reader,
+    int32_t row_group_index,
+    int32_t column_index,
+    const void* value,
+    int32_t value_size,
+    bool* might_contain) {
+
+    /* reader, value, might_contain are nonnull per API contract */
+    *might_contain = true;
+
+    if (row_group_index < 0 || row_group_index >= reader->metadata.num_row_groups) {
+        return CARQUET_ERROR_ROW_GROUP_NOT_FOUND;
+    }
+    int32_t num_columns = reader->schema->num_leaves;
+    if (column_index < 0 || column_index >= num_columns ||
+        column_index >= reader->metadata.row_groups[row_group_index].num_columns) {
+        return CARQUET_ERROR_COLUMN_NOT_FOUND;
+    }
+
+    int32_t schema_idx = reader->schema->leaf_indices[column_index];
+    const parquet_schema_element_t* elem = &reader->schema->elements[schema_idx];
+    uint64_t hash;
+    if (!bloom_hash(leaf_type(reader, column_index), elem->type_length,
+                    value, value_size, &hash)) {
+        return CARQUET_OK;
+    }
+
+    const parquet_column_chunk_t* chunk =
+        parquet_row_group_column(&reader->metadata, row_group_index, column_index, NULL);
+    if (!chunk) {
+        return CARQUET_ERROR_INVALID_METADATA;
+    }
+    if (!chunk->has_metadata || !chunk->metadata.has_bloom_filter_offset) {
+        return CARQUET_OK;
+    }
+
+    /* The cache is logically const: loading only fills it in */
+    carquet_reader_t* cache = (carquet_reader_t*)reader;
+    size_t slot = (size_t)row_group_index * (size_t)num_columns + (size_t)column_index;
+
+    carquet_mutex_lock(&cache->bloom_mutex);
+    if (!cache->bloom_filters) {
+        size_t slots = (size_t)reader->metadata.num_row_groups * (size_t)num_columns;
+        cache->bloom_filters = calloc(slots, sizeof(carquet_bloom_filter_t*));
+        cache->bloom_loaded = calloc(slots, sizeof(bool));
+        if (!cache->bloom_filters || !cache->bloom_loaded) {
+            free(cache->bloom_filters);
+            free(cache->bloom_loaded);
+            cache->bloom_filters = NULL;
+            cache->bloom_loaded = NULL;
+            carquet_mutex_unlock(&cache->bloom_mutex);
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+    }
+    if (!cache->bloom_loaded[slot]) {
+        cache->bloom_filters[slot] = load_bloom_filter(cache, &chunk->metadata);
+        cache->bloom_loaded[slot] = true;
+    }
+    const carquet_bloom_filter_t* filter = cache->bloom_filters[slot];
+    carquet_mutex_unlock(&cache->bloom_mutex);
+
+    if (filter) {
+        *might_contain = carquet_bloom_filter_check_hash(filter, hash);
+    }
+    return CARQUET_OK;
+}
@@ -263,6 +263,21 @@ void carquet_neon_bitunpack8_32(const uint8_t* input, int bit_width, uint32_t* v
     }
 }
 
+/**
+ * Unpack count values (a multiple of 8) of bit_width bits.
+ */
+void carquet_neon_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                               uint32_t* values) {
+    if (bit_width == 0) {
+        memset(values, 0, (size_t)count * sizeof(uint32_t));
+        return;
+    }
+    for (int64_t i = 0; i + 8 <= count; i += 8) {
+        carquet_neon_bitunpack8_32(input, bit_width, values + i);
+        input += bit_width;
+    }
+}
+
 /* ============================================================================
  * Byte Stream Split - NEON Optimized (Float AND Double)
  * ============================================================================
@@ -524,7 +539,7 @@ void carquet_neon_byte_stream_split_decode_double(
  * This is used after unpacking deltas to reconstruct original values.
  */
 void carquet_neon_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial) {
-    int32_t sum = initial;
+    uint32_t sum = (uint32_t)initial;
     int64_t i = 0;
 
     /* NEON prefix sum for 4 elements at a time */
@@ -541,17 +556,17 @@ void carquet_neon_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial
         v = vaddq_s32(v, shifted2);
 
         /* Add running sum */
-        v = vaddq_s32(v, vdupq_n_s32(sum));
+        v = vaddq_s32(v, vdupq_n_s32((int32_t)sum));
         vst1q_s32(values + i, v);
 
         /* Update running sum to last element */
-        sum = vgetq_lane_s32(v, 3);
+        sum = (uint32_t)vgetq_lane_s32(v, 3);
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint32_t)values[i];
+        values[i] = (int32_t)sum;
     }
 }
 
@@ -559,7 +574,7 @@ void carquet_neon_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial
  * Apply prefix sum to int64 array using NEON.
  */
 void carquet_neon_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial) {
-    int64_t sum = initial;
+    uint64_t sum = (uint64_t)initial;
     int64_t i = 0;
 
     /* NEON prefix sum for 2 elements at a time */
@@ -571,16 +586,16 @@ void carquet_neon_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial
         v = vaddq_s64(v, shifted);
 
         /* Add running sum */
-        v = vaddq_s64(v, vdupq_n_s64(sum));
+        v = vaddq_s64(v, vdupq_n_s64((int64_t)sum));
         vst1q_s64(values + i, v);
 
-        sum = vgetq_lane_s64(v, 1);
+        sum = (uint64_t)vgetq_lane_s64(v, 1);
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint64_t)values[i];
+        values[i] = (int64_t)sum;
     }
 }
 
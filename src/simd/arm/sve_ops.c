@@ -213,7 +213,7 @@ void carquet_sve_byte_stream_split_decode_double(
  * Apply prefix sum (cumulative sum) to int32 array using SVE.
  */
 void carquet_sve_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial) {
-    int32_t sum = initial;
+    uint32_t sum = (uint32_t)initial;
     int64_t i = 0;
 
     /* SVE prefix sum using vector-length chunks */
@@ -230,8 +230,8 @@ void carquet_sve_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial)
         /* For correctness, we need to compute element-wise prefix */
         int64_t active = svcntp_b32(pg, pg);
         for (int64_t j = 0; j < active; j++) {
-            sum += values[i + j];
-            values[i + j] = sum;
+            sum += (uint32_t)values[i + j];
+            values[i + j] = (int32_t)sum;
         }
 
         i += svcntw();
@@ -242,7 +242,7 @@ void carquet_sve_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial)
  * Apply prefix sum to int64 array using SVE.
  */
 void carquet_sve_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial) {
-    int64_t sum = initial;
+    uint64_t sum = (uint64_t)initial;
     int64_t i = 0;
 
     while (i < count) {
@@ -250,8 +250,8 @@ void carquet_sve_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial)
 
         int64_t active = svcntp_b64(pg, pg);
         for (int64_t j = 0; j < active; j++) {
-            sum += values[i + j];
-            values[i + j] = sum;
+            sum += (uint64_t)values[i + j];
+            values[i + j] = (int64_t)sum;
         }
 
         i += svcntd();
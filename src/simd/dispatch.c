@@ -56,24 +56,40 @@ typedef void (*build_null_bitmap_fn)(const int16_t* def_levels, int64_t count,
                                       int16_t max_def_level, uint8_t* null_bitmap);
 typedef void (*fill_def_levels_fn)(int16_t* def_levels, int64_t count, int16_t value);
 
+typedef void (*bitunpack_32_fn)(const uint8_t* input, int64_t count, int bit_width,
+                                uint32_t* values);
+
+typedef void (*bloom_insert_hashes_fn)(uint8_t* blocks, size_t num_blocks,
+                                        const uint64_t* hashes, int64_t count);
+typedef void (*bloom_check_hashes_fn)(const uint8_t* blocks, size_t num_blocks,
+                                       const uint64_t* hashes, int64_t count,
+                                       uint8_t* out_bitmap);
+
+typedef void (*expand_spaced_i32_fn)(uint32_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present);
+typedef void (*expand_spaced_i64_fn)(uint64_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present);
+
 /* ============================================================================
  * Scalar Fallback Implementations
  * ============================================================================
  */
 
+/* Prefix sums wrap on overflow (delta decoding relies on it), so they are
+ * computed in unsigned arithmetic */
 static void scalar_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial) {
-    int32_t sum = initial;
+    uint32_t sum = (uint32_t)initial;
     for (int64_t i = 0; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint32_t)values[i];
+        values[i] = (int32_t)sum;
     }
 }
 
 static void scalar_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial) {
-    int64_t sum = initial;
+    uint64_t sum = (uint64_t)initial;
     for (int64_t i = 0; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint64_t)values[i];
+        values[i] = (int64_t)sum;
     }
 }
 
@@ -288,6 +304,80 @@ static void scalar_fill_def_levels(int16_t* def_levels, int64_t count, int16_t v
     }
 }
 
+/* From core/bitpack.c */
+extern void carquet_bitunpack8_32(const uint8_t* input, int bit_width, uint32_t* values);
+
+static void scalar_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                uint32_t* values) {
+    /* Groups of 8 values take exactly bit_width bytes */
+    for (int64_t i = 0; i + 8 <= count; i += 8) {
+        carquet_bitunpack8_32(input, bit_width, values + i);
+        input += bit_width;
+    }
+}
+
+/* Split block bloom filter: 32-byte blocks of 8 words, one bit per word */
+static const uint32_t bloom_salt[8] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
+static inline uint32_t* scalar_bloom_block(const uint8_t* blocks, size_t num_blocks,
+                                           uint64_t hash) {
+    size_t index = (size_t)(((hash >> 32) * (uint64_t)num_blocks) >> 32);
+    return (uint32_t*)(blocks + index * 32);
+}
+
+static void scalar_bloom_insert_hashes(uint8_t* blocks, size_t num_blocks,
+                                        const uint64_t* hashes, int64_t count) {
+    for (int64_t i = 0; i < count; i++) {
+        uint32_t* block = scalar_bloom_block(blocks, num_blocks, hashes[i]);
+        uint32_t key = (uint32_t)hashes[i];
+        for (int w = 0; w < 8; w++) {
+            block[w] |= 1U << ((key * bloom_salt[w]) >> 27);
+        }
+    }
+}
+
+static void scalar_bloom_check_hashes(const uint8_t* blocks, size_t num_blocks,
+                                       const uint64_t* hashes, int64_t count,
+                                       uint8_t* out_bitmap) {
+    memset(out_bitmap, 0, (size_t)((count + 7) / 8));
+    for (int64_t i = 0; i < count; i++) {
+        const uint32_t* block = scalar_bloom_block(blocks, num_blocks, hashes[i]);
+        uint32_t key = (uint32_t)hashes[i];
+        uint32_t missing = 0;
+        for (int w = 0; w < 8; w++) {
+            missing |= ~block[w] & (1U << ((key * bloom_salt[w]) >> 27));
+        }
+        if (!missing) {
+            out_bitmap[i / 8] |= (uint8_t)(1 << (i % 8));
+        }
+    }
+}
+
+/* Spread packed values back to front; once every slot below i is set the
+ * remaining values are already in place */
+static void scalar_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present) {
+    int64_t k = present;
+    for (int64_t i = count; i > k; ) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
+static void scalar_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present) {
+    int64_t k = present;
+    for (int64_t i = count; i > k; ) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
 /* ============================================================================
  * External SIMD Function Declarations
  * ============================================================================
@@ -346,6 +436,17 @@ extern void carquet_avx2_byte_stream_split_decode_float(const uint8_t* data, int
 extern void carquet_avx2_unpack_bools(const uint8_t* input, uint8_t* output, int64_t count);
 extern void carquet_avx2_pack_bools(const uint8_t* input, uint8_t* output, int64_t count);
 extern int64_t carquet_avx2_find_run_length_i32(const int32_t* values, int64_t count);
+extern void carquet_avx2_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                      uint32_t* values);
+extern void carquet_avx2_bloom_insert_hashes(uint8_t* blocks, size_t num_blocks,
+                                              const uint64_t* hashes, int64_t count);
+extern void carquet_avx2_bloom_check_hashes(const uint8_t* blocks, size_t num_blocks,
+                                             const uint64_t* hashes, int64_t count,
+                                             uint8_t* out_bitmap);
+extern void carquet_avx2_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                            int64_t offset, int64_t count, int64_t present);
+extern void carquet_avx2_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                            int64_t offset, int64_t count, int64_t present);
 #endif
 
 #ifdef CARQUET_ENABLE_AVX512
@@ -366,6 +467,10 @@ extern void carquet_avx512_byte_stream_split_decode_float(const uint8_t* data, i
 extern void carquet_avx512_unpack_bools(const uint8_t* input, uint8_t* output, int64_t count);
 extern void carquet_avx512_pack_bools(const uint8_t* input, uint8_t* output, int64_t count);
 extern int64_t carquet_avx512_find_run_length_i32(const int32_t* values, int64_t count);
+extern void carquet_avx512_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                              int64_t offset, int64_t count, int64_t present);
+extern void carquet_avx512_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                              int64_t offset, int64_t count, int64_t present);
 #endif
 
 #endif /* CARQUET_ARCH_X86 */
@@ -402,6 +507,8 @@ extern int64_t carquet_neon_count_non_nulls(const int16_t* def_levels, int64_t c
 extern void carquet_neon_build_null_bitmap(const int16_t* def_levels, int64_t count,
                                             int16_t max_def_level, uint8_t* null_bitmap);
 extern void carquet_neon_fill_def_levels(int16_t* def_levels, int64_t count, int16_t value);
+extern void carquet_neon_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                      uint32_t* values);
 #endif
 
 #ifdef __ARM_FEATURE_SVE
@@ -444,6 +551,11 @@ typedef struct {
     count_non_nulls_fn count_non_nulls;
     build_null_bitmap_fn build_null_bitmap;
     fill_def_levels_fn fill_def_levels;
+    bitunpack_32_fn bitunpack_32;
+    bloom_insert_hashes_fn bloom_insert_hashes;
+    bloom_check_hashes_fn bloom_check_hashes;
+    expand_spaced_i32_fn expand_spaced_i32;
+    expand_spaced_i64_fn expand_spaced_i64;
 } carquet_simd_dispatch_t;
 
 static carquet_simd_dispatch_t g_dispatch = {0};
@@ -482,6 +594,11 @@ void carquet_simd_dispatch_init(void) {
     g_dispatch.count_non_nulls = scalar_count_non_nulls;
     g_dispatch.build_null_bitmap = scalar_build_null_bitmap;
     g_dispatch.fill_def_levels = scalar_fill_def_levels;
+    g_dispatch.bitunpack_32 = scalar_bitunpack_32;
+    g_dispatch.bloom_insert_hashes = scalar_bloom_insert_hashes;
+    g_dispatch.bloom_check_hashes = scalar_bloom_check_hashes;
+    g_dispatch.expand_spaced_i32 = scalar_expand_spaced_i32;
+    g_dispatch.expand_spaced_i64 = scalar_expand_spaced_i64;
 
 #if defined(CARQUET_ARCH_X86)
 
@@ -522,6 +639,11 @@ void carquet_simd_dispatch_init(void) {
         g_dispatch.unpack_bools = carquet_avx2_unpack_bools;
         g_dispatch.pack_bools = carquet_avx2_pack_bools;
         g_dispatch.find_run_length_i32 = carquet_avx2_find_run_length_i32;
+        g_dispatch.bitunpack_32 = carquet_avx2_bitunpack_32;
+        g_dispatch.bloom_insert_hashes = carquet_avx2_bloom_insert_hashes;
+        g_dispatch.bloom_check_hashes = carquet_avx2_bloom_check_hashes;
+        g_dispatch.expand_spaced_i32 = carquet_avx2_expand_spaced_i32;
+        g_dispatch.expand_spaced_i64 = carquet_avx2_expand_spaced_i64;
     }
 #endif
 
@@ -538,6 +660,8 @@ void carquet_simd_dispatch_init(void) {
         g_dispatch.unpack_bools = carquet_avx512_unpack_bools;
         g_dispatch.pack_bools = carquet_avx512_pack_bools;
         g_dispatch.find_run_length_i32 = carquet_avx512_find_run_length_i32;
+        g_dispatch.expand_spaced_i32 = carquet_avx512_expand_spaced_i32;
+        g_dispatch.expand_spaced_i64 = carquet_avx512_expand_spaced_i64;
     }
 #endif
 
@@ -567,6 +691,7 @@ void carquet_simd_dispatch_init(void) {
     g_dispatch.count_non_nulls = carquet_neon_count_non_nulls;
     g_dispatch.build_null_bitmap = carquet_neon_build_null_bitmap;
     g_dispatch.fill_def_levels = carquet_neon_fill_def_levels;
+    g_dispatch.bitunpack_32 = carquet_neon_bitunpack_32;
 #endif
 
     /* SVE overrides NEON if available (better performance on supporting hardware) */
@@ -694,3 +819,56 @@ void carquet_dispatch_fill_def_levels(int16_t* def_levels, int64_t count, int16_
     if (!g_dispatch_initialized) carquet_simd_dispatch_init();
     g_dispatch.fill_def_levels(def_levels, count, value);
 }
+
+/**
+ * Unpack count bit-packed values of bit_width (0-32) bits, reading
+ * ceil(count * bit_width / 8) bytes. Whole groups of 8 go through the SIMD
+ * kernel; a trailing partial group is unpacked from a zero-padded copy so
+ * nothing past the packed bytes is read.
+ */
+void carquet_dispatch_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                   uint32_t* values) {
+    if (!g_dispatch_initialized) carquet_simd_dispatch_init();
+    int64_t whole = count & ~(int64_t)7;
+    g_dispatch.bitunpack_32(input, whole, bit_width, values);
+
+    if (whole < count) {
+        size_t offset = (size_t)(whole / 8) * (size_t)bit_width;
+        size_t remaining = ((size_t)(count - whole) * (size_t)bit_width + 7) / 8;
+        uint8_t padded[32] = {0};
+        uint32_t temp[8];
+        memcpy(padded, input + offset, remaining);
+        g_dispatch.bitunpack_32(padded, 8, bit_width, temp);
+        memcpy(values + whole, temp, (size_t)(count - whole) * sizeof(uint32_t));
+    }
+}
+
+void carquet_dispatch_bloom_insert_hashes(uint8_t* blocks, size_t num_blocks,
+                                          const uint64_t* hashes, int64_t count) {
+    if (!g_dispatch_initialized) carquet_simd_dispatch_init();
+    g_dispatch.bloom_insert_hashes(blocks, num_blocks, hashes, count);
+}
+
+void carquet_dispatch_bloom_check_hashes(const uint8_t* blocks, size_t num_blocks,
+                                         const uint64_t* hashes, int64_t count,
+                                         uint8_t* out_bitmap) {
+    if (!g_dispatch_initialized) carquet_simd_dispatch_init();
+    g_dispatch.bloom_check_hashes(blocks, num_blocks, hashes, count, out_bitmap);
+}
+
+/**
+ * Expand the first present values of values[0..count) in place so that
+ * values[i] holds the next packed value when validity bit offset + i is set
+ * and zero when it is clear. present must equal the number of set bits.
+ */
+void carquet_dispatch_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                        int64_t offset, int64_t count, int64_t present) {
+    if (!g_dispatch_initialized) carquet_simd_dispatch_init();
+    g_dispatch.expand_spaced_i32(values, validity, offset, count, present);
+}
+
+void carquet_dispatch_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                        int64_t offset, int64_t count, int64_t present) {
+    if (!g_dispatch_initialized) carquet_simd_dispatch_init();
+    g_dispatch.expand_spaced_i64(values, validity, offset, count, present);
+}
@@ -3,11 +3,13 @@
  * @brief AVX2 optimized operations for x86-64 processors
  *
  * Provides SIMD-accelerated implementations using 256-bit vectors:
- * - Bit unpacking for common bit widths
+ * - Bit unpacking (bulk, any width)
  * - Byte stream split/merge (for BYTE_STREAM_SPLIT encoding)
  * - Delta decoding (prefix sums)
  * - Dictionary gather operations (using AVX2 gather instructions)
  * - Boolean packing/unpacking
+ * - Split block bloom filter probes and inserts
+ * - Expanding packed values to spaced (null-slotted) layout
  */
 
 #include <carquet/error.h>
@@ -94,6 +96,116 @@ void carquet_avx2_bitunpack8_16bit(const uint8_t* input, uint32_t* values) {
     _mm256_storeu_si256((__m256i*)values, result);
 }
 
+/*
+ * Bulk unpacking for any width. A group of 8 values takes exactly bit_width
+ * bytes; each lane shuffles in the bytes holding its value and shifts it
+ * down by its bit offset. Widths up to 25 fit a value in 4 bytes (32-bit
+ * lanes); 26-31 can straddle 5 bytes and go through 64-bit lanes instead.
+ * The last groups, whose 16-byte loads would run past the packed data, are
+ * unpacked with the scalar routine.
+ */
+
+/* From core/bitpack.c */
+extern void carquet_bitunpack8_32(const uint8_t* input, int bit_width, uint32_t* values);
+
+static inline __m256i load_two_halves(const uint8_t* lo, const uint8_t* hi) {
+    __m256i v = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)lo));
+    return _mm256_inserti128_si256(v, _mm_loadu_si128((const __m128i*)hi), 1);
+}
+
+static void bitunpack_narrow(const uint8_t* input, int64_t groups, int bit_width,
+                             uint32_t* values) {
+    /* Lanes 4-7 read from the byte holding value 4 */
+    int hi_base = (4 * bit_width) >> 3;
+    __m256i bit = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                     _mm256_set1_epi32(bit_width));
+    bit = _mm256_sub_epi32(bit, _mm256_setr_epi32(0, 0, 0, 0, hi_base * 8, hi_base * 8,
+                                                  hi_base * 8, hi_base * 8));
+    __m256i ctrl = _mm256_add_epi32(
+        _mm256_mullo_epi32(_mm256_srli_epi32(bit, 3), _mm256_set1_epi32(0x01010101)),
+        _mm256_set1_epi32(0x03020100));
+    __m256i shift = _mm256_and_si256(bit, _mm256_set1_epi32(7));
+    __m256i mask = _mm256_set1_epi32((int)((1U << bit_width) - 1));
+
+    for (int64_t g = 0; g < groups; g++) {
+        const uint8_t* p = input + (size_t)g * (size_t)bit_width;
+        __m256i v = _mm256_shuffle_epi8(load_two_halves(p, p + hi_base), ctrl);
+        v = _mm256_and_si256(_mm256_srlv_epi32(v, shift), mask);
+        _mm256_storeu_si256((__m256i*)(values + g * 8), v);
+    }
+}
+
+static void bitunpack_wide(const uint8_t* input, int64_t groups, int bit_width,
+                           uint32_t* values) {
+    /* Each 128-bit half holds two values, read from the byte holding the first */
+    int base[4];
+    int8_t shuf[2][32];
+    int64_t shifts[2][4];
+    for (int pair = 0; pair < 4; pair++) {
+        base[pair] = (2 * pair * bit_width) >> 3;
+        for (int j = 0; j < 2; j++) {
+            int bit = (2 * pair + j) * bit_width - base[pair] * 8;
+            for (int b = 0; b < 8; b++) {
+                shuf[pair / 2][(pair & 1) * 16 + j * 8 + b] = (int8_t)((bit >> 3) + b);
+            }
+            shifts[pair / 2][(pair & 1) * 2 + j] = bit & 7;
+        }
+    }
+    __m256i ctrl_lo = _mm256_loadu_si256((const __m256i*)shuf[0]);
+    __m256i ctrl_hi = _mm256_loadu_si256((const __m256i*)shuf[1]);
+    __m256i shift_lo = _mm256_loadu_si256((const __m256i*)shifts[0]);
+    __m256i shift_hi = _mm256_loadu_si256((const __m256i*)shifts[1]);
+    __m256i evens = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    __m256i mask = _mm256_set1_epi32((int)((1U << bit_width) - 1));
+
+    for (int64_t g = 0; g < groups; g++) {
+        const uint8_t* p = input + (size_t)g * (size_t)bit_width;
+        __m256i lo = _mm256_shuffle_epi8(load_two_halves(p + base[0], p + base[1]), ctrl_lo);
+        __m256i hi = _mm256_shuffle_epi8(load_two_halves(p + base[2], p + base[3]), ctrl_hi);
+        lo = _mm256_permutevar8x32_epi32(_mm256_srlv_epi64(lo, shift_lo), evens);
+        hi = _mm256_permutevar8x32_epi32(_mm256_srlv_epi64(hi, shift_hi), evens);
+        __m256i v = _mm256_and_si256(_mm256_permute2x128_si256(lo, hi, 0x20), mask);
+        _mm256_storeu_si256((__m256i*)(values + g * 8), v);
+    }
+}
+
+/**
+ * Unpack count values of bit_width (0-32) bits. count must be a multiple of
+ * 8; reads exactly count * bit_width / 8 bytes.
+ */
+void carquet_avx2_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                               uint32_t* values) {
+    if (bit_width == 0) {
+        memset(values, 0, (size_t)count * sizeof(uint32_t));
+        return;
+    }
+    if (bit_width == 32) {
+        memcpy(values, input, (size_t)count * sizeof(uint32_t));
+        return;
+    }
+
+    /* Bytes the last 16-byte load of a group reaches past its start */
+    size_t reach = (size_t)((bit_width <= 25 ? 4 : 6) * bit_width >> 3) + 16;
+    int64_t groups = count / 8;
+    size_t total = (size_t)groups * (size_t)bit_width;
+    int64_t vector_groups = 0;
+    if (total >= reach) {
+        vector_groups = (int64_t)((total - reach) / (size_t)bit_width) + 1;
+    }
+
+    if (vector_groups > 0) {
+        if (bit_width <= 25) {
+            bitunpack_narrow(input, vector_groups, bit_width, values);
+        } else {
+            bitunpack_wide(input, vector_groups, bit_width, values);
+        }
+    }
+
+    for (int64_t g = vector_groups; g < groups; g++) {
+        carquet_bitunpack8_32(input + (size_t)g * (size_t)bit_width, bit_width, values + g * 8);
+    }
+}
+
 /* ============================================================================
  * Byte Stream Split - AVX2 Optimized
  * ============================================================================
@@ -273,7 +385,7 @@ void carquet_avx2_byte_stream_split_decode_double(
  * Apply prefix sum (cumulative sum) to int32 array using AVX2.
  */
 void carquet_avx2_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial) {
-    int32_t sum = initial;
+    uint32_t sum = (uint32_t)initial;
     int64_t i = 0;
 
     /* AVX2 prefix sum for 8 elements at a time */
@@ -301,18 +413,18 @@ void carquet_avx2_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial
         v = _mm256_inserti128_si256(v, hi, 1);
 
         /* Add running sum */
-        __m256i sums = _mm256_set1_epi32(sum);
+        __m256i sums = _mm256_set1_epi32((int32_t)sum);
         v = _mm256_add_epi32(v, sums);
         _mm256_storeu_si256((__m256i*)(values + i), v);
 
         /* Update running sum to last element */
-        sum = _mm256_extract_epi32(v, 7);
+        sum = (uint32_t)_mm256_extract_epi32(v, 7);
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint32_t)values[i];
+        values[i] = (int32_t)sum;
     }
 }
 
@@ -320,7 +432,7 @@ void carquet_avx2_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial
  * Apply prefix sum to int64 array using AVX2.
  */
 void carquet_avx2_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial) {
-    int64_t sum = initial;
+    uint64_t sum = (uint64_t)initial;
     int64_t i = 0;
 
     /* AVX2 prefix sum for 4 elements at a time */
@@ -343,20 +455,20 @@ void carquet_avx2_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial
         v = _mm256_inserti128_si256(v, hi, 1);
 
         /* Add running sum */
-        __m256i sums = _mm256_set1_epi64x(sum);
+        __m256i sums = _mm256_set1_epi64x((int64_t)sum);
         v = _mm256_add_epi64(v, sums);
         _mm256_storeu_si256((__m256i*)(values + i), v);
 
         /* Update running sum */
         int64_t result[4];
         _mm256_storeu_si256((__m256i*)result, v);
-        sum = result[3];
+        sum = (uint64_t)result[3];
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint64_t)values[i];
+        values[i] = (int64_t)sum;
     }
 }
 
@@ -638,5 +750,184 @@ int64_t carquet_avx2_find_run_length_i32(const int32_t* values, int64_t count) {
     return count;
 }
 
+/* ============================================================================
+ * Bloom Filter - AVX2 Optimized
+ * ============================================================================
+ */
+
+/* How many hashes ahead the block of an upcoming probe is prefetched */
+#define BLOOM_PREFETCH_DISTANCE 16
+
+static inline size_t bloom_block_index(uint64_t hash, size_t num_blocks) {
+    return (size_t)(((hash >> 32) * (uint64_t)num_blocks) >> 32);
+}
+
+/**
+ * The 8 one-bit words a hash sets in its block: one 32-bit multiply per
+ * salt, the top 5 bits of each product select the bit.
+ */
+static inline __m256i bloom_block_mask(uint64_t hash) {
+    const __m256i salt = _mm256_setr_epi32(
+        0x47b6137b, 0x44974d91, (int32_t)0x8824ad5bU, (int32_t)0xa2b7289dU,
+        0x705495c7, 0x2df1424b, (int32_t)0x9efc4947U, 0x5c6bfb31);
+    __m256i key = _mm256_set1_epi32((int32_t)(uint32_t)hash);
+    __m256i bit = _mm256_srli_epi32(_mm256_mullo_epi32(key, salt), 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), bit);
+}
+
+void carquet_avx2_bloom_insert_hashes(uint8_t* blocks, size_t num_blocks,
+                                      const uint64_t* hashes, int64_t count) {
+    for (int64_t i = 0; i < count; i++) {
+        if (i + BLOOM_PREFETCH_DISTANCE < count) {
+            size_t ahead = bloom_block_index(hashes[i + BLOOM_PREFETCH_DISTANCE], num_blocks);
+            _mm_prefetch((const char*)(blocks + ahead * 32), _MM_HINT_T0);
+        }
+        __m256i* block = (__m256i*)(blocks + bloom_block_index(hashes[i], num_blocks) * 32);
+        _mm256_storeu_si256(block, _mm256_or_si256(_mm256_loadu_si256(block),
+                                                   bloom_block_mask(hashes[i])));
+    }
+}
+
+void carquet_avx2_bloom_check_hashes(const uint8_t* blocks, size_t num_blocks,
+                                     const uint64_t* hashes, int64_t count,
+                                     uint8_t* out_bitmap) {
+    for (int64_t i = 0; i < count; i += 8) {
+        int64_t n = count - i < 8 ? count - i : 8;
+        uint8_t bits = 0;
+        for (int64_t j = 0; j < n; j++) {
+            if (i + j + BLOOM_PREFETCH_DISTANCE < count) {
+                size_t ahead = bloom_block_index(hashes[i + j + BLOOM_PREFETCH_DISTANCE], num_blocks);
+                _mm_prefetch((const char*)(blocks + ahead * 32), _MM_HINT_T0);
+            }
+            const __m256i* block = (const __m256i*)(blocks +
+                bloom_block_index(hashes[i + j], num_blocks) * 32);
+            /* All mask bits present in the block */
+            bits |= (uint8_t)(_mm256_testc_si256(_mm256_loadu_si256(block),
+                                                 bloom_block_mask(hashes[i + j])) << j);
+        }
+        out_bitmap[i / 8] = bits;
+    }
+}
+
+/* ============================================================================
+ * Spaced Expand - AVX2
+ * ============================================================================
+ *
+ * Spread the first `present` values of a buffer over `count` slots in place:
+ * slot i takes the next packed value when validity bit offset + i is set and
+ * zero otherwise. Blocks are processed back to front so the packed values
+ * are read before the spread block overwrites them.
+ */
+
+/* Rank of each set lane among the set lanes of an 8-bit mask, one byte per
+ * lane: the permutation that spreads packed values to those lanes */
+#define EXPAND_POP8(x) (((x) & 1) + (((x) >> 1) & 1) + (((x) >> 2) & 1) + (((x) >> 3) & 1) + \
+                        (((x) >> 4) & 1) + (((x) >> 5) & 1) + (((x) >> 6) & 1) + (((x) >> 7) & 1))
+#define EXPAND_LANE(m, j) ((((m) >> (j)) & 1) \
+    ? (uint64_t)EXPAND_POP8((m) & ((1u << (j)) - 1)) << (8 * (j)) : 0)
+#define EXPAND_ENTRY(m) (EXPAND_LANE(m, 0) | EXPAND_LANE(m, 1) | EXPAND_LANE(m, 2) | \
+                         EXPAND_LANE(m, 3) | EXPAND_LANE(m, 4) | EXPAND_LANE(m, 5) | \
+                         EXPAND_LANE(m, 6) | EXPAND_LANE(m, 7))
+#define EXPAND_T4(m) EXPAND_ENTRY(m), EXPAND_ENTRY((m) + 1), \
+                     EXPAND_ENTRY((m) + 2), EXPAND_ENTRY((m) + 3)
+#define EXPAND_T16(m) EXPAND_T4(m), EXPAND_T4((m) + 4), EXPAND_T4((m) + 8), EXPAND_T4((m) + 12)
+#define EXPAND_T64(m) EXPAND_T16(m), EXPAND_T16((m) + 16), \
+                      EXPAND_T16((m) + 32), EXPAND_T16((m) + 48)
+
+static const uint64_t expand_shuffle[256] = {
+    EXPAND_T64(0), EXPAND_T64(64), EXPAND_T64(128), EXPAND_T64(192)
+};
+
+#undef EXPAND_T64
+#undef EXPAND_T16
+#undef EXPAND_T4
+#undef EXPAND_ENTRY
+#undef EXPAND_LANE
+#undef EXPAND_POP8
+
+static inline int expand_popcount(unsigned int v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(v);
+#else
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    v = (v + (v >> 4)) & 0x0F0F0F0F;
+    return (int)((v * 0x01010101) >> 24);
+#endif
+}
+
+/* n (at most 8) validity bits starting at bit offset, touching only the bytes
+ * that hold them */
+static inline unsigned int load_validity_bits(const uint8_t* validity, int64_t offset, int n) {
+    const uint8_t* p = validity + offset / 8;
+    int shift = (int)(offset % 8);
+    unsigned int bits = p[0];
+    if (shift + n > 8) {
+        bits |= (unsigned int)p[1] << 8;
+    }
+    return (bits >> shift) & ((1u << n) - 1);
+}
+
+void carquet_avx2_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                    int64_t offset, int64_t count, int64_t present) {
+    const __m256i lane_ids = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    int64_t i = count;
+    int64_t k = present;
+
+    /* Once every slot below i is set the remaining values are in place */
+    while (i >= 8 && k < i) {
+        unsigned int m = load_validity_bits(validity, offset + i - 8, 8);
+        int p = expand_popcount(m);
+        __m256i load_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(p), lane_ids);
+        __m256i packed = _mm256_maskload_epi32((const int*)(values + k - p), load_mask);
+        __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&expand_shuffle[m]));
+        __m256i spread = _mm256_permutevar8x32_epi32(packed, idx);
+        __m256i set = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)m), lane_bits),
+                                         lane_bits);
+        _mm256_storeu_si256((__m256i*)(values + i - 8), _mm256_and_si256(spread, set));
+        k -= p;
+        i -= 8;
+    }
+
+    while (i > k) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
+void carquet_avx2_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                    int64_t offset, int64_t count, int64_t present) {
+    const __m256i lane_ids = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    const __m256i one = _mm256_set1_epi64x(1);
+    int64_t i = count;
+    int64_t k = present;
+
+    while (i >= 4 && k < i) {
+        unsigned int m = load_validity_bits(validity, offset + i - 4, 4);
+        int p = expand_popcount(m);
+        __m256i load_mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(p), lane_ids);
+        __m256i packed = _mm256_maskload_epi64((const long long*)(values + k - p), load_mask);
+        /* 64-bit lane s becomes the 32-bit lane pair (2s, 2s + 1) */
+        __m256i src = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128((int)(uint32_t)expand_shuffle[m]));
+        __m256i lo = _mm256_add_epi64(src, src);
+        __m256i idx = _mm256_or_si256(lo, _mm256_slli_epi64(_mm256_add_epi64(lo, one), 32));
+        __m256i spread = _mm256_permutevar8x32_epi32(packed, idx);
+        __m256i set = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x((long long)m),
+                                                          lane_bits), lane_bits);
+        _mm256_storeu_si256((__m256i*)(values + i - 4), _mm256_and_si256(spread, set));
+        k -= p;
+        i -= 4;
+    }
+
+    while (i > k) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
 #endif /* __AVX2__ */
 #endif /* x86 */
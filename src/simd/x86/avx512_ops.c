@@ -9,6 +9,7 @@
  * - Dictionary gather operations (using AVX-512 scatter/gather)
  * - Boolean packing/unpacking
  * - Masked operations for predicated processing
+ * - Expanding packed values to spaced (null-slotted) layout
  */
 
 #include <carquet/error.h>
@@ -231,7 +232,7 @@ void carquet_avx512_byte_stream_split_decode_float(
  * Apply prefix sum (cumulative sum) to int32 array using AVX-512.
  */
 void carquet_avx512_prefix_sum_i32(int32_t* values, int64_t count, int32_t initial) {
-    int32_t sum = initial;
+    uint32_t sum = (uint32_t)initial;
     int64_t i = 0;
 
     /* AVX-512 prefix sum for 16 elements at a time */
@@ -256,18 +257,18 @@ void carquet_avx512_prefix_sum_i32(int32_t* values, int64_t count, int32_t initi
         v = _mm512_add_epi32(v, shifted8);
 
         /* Add running sum */
-        __m512i sums = _mm512_set1_epi32(sum);
+        __m512i sums = _mm512_set1_epi32((int32_t)sum);
         v = _mm512_add_epi32(v, sums);
         _mm512_storeu_si512((__m512i*)(values + i), v);
 
         /* Update running sum to last element */
-        sum = values[i + 15];
+        sum = (uint32_t)values[i + 15];
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint32_t)values[i];
+        values[i] = (int32_t)sum;
     }
 }
 
@@ -275,7 +276,7 @@ void carquet_avx512_prefix_sum_i32(int32_t* values, int64_t count, int32_t initi
  * Apply prefix sum to int64 array using AVX-512.
  */
 void carquet_avx512_prefix_sum_i64(int64_t* values, int64_t count, int64_t initial) {
-    int64_t sum = initial;
+    uint64_t sum = (uint64_t)initial;
     int64_t i = 0;
 
     /* AVX-512 prefix sum for 8 elements at a time */
@@ -293,18 +294,18 @@ void carquet_avx512_prefix_sum_i64(int64_t* values, int64_t count, int64_t initi
         v = _mm512_add_epi64(v, shifted4);
 
         /* Add running sum */
-        __m512i sums = _mm512_set1_epi64(sum);
+        __m512i sums = _mm512_set1_epi64((int64_t)sum);
         v = _mm512_add_epi64(v, sums);
         _mm512_storeu_si512((__m512i*)(values + i), v);
 
         /* Update running sum */
-        sum = values[i + 7];
+        sum = (uint64_t)values[i + 7];
     }
 
     /* Handle remaining values */
     for (; i < count; i++) {
-        sum += values[i];
-        values[i] = sum;
+        sum += (uint64_t)values[i];
+        values[i] = (int64_t)sum;
     }
 }
 
@@ -602,5 +603,82 @@ __mmask16 carquet_avx512_detect_conflicts_i32(const uint32_t* indices) {
 
 #endif /* __AVX512CD__ */
 
+/* ============================================================================
+ * Spaced Expand - AVX-512
+ * ============================================================================
+ *
+ * Spread the first `present` values of a buffer over `count` slots in place:
+ * slot i takes the next packed value when validity bit offset + i is set and
+ * zero otherwise. vpexpand loads exactly the packed values a block needs;
+ * blocks go back to front so they are read before being overwritten.
+ */
+
+/* n (at most 16) validity bits starting at bit offset, touching only the
+ * bytes that hold them */
+static inline unsigned int load_validity_bits(const uint8_t* validity, int64_t offset, int n) {
+    const uint8_t* p = validity + offset / 8;
+    int shift = (int)(offset % 8);
+    int bytes = (shift + n + 7) / 8;
+    uint32_t bits = 0;
+    for (int b = 0; b < bytes; b++) {
+        bits |= (uint32_t)p[b] << (8 * b);
+    }
+    return (bits >> shift) & ((1u << n) - 1);
+}
+
+static inline int expand_popcount(unsigned int v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(v);
+#else
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    v = (v + (v >> 4)) & 0x0F0F0F0F;
+    return (int)((v * 0x01010101) >> 24);
+#endif
+}
+
+void carquet_avx512_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present) {
+    int64_t i = count;
+    int64_t k = present;
+
+    /* Once every slot below i is set the remaining values are in place */
+    while (i >= 16 && k < i) {
+        unsigned int m = load_validity_bits(validity, offset + i - 16, 16);
+        int p = expand_popcount(m);
+        __m512i spread = _mm512_maskz_expandloadu_epi32((__mmask16)m, values + k - p);
+        _mm512_storeu_si512(values + i - 16, spread);
+        k -= p;
+        i -= 16;
+    }
+
+    while (i > k) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
+void carquet_avx512_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                      int64_t offset, int64_t count, int64_t present) {
+    int64_t i = count;
+    int64_t k = present;
+
+    while (i >= 8 && k < i) {
+        unsigned int m = load_validity_bits(validity, offset + i - 8, 8);
+        int p = expand_popcount(m);
+        __m512i spread = _mm512_maskz_expandloadu_epi64((__mmask8)m, values + k - p);
+        _mm512_storeu_si512(values + i - 8, spread);
+        k -= p;
+        i -= 8;
+    }
+
+    while (i > k) {
+        i--;
+        int64_t bit = offset + i;
+        values[i] = (validity[bit / 8] >> (bit % 8)) & 1 ? values[--k] : 0;
+    }
+}
+
 #endif /* __AVX512F__ */
 #endif /* x86_64 */
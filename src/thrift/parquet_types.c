@@ -22,6 +22,7 @@
 #define CARQUET_MAX_ENCODINGS         100     /* Max encodings per column */
 #define CARQUET_MAX_PATH_ELEMENTS     100     /* Max path depth */
 #define CARQUET_MAX_ENCODING_STATS    100     /* Max encoding stats entries */
+#define CARQUET_MAX_INDEXED_PAGES     1000000 /* Max pages in a page index */
 
 /* Validate count is within reasonable bounds before allocation */
 #define VALIDATE_COUNT(count, max, dec) \
@@ -493,8 +494,12 @@ static void parse_column_chunk(thrift_decoder_t* dec, carquet_arena_t* arena,
  * ============================================================================
  */
 
+/**
+ * Parse a row group. In lazy mode the ColumnChunk structs are only skipped
+ * over, recording where each starts in the footer.
+ */
 static void parse_row_group(thrift_decoder_t* dec, carquet_arena_t* arena,
-                             parquet_row_group_t* rg) {
+                             parquet_row_group_t* rg, bool lazy) {
     memset(rg, 0, sizeof(*rg));
     thrift_read_struct_begin(dec);
 
@@ -509,6 +514,22 @@ static void parse_row_group(thrift_decoder_t* dec, carquet_arena_t* arena,
                 thrift_read_list_begin(dec, &elem_type, &count);
                 VALIDATE_COUNT(count, CARQUET_MAX_COLUMNS_PER_RG, dec);
                 rg->num_columns = count;
+                if (lazy) {
+                    rg->column_offsets = carquet_arena_calloc(arena, count, sizeof(uint32_t));
+                    rg->decoded_columns = carquet_arena_calloc(arena, count,
+                        sizeof(parquet_column_chunk_t*));
+                    if (count > 0 && (!rg->column_offsets || !rg->decoded_columns)) {
+                        dec->status = CARQUET_ERROR_OUT_OF_MEMORY;
+                        snprintf(dec->error_message, sizeof(dec->error_message),
+                            "Failed to allocate column chunk index");
+                        return;
+                    }
+                    for (int32_t i = 0; i < count; i++) {
+                        rg->column_offsets[i] = (uint32_t)dec->reader.pos;
+                        thrift_skip(dec, THRIFT_TYPE_STRUCT);
+                    }
+                    break;
+                }
                 rg->columns = carquet_arena_calloc(arena, count,
                     sizeof(parquet_column_chunk_t));
                 for (int32_t i = 0; i < count; i++) {
@@ -551,11 +572,12 @@ static void parse_row_group(thrift_decoder_t* dec, carquet_arena_t* arena,
  * ============================================================================
  */
 
-carquet_status_t parquet_parse_file_metadata(
+static carquet_status_t parse_file_metadata(
     const uint8_t* data,
     size_t size,
     carquet_arena_t* arena,
     parquet_file_metadata_t* metadata,
+    bool lazy,
     carquet_error_t* error) {
 
     if (!data || !arena || !metadata) {
@@ -608,7 +630,7 @@ carquet_status_t parquet_parse_file_metadata(
                 metadata->row_groups = carquet_arena_calloc(arena, count,
                     sizeof(parquet_row_group_t));
                 for (int32_t i = 0; i < count; i++) {
-                    parse_row_group(&dec, arena, &metadata->row_groups[i]);
+                    parse_row_group(&dec, arena, &metadata->row_groups[i], lazy);
                 }
                 break;
             }
@@ -659,6 +681,92 @@ carquet_status_t parquet_parse_file_metadata(
     return CARQUET_OK;
 }
 
+carquet_status_t parquet_parse_file_metadata(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_file_metadata_t* metadata,
+    carquet_error_t* error) {
+
+    return parse_file_metadata(data, size, arena, metadata, false, error);
+}
+
+carquet_status_t parquet_parse_file_metadata_lazy(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_file_metadata_t* metadata,
+    carquet_error_t* error) {
+
+    if (!data || !arena || !metadata) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "NULL argument");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Chunks are decoded later, after the caller's buffer is gone */
+    parquet_lazy_footer_t* lazy = carquet_arena_calloc(arena, 1, sizeof(parquet_lazy_footer_t));
+    uint8_t* copy = carquet_arena_memdup(arena, data, size);
+    if (!lazy || !copy) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate footer copy");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    carquet_status_t status = parse_file_metadata(copy, size, arena, metadata, true, error);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    lazy->data = copy;
+    lazy->size = size;
+    lazy->arena = arena;
+    carquet_mutex_init(&lazy->mutex);
+    metadata->lazy = lazy;
+    return CARQUET_OK;
+}
+
+const parquet_column_chunk_t* parquet_row_group_column(
+    const parquet_file_metadata_t* metadata,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_error_t* error) {
+
+    const parquet_row_group_t* rg = &metadata->row_groups[row_group_index];
+    parquet_lazy_footer_t* lazy = metadata->lazy;
+    if (!lazy) {
+        return &rg->columns[column_index];
+    }
+
+    carquet_mutex_lock(&lazy->mutex);
+
+    parquet_column_chunk_t* chunk = rg->decoded_columns[column_index];
+    if (!chunk) {
+        size_t capacity = carquet_arena_capacity(lazy->arena);
+        chunk = carquet_arena_alloc(lazy->arena, sizeof(parquet_column_chunk_t));
+        if (!chunk) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate column chunk");
+        } else {
+            size_t offset = rg->column_offsets[column_index];
+            thrift_decoder_t dec;
+            thrift_decoder_init(&dec, lazy->data + offset, lazy->size - offset);
+            parse_column_chunk(&dec, lazy->arena, chunk);
+
+            if (thrift_decoder_has_error(&dec)) {
+                CARQUET_SET_ERROR(error, dec.status, "%s", dec.error_message);
+                chunk = NULL;
+            } else {
+                rg->decoded_columns[column_index] = chunk;
+            }
+        }
+
+        if (lazy->on_grow && carquet_arena_capacity(lazy->arena) != capacity) {
+            lazy->on_grow(lazy->on_grow_ctx);
+        }
+    }
+
+    carquet_mutex_unlock(&lazy->mutex);
+    return chunk;
+}
+
 /* ============================================================================
  * Page Header Parsing
  * ============================================================================
@@ -825,14 +933,303 @@ carquet_status_t parquet_parse_page_header(
     return CARQUET_OK;
 }
 
+/* ============================================================================
+ * Page Index Parsing
+ * ============================================================================
+ */
+
+/* Every list of a page index has one entry per page; the first list read
+ * fixes the page count and the others must agree with it. */
+static bool page_index_list_begin(thrift_decoder_t* dec, int32_t* num_pages,
+                                  bool* seen, int32_t* count) {
+    thrift_type_t elem_type;
+    thrift_read_list_begin(dec, &elem_type, count);
+    if (thrift_decoder_has_error(dec)) {
+        return false;
+    }
+    if (*count < 0 || *count > CARQUET_MAX_INDEXED_PAGES ||
+        (*seen && *count != *num_pages)) {
+        dec->status = CARQUET_ERROR_THRIFT_DECODE;
+        snprintf(dec->error_message, sizeof(dec->error_message),
+            "Invalid page index list length %d", (int)*count);
+        return false;
+    }
+    *num_pages = *count;
+    *seen = true;
+    return true;
+}
+
+static bool parse_page_bounds(thrift_decoder_t* dec, carquet_arena_t* arena,
+                              int32_t count, uint8_t*** values, int32_t** lens) {
+    *values = carquet_arena_calloc(arena, (size_t)count, sizeof(uint8_t*));
+    *lens = carquet_arena_calloc(arena, (size_t)count, sizeof(int32_t));
+    if (count > 0 && (!*values || !*lens)) {
+        return false;
+    }
+    for (int32_t i = 0; i < count && !thrift_decoder_has_error(dec); i++) {
+        (*values)[i] = arena_bindup_thrift(arena, dec, &(*lens)[i]);
+    }
+    return true;
+}
+
+carquet_status_t parquet_parse_column_index(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_column_index_t* index,
+    carquet_error_t* error) {
+
+    if (!data || !arena || !index) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "NULL argument");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(index, 0, sizeof(*index));
+
+    thrift_decoder_t dec;
+    thrift_decoder_init(&dec, data, size);
+    thrift_read_struct_begin(&dec);
+
+    thrift_type_t type;
+    int16_t field_id;
+    bool seen = false;
+    bool oom = false;
+    int32_t count;
+
+    while (!oom && thrift_read_field_begin(&dec, &type, &field_id)) {
+        switch (field_id) {
+            case 1:  /* null_pages */
+                if (!page_index_list_begin(&dec, &index->num_pages, &seen, &count)) break;
+                index->null_pages = carquet_arena_calloc(arena, (size_t)count, sizeof(bool));
+                oom = count > 0 && !index->null_pages;
+                for (int32_t i = 0; !oom && i < count; i++) {
+                    index->null_pages[i] = thrift_read_bool(&dec);
+                }
+                break;
+            case 2:  /* min_values */
+                if (!page_index_list_begin(&dec, &index->num_pages, &seen, &count)) break;
+                oom = !parse_page_bounds(&dec, arena, count,
+                                         &index->min_values, &index->min_value_lens);
+                break;
+            case 3:  /* max_values */
+                if (!page_index_list_begin(&dec, &index->num_pages, &seen, &count)) break;
+                oom = !parse_page_bounds(&dec, arena, count,
+                                         &index->max_values, &index->max_value_lens);
+                break;
+            case 4:  /* boundary_order */
+                index->boundary_order = thrift_read_i32(&dec);
+                break;
+            case 5:  /* null_counts */
+                if (!page_index_list_begin(&dec, &index->num_pages, &seen, &count)) break;
+                index->null_counts = carquet_arena_calloc(arena, (size_t)count, sizeof(int64_t));
+                oom = count > 0 && !index->null_counts;
+                for (int32_t i = 0; !oom && i < count; i++) {
+                    index->null_counts[i] = thrift_read_i64(&dec);
+                }
+                break;
+            default:
+                thrift_skip(&dec, type);
+                break;
+        }
+        if (thrift_decoder_has_error(&dec)) {
+            break;
+        }
+    }
+
+    if (oom) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate column index");
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    thrift_read_struct_end(&dec);
+
+    if (thrift_decoder_has_error(&dec)) {
+        CARQUET_SET_ERROR(error, dec.status, "%s", dec.error_message);
+        return dec.status;
+    }
+
+    /* null_pages, min_values and max_values are required */
+    if (!index->null_pages || !index->min_values || !index->max_values) {
+        if (index->num_pages > 0) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_METADATA,
+                "Column index is missing required fields");
+            return CARQUET_ERROR_INVALID_METADATA;
+        }
+    }
+
+    return CARQUET_OK;
+}
+
+carquet_status_t parquet_parse_offset_index(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_offset_index_t* index,
+    carquet_error_t* error) {
+
+    if (!data || !arena || !index) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "NULL argument");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(index, 0, sizeof(*index));
+
+    thrift_decoder_t dec;
+    thrift_decoder_init(&dec, data, size);
+    thrift_read_struct_begin(&dec);
+
+    thrift_type_t type;
+    int16_t field_id;
+
+    while (thrift_read_field_begin(&dec, &type, &field_id)) {
+        if (field_id != 1) {
+            thrift_skip(&dec, type);  /* uncompressed_page_sizes etc. */
+            continue;
+        }
+
+        /* page_locations */
+        thrift_type_t elem_type;
+        int32_t count;
+        thrift_read_list_begin(&dec, &elem_type, &count);
+        VALIDATE_COUNT_STATUS(count, CARQUET_MAX_INDEXED_PAGES, error);
+        index->page_locations = carquet_arena_calloc(arena, (size_t)count,
+            sizeof(parquet_page_location_t));
+        if (count > 0 && !index->page_locations) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY,
+                "Failed to allocate offset index");
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+        index->num_pages = count;
+
+        for (int32_t i = 0; i < count && !thrift_decoder_has_error(&dec); i++) {
+            parquet_page_location_t* loc = &index->page_locations[i];
+            thrift_read_struct_begin(&dec);
+            thrift_type_t ft;
+            int16_t fid;
+            while (thrift_read_field_begin(&dec, &ft, &fid)) {
+                if (fid == 1) loc->offset = thrift_read_i64(&dec);
+                else if (fid == 2) loc->compressed_page_size = thrift_read_i32(&dec);
+                else if (fid == 3) loc->first_row_index = thrift_read_i64(&dec);
+                else thrift_skip(&dec, ft);
+            }
+            thrift_read_struct_end(&dec);
+        }
+    }
+
+    thrift_read_struct_end(&dec);
+
+    if (thrift_decoder_has_error(&dec)) {
+        CARQUET_SET_ERROR(error, dec.status, "%s", dec.error_message);
+        return dec.status;
+    }
+
+    /* Pages must be in row order for lookups by row */
+    for (int32_t i = 1; i < index->num_pages; i++) {
+        if (index->page_locations[i].first_row_index <
+            index->page_locations[i - 1].first_row_index) {
+            CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_METADATA,
+                "Offset index pages out of row order");
+            return CARQUET_ERROR_INVALID_METADATA;
+        }
+    }
+
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Bloom Filter Header Parsing
+ * ============================================================================
+ */
+
+/* The algorithm, hash and compression fields are unions of empty structs;
+ * all that matters is which member is set. */
+static int16_t parse_union_member(thrift_decoder_t* dec, thrift_type_t field_type) {
+    int16_t member = 0;
+    thrift_type_t type;
+    int16_t field_id;
+
+    if (field_type != THRIFT_TYPE_STRUCT) {
+        thrift_skip(dec, field_type);
+        return 0;
+    }
+
+    thrift_read_struct_begin(dec);
+    while (thrift_read_field_begin(dec, &type, &field_id)) {
+        member = field_id;
+        thrift_skip(dec, type);
+    }
+    thrift_read_struct_end(dec);
+    return member;
+}
+
+carquet_status_t parquet_parse_bloom_filter_header(
+    const uint8_t* data,
+    size_t size,
+    parquet_bloom_filter_header_t* header,
+    size_t* bytes_read,
+    carquet_error_t* error) {
+
+    if (!data || !header || !bytes_read) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "NULL argument");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(header, 0, sizeof(*header));
+    *bytes_read = 0;
+
+    thrift_decoder_t dec;
+    thrift_decoder_init(&dec, data, size);
+    thrift_read_struct_begin(&dec);
+
+    thrift_type_t type;
+    int16_t field_id;
+
+    while (thrift_read_field_begin(&dec, &type, &field_id)) {
+        switch (field_id) {
+            case 1:  /* numBytes */
+                header->num_bytes = thrift_read_i32(&dec);
+                break;
+            case 2:  /* algorithm */
+                header->algorithm = parse_union_member(&dec, type);
+                break;
+            case 3:  /* hash */
+                header->hash = parse_union_member(&dec, type);
+                break;
+            case 4:  /* compression */
+                header->compression = parse_union_member(&dec, type);
+                break;
+            default:
+                thrift_skip(&dec, type);
+                break;
+        }
+        if (thrift_decoder_has_error(&dec)) {
+            break;
+        }
+    }
+
+    thrift_read_struct_end(&dec);
+
+    if (thrift_decoder_has_error(&dec)) {
+        CARQUET_SET_ERROR(error, dec.status, "%s", dec.error_message);
+        return dec.status;
+    }
+
+    *bytes_read = dec.reader.pos;
+    return CARQUET_OK;
+}
+
 /* ============================================================================
  * Cleanup
  * ============================================================================
  */
 
 void parquet_file_metadata_free(parquet_file_metadata_t* metadata) {
-    /* Arena handles all allocations, nothing to free here */
-    (void)metadata;
+    /* Arena handles all allocations; only the lazy footer lock needs
+     * tearing down */
+    if (metadata->lazy) {
+        carquet_mutex_destroy(&metadata->lazy->mutex);
+        metadata->lazy = NULL;
+    }
 }
 
 /* ============================================================================
@@ -1422,3 +1819,47 @@ carquet_status_t parquet_write_page_header(
 
     return CARQUET_OK;
 }
+
+carquet_status_t parquet_write_bloom_filter_header(
+    int32_t num_bytes,
+    carquet_buffer_t* buffer,
+    carquet_error_t* error) {
+
+    if (!buffer) {
+        CARQUET_SET_ERROR(error, CARQUET_ERROR_INVALID_ARGUMENT, "NULL argument");
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    thrift_encoder_t enc;
+    thrift_encoder_init(&enc, buffer);
+
+    thrift_write_struct_begin(&enc);
+
+    /* Field 1: numBytes */
+    thrift_write_field_header(&enc, THRIFT_TYPE_I32, 1);
+    thrift_write_i32(&enc, num_bytes);
+
+    /* Fields 2-4: algorithm, hash, compression (unions of empty structs) */
+    static const int16_t members[3] = {
+        PARQUET_BLOOM_ALGORITHM_SPLIT_BLOCK,
+        PARQUET_BLOOM_HASH_XXHASH,
+        PARQUET_BLOOM_COMPRESSION_UNCOMPRESSED
+    };
+    for (int16_t i = 0; i < 3; i++) {
+        thrift_write_field_header(&enc, THRIFT_TYPE_STRUCT, (int16_t)(i + 2));
+        thrift_write_struct_begin(&enc);
+        thrift_write_field_header(&enc, THRIFT_TYPE_STRUCT, members[i]);
+        thrift_write_struct_begin(&enc);
+        thrift_write_struct_end(&enc);
+        thrift_write_struct_end(&enc);
+    }
+
+    thrift_write_struct_end(&enc);
+
+    if (thrift_encoder_has_error(&enc)) {
+        CARQUET_SET_ERROR(error, enc.status, "Failed to encode bloom filter header");
+        return enc.status;
+    }
+
+    return CARQUET_OK;
+}
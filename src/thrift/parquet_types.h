@@ -12,6 +12,7 @@
 #include <carquet/types.h>
 #include <carquet/error.h>
 #include "core/arena.h"
+#include "core/thread.h"
 #include "thrift_decode.h"
 #include "thrift_encode.h"
 #include <stdint.h>
@@ -34,10 +35,15 @@ typedef struct parquet_column_chunk parquet_column_chunk_t;
 typedef struct parquet_row_group parquet_row_group_t;
 typedef struct parquet_key_value parquet_key_value_t;
 typedef struct parquet_file_metadata parquet_file_metadata_t;
+typedef struct parquet_lazy_footer parquet_lazy_footer_t;
 typedef struct parquet_page_header parquet_page_header_t;
 typedef struct parquet_data_page_header parquet_data_page_header_t;
 typedef struct parquet_data_page_header_v2 parquet_data_page_header_v2_t;
 typedef struct parquet_dictionary_page_header parquet_dictionary_page_header_t;
+typedef struct parquet_column_index parquet_column_index_t;
+typedef struct parquet_page_location parquet_page_location_t;
+typedef struct parquet_offset_index parquet_offset_index_t;
+typedef struct parquet_bloom_filter_header parquet_bloom_filter_header_t;
 
 /* ============================================================================
  * Schema Element
@@ -231,10 +237,15 @@ struct parquet_column_chunk {
  */
 
 struct parquet_row_group {
-    /* Field 1: columns */
+    /* Field 1: columns (NULL in lazy mode, see parquet_row_group_column) */
     parquet_column_chunk_t* columns;
     int32_t num_columns;
 
+    /* Lazy mode: footer offset of each ColumnChunk struct, and the chunks
+     * decoded so far (guarded by the lazy footer mutex) */
+    uint32_t* column_offsets;
+    parquet_column_chunk_t** decoded_columns;
+
     /* Field 2: total_byte_size */
     int64_t total_byte_size;
 
@@ -298,6 +309,24 @@ struct parquet_file_metadata {
     /* Field 8: encryption_algorithm (we skip for now) */
 
     /* Field 9: footer_signing_key_metadata (we skip for now) */
+
+    /* Set when column chunks are decoded on demand */
+    parquet_lazy_footer_t* lazy;
+};
+
+/**
+ * Footer bytes kept for on-demand column chunk decoding.
+ */
+struct parquet_lazy_footer {
+    const uint8_t* data;        /* Copy of the footer in the metadata arena */
+    size_t size;
+    carquet_arena_t* arena;     /* Arena the metadata was parsed into */
+    carquet_mutex_t mutex;      /* Guards decoded_columns and the arena */
+
+    /* Optional: called with the mutex held when decoding a chunk grew the
+     * arena, so an owner can account for the memory */
+    void (*on_grow)(void* ctx);
+    void* on_grow_ctx;
 };
 
 /* ============================================================================
@@ -383,6 +412,69 @@ struct parquet_page_header {
     };
 };
 
+/* ============================================================================
+ * Page Index
+ * ============================================================================
+ */
+
+struct parquet_column_index {
+    int32_t num_pages;
+
+    /* Field 1: null_pages */
+    bool* null_pages;
+
+    /* Field 2: min_values (empty for null pages) */
+    uint8_t** min_values;
+    int32_t* min_value_lens;
+
+    /* Field 3: max_values (empty for null pages) */
+    uint8_t** max_values;
+    int32_t* max_value_lens;
+
+    /* Field 4: boundary_order (0=UNORDERED, 1=ASCENDING, 2=DESCENDING) */
+    int32_t boundary_order;
+
+    /* Field 5: null_counts (optional) */
+    int64_t* null_counts;
+};
+
+struct parquet_page_location {
+    /* Field 1: offset */
+    int64_t offset;
+
+    /* Field 2: compressed_page_size (header included) */
+    int32_t compressed_page_size;
+
+    /* Field 3: first_row_index (relative to the row group) */
+    int64_t first_row_index;
+};
+
+struct parquet_offset_index {
+    /* Field 1: page_locations */
+    int32_t num_pages;
+    parquet_page_location_t* page_locations;
+};
+
+/* ============================================================================
+ * Bloom Filter Header
+ * ============================================================================
+ */
+
+/* Members of the BloomFilterAlgorithm/Hash/Compression unions */
+#define PARQUET_BLOOM_ALGORITHM_SPLIT_BLOCK 1
+#define PARQUET_BLOOM_HASH_XXHASH 1
+#define PARQUET_BLOOM_COMPRESSION_UNCOMPRESSED 1
+
+struct parquet_bloom_filter_header {
+    /* Field 1: numBytes (size of the bitset that follows the header) */
+    int32_t num_bytes;
+
+    /* Fields 2-4: field id of the union member set, 0 if absent */
+    int16_t algorithm;
+    int16_t hash;
+    int16_t compression;
+};
+
 /* ============================================================================
  * Parsing Functions
  * ============================================================================
@@ -405,6 +497,36 @@ carquet_status_t parquet_parse_file_metadata(
     parquet_file_metadata_t* metadata,
     carquet_error_t* error);
 
+/**
+ * Parse file metadata without decoding column chunks.
+ *
+ * Schema, row group and key-value fields are decoded as usual, but each
+ * row group only records where its ColumnChunk structs start in the
+ * footer. Chunks are decoded by parquet_row_group_column() the first time
+ * they are used, so decoding cost and memory follow the columns actually
+ * read. The footer is copied into the arena.
+ *
+ * Release with parquet_file_metadata_free() before destroying the arena.
+ */
+carquet_status_t parquet_parse_file_metadata_lazy(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_file_metadata_t* metadata,
+    carquet_error_t* error);
+
+/**
+ * Get a column chunk of a row group, decoding it first in lazy mode.
+ * Indices must be in range. Thread-safe.
+ *
+ * @return The chunk, or NULL if it could not be decoded
+ */
+const parquet_column_chunk_t* parquet_row_group_column(
+    const parquet_file_metadata_t* metadata,
+    int32_t row_group_index,
+    int32_t column_index,
+    carquet_error_t* error);
+
 /**
  * Parse a page header from Thrift data.
  *
@@ -422,6 +544,57 @@ carquet_status_t parquet_parse_page_header(
     size_t* bytes_read,
     carquet_error_t* error);
 
+/**
+ * Parse a ColumnIndex (per-page min/max and null flags) from Thrift data.
+ *
+ * @param data Thrift-encoded ColumnIndex
+ * @param size Size of data
+ * @param arena Arena for allocations
+ * @param index Output column index
+ * @param error Error information
+ * @return Status code
+ */
+carquet_status_t parquet_parse_column_index(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_column_index_t* index,
+    carquet_error_t* error);
+
+/**
+ * Parse an OffsetIndex (per-page location and first row) from Thrift data.
+ *
+ * @param data Thrift-encoded OffsetIndex
+ * @param size Size of data
+ * @param arena Arena for allocations
+ * @param index Output offset index
+ * @param error Error information
+ * @return Status code
+ */
+carquet_status_t parquet_parse_offset_index(
+    const uint8_t* data,
+    size_t size,
+    carquet_arena_t* arena,
+    parquet_offset_index_t* index,
+    carquet_error_t* error);
+
+/**
+ * Parse the BloomFilterHeader that precedes a bloom filter bitset.
+ *
+ * @param data Thrift-encoded header (followed by the bitset)
+ * @param size Size of data
+ * @param header Output header
+ * @param bytes_read Output: number of bytes consumed
+ * @param error Error information
+ * @return Status code
+ */
+carquet_status_t parquet_parse_bloom_filter_header(
+    const uint8_t* data,
+    size_t size,
+    parquet_bloom_filter_header_t* header,
+    size_t* bytes_read,
+    carquet_error_t* error);
+
 /**
  * Free file metadata (only frees non-arena allocations).
  */
@@ -458,6 +631,20 @@ carquet_status_t parquet_write_page_header(
     carquet_buffer_t* buffer,
     carquet_error_t* error);
 
+/**
+ * Write a BloomFilterHeader (split block, xxHash, uncompressed) for a
+ * bitset of `num_bytes` bytes.
+ *
+ * @param num_bytes Size of the bitset
+ * @param buffer Output buffer
+ * @param error Error information
+ * @return Status code
+ */
+carquet_status_t parquet_write_bloom_filter_header(
+    int32_t num_bytes,
+    carquet_buffer_t* buffer,
+    carquet_error_t* error);
+
 #ifdef __cplusplus
 }
 #endif
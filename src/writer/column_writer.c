@@ -13,6 +13,7 @@
 #include "thrift/parquet_types.h"
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 /* Forward declaration from page_writer.c */
 typedef struct carquet_page_writer carquet_page_writer_t;
@@ -44,6 +45,64 @@ extern carquet_status_t carquet_page_writer_finalize(
 
 extern size_t carquet_page_writer_estimated_size(const carquet_page_writer_t* writer);
 extern int64_t carquet_page_writer_num_values(const carquet_page_writer_t* writer);
+extern int64_t carquet_page_writer_null_count(const carquet_page_writer_t* writer);
+
+extern bool carquet_page_writer_get_statistics(
+    const carquet_page_writer_t* writer,
+    const uint8_t** min_value,
+    const uint8_t** max_value,
+    size_t* value_size,
+    int64_t* null_count);
+
+/* Forward declarations from page_index.c */
+typedef struct carquet_column_index_builder carquet_column_index_builder_t;
+typedef struct carquet_offset_index_builder carquet_offset_index_builder_t;
+
+extern carquet_column_index_builder_t* carquet_column_index_builder_create(
+    carquet_physical_type_t type,
+    int32_t type_length);
+extern void carquet_column_index_builder_destroy(carquet_column_index_builder_t* builder);
+extern carquet_status_t carquet_column_index_add_page(
+    carquet_column_index_builder_t* builder,
+    int64_t null_count,
+    const void* min_value,
+    int32_t min_value_len,
+    const void* max_value,
+    int32_t max_value_len,
+    bool is_null_page);
+extern carquet_status_t carquet_column_index_serialize(
+    const carquet_column_index_builder_t* builder,
+    carquet_buffer_t* output);
+
+extern carquet_offset_index_builder_t* carquet_offset_index_builder_create(
+    bool track_uncompressed);
+extern void carquet_offset_index_builder_destroy(carquet_offset_index_builder_t* builder);
+extern carquet_status_t carquet_offset_index_add_page(
+    carquet_offset_index_builder_t* builder,
+    int64_t offset,
+    int32_t compressed_size,
+    int64_t first_row_index,
+    int32_t uncompressed_size);
+extern void carquet_offset_index_shift(
+    carquet_offset_index_builder_t* builder,
+    int64_t delta);
+extern carquet_status_t carquet_offset_index_serialize(
+    const carquet_offset_index_builder_t* builder,
+    carquet_buffer_t* output);
+
+/* Forward declarations from bloom_filter.c and xxhash.c */
+extern carquet_bloom_filter_t* carquet_bloom_filter_create(size_t num_bytes);
+extern void carquet_bloom_filter_destroy(carquet_bloom_filter_t* filter);
+extern void carquet_bloom_filter_insert_hashes(carquet_bloom_filter_t* filter,
+                                               const uint64_t* hashes, int64_t count);
+extern const uint8_t* carquet_bloom_filter_data(const carquet_bloom_filter_t* filter);
+extern size_t carquet_bloom_filter_size(const carquet_bloom_filter_t* filter);
+extern uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
+
+/* Bloom filter sizing: false positive rate and the largest bitset per chunk */
+#define BLOOM_FILTER_FPP 0.01
+#define BLOOM_FILTER_MIN_BYTES 32
+#define BLOOM_FILTER_MAX_BYTES (1024 * 1024)
 
 /* ============================================================================
  * Column Writer Structure
@@ -79,6 +138,19 @@ typedef struct carquet_column_writer_internal {
     uint8_t max_value[64];
     size_t min_max_size;
 
+    /* Page index (NULL unless enabled); page offsets are relative to the
+     * start of column_buffer */
+    carquet_column_index_builder_t* column_index;
+    carquet_offset_index_builder_t* offset_index;
+    bool column_index_complete;  /* Every page had min/max or was all null */
+    int64_t total_rows;
+    int64_t page_first_row;
+
+    /* xxHash64 of every non-null value when a bloom filter is built; the
+     * filter is sized from the distinct count at the end */
+    bool has_bloom_filter;
+    carquet_buffer_t bloom_hashes;
+
     /* Column path for metadata */
     char** path_in_schema;
     int path_depth;
@@ -110,6 +182,7 @@ carquet_column_writer_internal_t* carquet_column_writer_create(
     }
 
     carquet_buffer_init(&writer->column_buffer);
+    carquet_buffer_init(&writer->bloom_hashes);
 
     writer->type = type;
     writer->encoding = encoding;
@@ -129,6 +202,9 @@ void carquet_column_writer_destroy(carquet_column_writer_internal_t* writer) {
             carquet_page_writer_destroy(writer->page_writer);
         }
         carquet_buffer_destroy(&writer->column_buffer);
+        carquet_column_index_builder_destroy(writer->column_index);
+        carquet_offset_index_builder_destroy(writer->offset_index);
+        carquet_buffer_destroy(&writer->bloom_hashes);
 
         /* Free path strings */
         if (writer->path_in_schema) {
@@ -142,11 +218,209 @@ void carquet_column_writer_destroy(carquet_column_writer_internal_t* writer) {
     }
 }
 
+/**
+ * Record a ColumnIndex and OffsetIndex entry for every page written from
+ * now on.
+ */
+carquet_status_t carquet_column_writer_enable_page_index(
+    carquet_column_writer_internal_t* writer) {
+
+    if (!writer) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+    if (writer->offset_index) {
+        return CARQUET_OK;
+    }
+
+    writer->column_index = carquet_column_index_builder_create(writer->type, writer->type_length);
+    writer->offset_index = carquet_offset_index_builder_create(false);
+    if (!writer->column_index || !writer->offset_index) {
+        carquet_column_index_builder_destroy(writer->column_index);
+        carquet_offset_index_builder_destroy(writer->offset_index);
+        writer->column_index = NULL;
+        writer->offset_index = NULL;
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    writer->column_index_complete = true;
+    return CARQUET_OK;
+}
+
+/**
+ * Build a bloom filter over the values written from now on. BOOLEAN
+ * columns get none: two values never need one.
+ */
+carquet_status_t carquet_column_writer_enable_bloom_filter(
+    carquet_column_writer_internal_t* writer) {
+
+    if (!writer) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+    writer->has_bloom_filter = writer->type != CARQUET_PHYSICAL_BOOLEAN;
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Bloom Filter
+ * ============================================================================
+ */
+
+/**
+ * Hash the non-null values of a batch (packed at the front of `values`)
+ * the way the bloom filter spec wants: xxHash64 of the plain encoding,
+ * without the length prefix for BYTE_ARRAY.
+ */
+static carquet_status_t hash_bloom_values(
+    carquet_column_writer_internal_t* writer,
+    const void* values,
+    int64_t count) {
+
+    uint64_t* hashes = (uint64_t*)carquet_buffer_advance(
+        &writer->bloom_hashes, (size_t)count * sizeof(uint64_t));
+    if (count > 0 && !hashes) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (writer->type == CARQUET_PHYSICAL_BYTE_ARRAY) {
+        const carquet_byte_array_t* arrays = (const carquet_byte_array_t*)values;
+        for (int64_t i = 0; i < count; i++) {
+            hashes[i] = carquet_xxhash64(arrays[i].data, (size_t)arrays[i].length, 0);
+        }
+        return CARQUET_OK;
+    }
+
+    size_t width;
+    switch (writer->type) {
+        case CARQUET_PHYSICAL_INT32:
+        case CARQUET_PHYSICAL_FLOAT:
+            width = 4;
+            break;
+        case CARQUET_PHYSICAL_INT64:
+        case CARQUET_PHYSICAL_DOUBLE:
+            width = 8;
+            break;
+        case CARQUET_PHYSICAL_INT96:
+            width = 12;
+            break;
+        default:
+            width = (size_t)writer->type_length;
+            break;
+    }
+
+    const uint8_t* data = (const uint8_t*)values;
+    for (int64_t i = 0; i < count; i++) {
+        hashes[i] = carquet_xxhash64(data + (size_t)i * width, width, 0);
+    }
+    return CARQUET_OK;
+}
+
+static int compare_hash(const void* a, const void* b) {
+    uint64_t ha = *(const uint64_t*)a;
+    uint64_t hb = *(const uint64_t*)b;
+    return (ha > hb) - (ha < hb);
+}
+
+/**
+ * Bitset size for `ndv` distinct values at BLOOM_FILTER_FPP: the split
+ * block bound m = -8 * ndv / ln(1 - fpp^(1/8)) bits, rounded up to a power
+ * of two as other implementations expect.
+ */
+static size_t bloom_filter_bytes(int64_t ndv) {
+    double bits = -8.0 * (double)ndv / log(1.0 - pow(BLOOM_FILTER_FPP, 1.0 / 8.0));
+    size_t num_bytes = BLOOM_FILTER_MIN_BYTES;
+    while (num_bytes < BLOOM_FILTER_MAX_BYTES && (double)num_bytes * 8.0 < bits) {
+        num_bytes *= 2;
+    }
+    return num_bytes;
+}
+
+/**
+ * Serialize the bloom filter of a finalized column chunk (BloomFilterHeader
+ * followed by the bitset) into `out`. *has_filter is false when the column
+ * has no filter or no non-null values.
+ */
+carquet_status_t carquet_column_writer_serialize_bloom_filter(
+    carquet_column_writer_internal_t* writer,
+    carquet_buffer_t* out,
+    bool* has_filter) {
+
+    *has_filter = false;
+    if (!writer || !writer->has_bloom_filter) {
+        return CARQUET_OK;
+    }
+
+    uint64_t* hashes = (uint64_t*)writer->bloom_hashes.data;
+    size_t count = writer->bloom_hashes.size / sizeof(uint64_t);
+    if (count == 0) {
+        return CARQUET_OK;
+    }
+
+    /* Size for the distinct values, not every occurrence */
+    qsort(hashes, count, sizeof(uint64_t), compare_hash);
+    size_t ndv = 1;
+    for (size_t i = 1; i < count; i++) {
+        if (hashes[i] != hashes[ndv - 1]) {
+            hashes[ndv++] = hashes[i];
+        }
+    }
+
+    carquet_bloom_filter_t* filter = carquet_bloom_filter_create(bloom_filter_bytes((int64_t)ndv));
+    if (!filter) {
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+    carquet_bloom_filter_insert_hashes(filter, hashes, (int64_t)ndv);
+
+    size_t num_bytes = carquet_bloom_filter_size(filter);
+    carquet_status_t status = parquet_write_bloom_filter_header((int32_t)num_bytes, out, NULL);
+    if (status == CARQUET_OK) {
+        status = carquet_buffer_append(out, carquet_bloom_filter_data(filter), num_bytes);
+    }
+    carquet_bloom_filter_destroy(filter);
+
+    *has_filter = status == CARQUET_OK;
+    return status;
+}
+
 /* ============================================================================
  * Page Flushing
  * ============================================================================
  */
 
+static carquet_status_t record_page_index(
+    carquet_column_writer_internal_t* writer,
+    int64_t page_offset,
+    size_t page_size) {
+
+    carquet_status_t status = carquet_offset_index_add_page(
+        writer->offset_index, page_offset, (int32_t)page_size,
+        writer->page_first_row, 0);
+    if (status != CARQUET_OK || !writer->column_index_complete) {
+        return status;
+    }
+
+    const uint8_t* min_value;
+    const uint8_t* max_value;
+    size_t value_size;
+    int64_t null_count = carquet_page_writer_null_count(writer->page_writer);
+
+    if (null_count == carquet_page_writer_num_values(writer->page_writer)) {
+        return carquet_column_index_add_page(writer->column_index, null_count,
+                                             NULL, 0, NULL, 0, true);
+    }
+
+    if (!carquet_page_writer_get_statistics(writer->page_writer, &min_value, &max_value,
+                                            &value_size, NULL)) {
+        /* No min/max for this type: an incomplete ColumnIndex is useless,
+         * so only the OffsetIndex gets written */
+        writer->column_index_complete = false;
+        return CARQUET_OK;
+    }
+
+    return carquet_column_index_add_page(writer->column_index, null_count,
+                                         min_value, (int32_t)value_size,
+                                         max_value, (int32_t)value_size, false);
+}
+
 static carquet_status_t flush_current_page(carquet_column_writer_internal_t* writer) {
     if (carquet_page_writer_num_values(writer->page_writer) == 0) {
         return CARQUET_OK;
@@ -165,6 +439,14 @@ static carquet_status_t flush_current_page(carquet_column_writer_internal_t* wri
         return status;
     }
 
+    if (writer->offset_index) {
+        status = record_page_index(writer, (int64_t)writer->column_buffer.size, page_size);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        writer->page_first_row = writer->total_rows;
+    }
+
     /* Append page to column buffer */
     status = carquet_buffer_append(&writer->column_buffer, page_data, page_size);
     if (status != CARQUET_OK) {
@@ -210,6 +492,29 @@ carquet_status_t carquet_column_writer_write_batch(
 
     writer->total_values += num_values;
 
+    if (writer->has_bloom_filter) {
+        int64_t num_non_null = num_values;
+        if (def_levels && writer->max_def_level > 0) {
+            num_non_null = 0;
+            for (int64_t i = 0; i < num_values; i++) {
+                num_non_null += def_levels[i] == writer->max_def_level;
+            }
+        }
+        status = hash_bloom_values(writer, values, num_non_null);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    /* Rows start at repetition level 0 */
+    if (writer->max_rep_level > 0 && rep_levels) {
+        for (int64_t i = 0; i < num_values; i++) {
+            writer->total_rows += rep_levels[i] == 0;
+        }
+    } else {
+        writer->total_rows += num_values;
+    }
+
     /* Check if we should flush the page */
     size_t current_size = carquet_page_writer_estimated_size(writer->page_writer);
     if (current_size >= writer->target_page_size) {
@@ -261,3 +566,35 @@ int64_t carquet_column_writer_num_values(const carquet_column_writer_internal_t*
 int32_t carquet_column_writer_num_pages(const carquet_column_writer_internal_t* writer) {
     return writer ? writer->num_pages : 0;
 }
+
+/**
+ * Serialize the page index of a finalized column chunk that starts at
+ * chunk_offset in the file. The OffsetIndex is appended to offset_index_out;
+ * the ColumnIndex is appended to column_index_out only when every page had
+ * usable statistics (*has_column_index tells which).
+ */
+carquet_status_t carquet_column_writer_serialize_page_index(
+    carquet_column_writer_internal_t* writer,
+    int64_t chunk_offset,
+    carquet_buffer_t* column_index_out,
+    carquet_buffer_t* offset_index_out,
+    bool* has_column_index) {
+
+    if (!writer || !writer->offset_index) {
+        return CARQUET_ERROR_INVALID_STATE;
+    }
+
+    *has_column_index = writer->column_index_complete;
+    if (writer->column_index_complete) {
+        carquet_status_t status = carquet_column_index_serialize(
+            writer->column_index, column_index_out);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
+    carquet_offset_index_shift(writer->offset_index, chunk_offset);
+    carquet_status_t status = carquet_offset_index_serialize(writer->offset_index, offset_index_out);
+    carquet_offset_index_shift(writer->offset_index, -chunk_offset);
+    return status;
+}
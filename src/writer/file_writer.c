@@ -52,7 +52,8 @@ extern carquet_status_t carquet_row_group_writer_add_column(
     carquet_physical_type_t type,
     int16_t max_def_level,
     int16_t max_rep_level,
-    int32_t type_length);
+    int32_t type_length,
+    carquet_encoding_t encoding);
 
 extern carquet_status_t carquet_row_group_writer_write_column(
     carquet_row_group_writer_t* writer,
@@ -73,6 +74,21 @@ extern int64_t carquet_row_group_writer_num_rows(const carquet_row_group_writer_
 extern int64_t carquet_row_group_writer_total_byte_size(const carquet_row_group_writer_t* writer);
 extern const column_chunk_info_t* carquet_row_group_writer_get_column_info(
     const carquet_row_group_writer_t* writer, int index);
+extern void carquet_row_group_writer_set_page_index(
+    carquet_row_group_writer_t* writer, bool enabled);
+extern carquet_status_t carquet_row_group_writer_serialize_page_index(
+    carquet_row_group_writer_t* writer,
+    int index,
+    carquet_buffer_t* column_index_out,
+    carquet_buffer_t* offset_index_out,
+    bool* has_column_index);
+extern void carquet_row_group_writer_set_bloom_filters(
+    carquet_row_group_writer_t* writer, bool enabled);
+extern carquet_status_t carquet_row_group_writer_serialize_bloom_filter(
+    carquet_row_group_writer_t* writer,
+    int index,
+    carquet_buffer_t* out,
+    bool* has_filter);
 
 /* ============================================================================
  * Writer Schema Structure (for building)
@@ -87,6 +103,7 @@ typedef struct writer_column_def {
     int32_t type_length;
     int16_t max_def_level;
     int16_t max_rep_level;
+    carquet_encoding_t encoding;  /* Value encoding of data pages */
 } writer_column_def_t;
 
 /* ============================================================================
@@ -132,6 +149,12 @@ struct carquet_writer {
     int64_t total_rows;
     bool header_written;
 
+    /* Serialized page indexes, written between the last row group and the
+     * footer. Chunk metadata holds offsets relative to these buffers until
+     * then. */
+    carquet_buffer_t column_index_buffer;
+    carquet_buffer_t offset_index_buffer;
+
     /* Arena for metadata allocations */
     carquet_arena_t arena;
 };
@@ -222,13 +245,15 @@ static carquet_status_t add_column_internal(
     col->physical_type = physical_type;
     col->repetition = repetition;
     col->type_length = type_length;
+    col->encoding = CARQUET_ENCODING_PLAIN;
 
     if (logical_type) {
         col->logical_type = *logical_type;
     }
 
-    /* Compute definition level based on repetition */
-    col->max_def_level = (repetition == CARQUET_REPETITION_OPTIONAL) ? 1 : 0;
+    /* Optional and repeated fields each add a definition level (a repeated
+     * field's level 0 is an empty list) */
+    col->max_def_level = (repetition != CARQUET_REPETITION_REQUIRED) ? 1 : 0;
     col->max_rep_level = (repetition == CARQUET_REPETITION_REPEATED) ? 1 : 0;
 
     writer->column_values_written[writer->num_columns] = 0;
@@ -252,6 +277,11 @@ static carquet_status_t ensure_row_group(carquet_writer_t* writer) {
         return CARQUET_ERROR_OUT_OF_MEMORY;
     }
 
+    carquet_row_group_writer_set_page_index(writer->current_row_group,
+                                            writer->options.write_page_index);
+    carquet_row_group_writer_set_bloom_filters(writer->current_row_group,
+                                               writer->options.write_bloom_filters);
+
     /* Add all columns to the row group writer */
     for (int32_t i = 0; i < writer->num_columns; i++) {
         writer_column_def_t* col = &writer->columns[i];
@@ -261,7 +291,8 @@ static carquet_status_t ensure_row_group(carquet_writer_t* writer) {
             col->physical_type,
             col->max_def_level,
             col->max_rep_level,
-            col->type_length);
+            col->type_length,
+            col->encoding);
 
         if (status != CARQUET_OK) {
             carquet_row_group_writer_destroy(writer->current_row_group);
@@ -278,6 +309,130 @@ static carquet_status_t ensure_row_group(carquet_writer_t* writer) {
     return CARQUET_OK;
 }
 
+/* ============================================================================
+ * Page Index
+ * ============================================================================
+ */
+
+/**
+ * Serialize a finalized column's page index into the writer's buffers and
+ * point the chunk at it (offsets relative to the buffers, see
+ * write_page_indexes).
+ */
+static carquet_status_t record_page_index(
+    carquet_writer_t* writer,
+    int column_index,
+    parquet_column_chunk_t* chunk) {
+
+    size_t ci_start = writer->column_index_buffer.size;
+    size_t oi_start = writer->offset_index_buffer.size;
+    bool has_column_index = false;
+
+    carquet_status_t status = carquet_row_group_writer_serialize_page_index(
+        writer->current_row_group, column_index,
+        &writer->column_index_buffer, &writer->offset_index_buffer,
+        &has_column_index);
+    if (status != CARQUET_OK) {
+        return status;
+    }
+
+    if (has_column_index) {
+        chunk->has_column_index_offset = true;
+        chunk->column_index_offset = (int64_t)ci_start;
+        chunk->has_column_index_length = true;
+        chunk->column_index_length = (int32_t)(writer->column_index_buffer.size - ci_start);
+    }
+
+    chunk->has_offset_index_offset = true;
+    chunk->offset_index_offset = (int64_t)oi_start;
+    chunk->has_offset_index_length = true;
+    chunk->offset_index_length = (int32_t)(writer->offset_index_buffer.size - oi_start);
+    return CARQUET_OK;
+}
+
+/**
+ * Write all ColumnIndexes, then all OffsetIndexes, after the last row group
+ * and rebase the chunk metadata offsets onto the file.
+ */
+static carquet_status_t write_page_indexes(carquet_writer_t* writer) {
+    int64_t column_index_base = writer->file_offset;
+    int64_t offset_index_base = column_index_base + (int64_t)writer->column_index_buffer.size;
+
+    const carquet_buffer_t* buffers[2] = {
+        &writer->column_index_buffer, &writer->offset_index_buffer
+    };
+    for (int b = 0; b < 2; b++) {
+        if (buffers[b]->size > 0 &&
+            fwrite(buffers[b]->data, 1, buffers[b]->size, writer->file) != buffers[b]->size) {
+            return CARQUET_ERROR_FILE_WRITE;
+        }
+        writer->file_offset += (int64_t)buffers[b]->size;
+    }
+
+    for (int32_t rg = 0; rg < writer->num_row_groups; rg++) {
+        parquet_row_group_t* meta = &writer->row_groups[rg].metadata;
+        for (int32_t c = 0; c < meta->num_columns; c++) {
+            parquet_column_chunk_t* chunk = &meta->columns[c];
+            if (chunk->has_column_index_offset) {
+                chunk->column_index_offset += column_index_base;
+            }
+            if (chunk->has_offset_index_offset) {
+                chunk->offset_index_offset += offset_index_base;
+            }
+        }
+    }
+
+    return CARQUET_OK;
+}
+
+/* ============================================================================
+ * Bloom Filters
+ * ============================================================================
+ */
+
+/**
+ * Write the bloom filters of the row group just flushed right after its
+ * column chunks, so none of them has to be held until the file is closed.
+ */
+static carquet_status_t write_bloom_filters(
+    carquet_writer_t* writer,
+    parquet_row_group_t* meta) {
+
+    carquet_buffer_t buffer;
+    carquet_buffer_init(&buffer);
+    carquet_status_t status = CARQUET_OK;
+
+    for (int32_t i = 0; i < meta->num_columns && status == CARQUET_OK; i++) {
+        bool has_filter = false;
+        carquet_buffer_clear(&buffer);
+        status = carquet_row_group_writer_serialize_bloom_filter(
+            writer->current_row_group, i, &buffer, &has_filter);
+        if (status != CARQUET_OK || !has_filter) {
+            continue;
+        }
+
+        if (fwrite(buffer.data, 1, buffer.size, writer->file) != buffer.size) {
+            status = CARQUET_ERROR_FILE_WRITE;
+            break;
+        }
+
+        parquet_column_metadata_t* col_meta = &meta->columns[i].metadata;
+        col_meta->has_bloom_filter_offset = true;
+        col_meta->bloom_filter_offset = writer->file_offset;
+        col_meta->has_bloom_filter_length = true;
+        col_meta->bloom_filter_length = (int32_t)buffer.size;
+        writer->file_offset += (int64_t)buffer.size;
+    }
+
+    carquet_buffer_destroy(&buffer);
+    return status;
+}
+
+/* ============================================================================
+ * Row Group Flushing
+ * ============================================================================
+ */
+
 static carquet_status_t flush_row_group(carquet_writer_t* writer) {
     if (!writer->current_row_group) {
         return CARQUET_OK;
@@ -357,7 +512,7 @@ static carquet_status_t flush_row_group(carquet_writer_t* writer) {
         meta->num_encodings = 2;  /* PLAIN + RLE for levels */
         meta->encodings = carquet_arena_calloc(&writer->arena, 2, sizeof(carquet_encoding_t));
         if (meta->encodings) {
-            meta->encodings[0] = CARQUET_ENCODING_PLAIN;
+            meta->encodings[0] = col_info->encoding;
             meta->encodings[1] = CARQUET_ENCODING_RLE;
         }
 
@@ -367,12 +522,26 @@ static carquet_status_t flush_row_group(carquet_writer_t* writer) {
         if (meta->path_in_schema && col_info->path) {
             meta->path_in_schema[0] = carquet_arena_strdup(&writer->arena, col_info->path);
         }
+
+        if (writer->options.write_page_index) {
+            status = record_page_index(writer, i, chunk);
+            if (status != CARQUET_OK) {
+                return status;
+            }
+        }
     }
 
     writer->num_row_groups++;
     writer->file_offset += (int64_t)size;
     writer->total_rows += writer->current_row_group_rows;
 
+    if (writer->options.write_bloom_filters) {
+        status = write_bloom_filters(writer, &rg_info->metadata);
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    }
+
     /* Cleanup current row group */
     carquet_row_group_writer_destroy(writer->current_row_group);
     writer->current_row_group = NULL;
@@ -465,6 +634,8 @@ carquet_writer_t* carquet_writer_create(
         CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate arena");
         return NULL;
     }
+    carquet_buffer_init(&writer->column_index_buffer);
+    carquet_buffer_init(&writer->offset_index_buffer);
 
     /* Open file */
     writer->file = fopen(path, "wb");
@@ -536,6 +707,8 @@ carquet_writer_t* carquet_writer_create_file(
         CARQUET_SET_ERROR(error, CARQUET_ERROR_OUT_OF_MEMORY, "Failed to allocate arena");
         return NULL;
     }
+    carquet_buffer_init(&writer->column_index_buffer);
+    carquet_buffer_init(&writer->offset_index_buffer);
 
     writer->file = file;
     writer->owns_file = false;
@@ -572,6 +745,35 @@ carquet_writer_t* carquet_writer_create_file(
     return writer;
 }
 
+carquet_status_t carquet_writer_set_column_encoding(
+    carquet_writer_t* writer,
+    int32_t column_index,
+    carquet_encoding_t encoding) {
+
+    /* writer is nonnull per API contract */
+    if (column_index < 0 || column_index >= writer->num_columns) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    writer_column_def_t* col = &writer->columns[column_index];
+    switch (encoding) {
+        case CARQUET_ENCODING_PLAIN:
+            break;
+        case CARQUET_ENCODING_BYTE_STREAM_SPLIT:
+            if (col->physical_type != CARQUET_PHYSICAL_FLOAT &&
+                col->physical_type != CARQUET_PHYSICAL_DOUBLE) {
+                return CARQUET_ERROR_INVALID_ENCODING;
+            }
+            break;
+        default:
+            return CARQUET_ERROR_INVALID_ENCODING;
+    }
+
+    /* Picked up when the next row group is started */
+    col->encoding = encoding;
+    return CARQUET_OK;
+}
+
 carquet_status_t carquet_writer_write_batch(
     carquet_writer_t* writer,
     int32_t column_index,
@@ -648,6 +850,11 @@ carquet_status_t carquet_writer_close(carquet_writer_t* writer) {
         goto cleanup;
     }
 
+    status = write_page_indexes(writer);
+    if (status != CARQUET_OK) {
+        goto cleanup;
+    }
+
     /* Build file metadata */
     parquet_file_metadata_t metadata;
     status = build_file_metadata(writer, &metadata);
@@ -720,6 +927,8 @@ cleanup:
     free(writer->column_values_written);
     free(writer->row_groups);
     free(writer->path);
+    carquet_buffer_destroy(&writer->column_index_buffer);
+    carquet_buffer_destroy(&writer->offset_index_buffer);
     carquet_arena_destroy(&writer->arena);
     free(writer);
 
@@ -756,6 +965,8 @@ void carquet_writer_abort(carquet_writer_t* writer) {
     free(writer->column_values_written);
     free(writer->row_groups);
     free(writer->path);
+    carquet_buffer_destroy(&writer->column_index_buffer);
+    carquet_buffer_destroy(&writer->offset_index_buffer);
     carquet_arena_destroy(&writer->arena);
     free(writer);
 }
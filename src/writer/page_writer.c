@@ -41,6 +41,14 @@ extern int carquet_zstd_compress(const uint8_t* src, size_t src_size,
                                   size_t* dst_size, int level);
 extern size_t carquet_zstd_compress_bound(size_t src_size);
 
+/* BYTE_STREAM_SPLIT encoders (SIMD dispatched) */
+extern carquet_status_t carquet_byte_stream_split_encode_float(
+    const float* values, int64_t count,
+    uint8_t* output, size_t output_capacity, size_t* bytes_written);
+extern carquet_status_t carquet_byte_stream_split_encode_double(
+    const double* values, int64_t count,
+    uint8_t* output, size_t output_capacity, size_t* bytes_written);
+
 /* ============================================================================
  * Page Writer Structure
  * ============================================================================
@@ -48,8 +56,8 @@ extern size_t carquet_zstd_compress_bound(size_t src_size);
 
 typedef struct carquet_page_writer {
     carquet_buffer_t values_buffer;      /* Encoded values */
-    carquet_buffer_t def_levels_buffer;  /* Definition levels (RLE) */
-    carquet_buffer_t rep_levels_buffer;  /* Repetition levels (RLE) */
+    carquet_buffer_t def_levels_buffer;  /* Definition levels (raw int16, RLE'd per page) */
+    carquet_buffer_t rep_levels_buffer;  /* Repetition levels (raw int16, RLE'd per page) */
     carquet_buffer_t page_buffer;        /* Final page with header */
 
     carquet_physical_type_t type;
@@ -307,16 +315,35 @@ carquet_status_t carquet_page_writer_add_values(
         writer->num_nulls += (num_values - num_non_null);
     }
 
-    /* Encode definition levels */
+    /* Collect levels; a page may span several batches, so they are encoded
+     * as one RLE run sequence when the page is finalized */
     if (writer->max_def_level > 0 && def_levels) {
-        encode_levels(def_levels, num_values, writer->max_def_level,
-                      &writer->def_levels_buffer);
+        carquet_status_t status = carquet_buffer_append(
+            &writer->def_levels_buffer, def_levels, (size_t)num_values * sizeof(int16_t));
+        if (status != CARQUET_OK) {
+            return status;
+        }
+    } else if (writer->max_def_level > 0) {
+        /* No def levels: every value is present, but the page still needs
+         * the level stream the reader expects */
+        size_t offset = writer->def_levels_buffer.size;
+        carquet_status_t status = carquet_buffer_resize(
+            &writer->def_levels_buffer, offset + (size_t)num_values * sizeof(int16_t));
+        if (status != CARQUET_OK) {
+            return status;
+        }
+        int16_t* levels = (int16_t*)(writer->def_levels_buffer.data + offset);
+        for (int64_t i = 0; i < num_values; i++) {
+            levels[i] = writer->max_def_level;
+        }
     }
 
-    /* Encode repetition levels */
     if (writer->max_rep_level > 0 && rep_levels) {
-        encode_levels(rep_levels, num_values, writer->max_rep_level,
-                      &writer->rep_levels_buffer);
+        carquet_status_t status = carquet_buffer_append(
+            &writer->rep_levels_buffer, rep_levels, (size_t)num_values * sizeof(int16_t));
+        if (status != CARQUET_OK) {
+            return status;
+        }
     }
 
     /* Encode values using PLAIN encoding.
@@ -486,20 +513,60 @@ carquet_status_t carquet_page_writer_finalize(
     carquet_buffer_init(&uncompressed);
 
     if (writer->rep_levels_buffer.size > 0) {
-        carquet_buffer_append(&uncompressed,
-                               writer->rep_levels_buffer.data,
-                               writer->rep_levels_buffer.size);
+        carquet_status_t status = encode_levels(
+            (const int16_t*)writer->rep_levels_buffer.data,
+            (int64_t)(writer->rep_levels_buffer.size / sizeof(int16_t)),
+            writer->max_rep_level, &uncompressed);
+        if (status != CARQUET_OK) {
+            carquet_buffer_destroy(&uncompressed);
+            return status;
+        }
     }
 
     if (writer->def_levels_buffer.size > 0) {
-        carquet_buffer_append(&uncompressed,
-                               writer->def_levels_buffer.data,
-                               writer->def_levels_buffer.size);
+        carquet_status_t status = encode_levels(
+            (const int16_t*)writer->def_levels_buffer.data,
+            (int64_t)(writer->def_levels_buffer.size / sizeof(int16_t)),
+            writer->max_def_level, &uncompressed);
+        if (status != CARQUET_OK) {
+            carquet_buffer_destroy(&uncompressed);
+            return status;
+        }
     }
 
-    carquet_buffer_append(&uncompressed,
-                           writer->values_buffer.data,
-                           writer->values_buffer.size);
+    /* Values are buffered PLAIN (statistics and bloom filters hash that
+     * form); BYTE_STREAM_SPLIT transposes the whole page at once */
+    if (writer->encoding == CARQUET_ENCODING_BYTE_STREAM_SPLIT &&
+        writer->values_buffer.size > 0) {
+        size_t values_size = writer->values_buffer.size;
+        uint8_t* out = carquet_buffer_advance(&uncompressed, values_size);
+        if (!out) {
+            carquet_buffer_destroy(&uncompressed);
+            return CARQUET_ERROR_OUT_OF_MEMORY;
+        }
+
+        size_t written = 0;
+        carquet_status_t status;
+        if (writer->type == CARQUET_PHYSICAL_FLOAT) {
+            status = carquet_byte_stream_split_encode_float(
+                (const float*)writer->values_buffer.data,
+                (int64_t)(values_size / sizeof(float)), out, values_size, &written);
+        } else if (writer->type == CARQUET_PHYSICAL_DOUBLE) {
+            status = carquet_byte_stream_split_encode_double(
+                (const double*)writer->values_buffer.data,
+                (int64_t)(values_size / sizeof(double)), out, values_size, &written);
+        } else {
+            status = CARQUET_ERROR_INVALID_ENCODING;
+        }
+        if (status != CARQUET_OK) {
+            carquet_buffer_destroy(&uncompressed);
+            return status;
+        }
+    } else {
+        carquet_buffer_append(&uncompressed,
+                               writer->values_buffer.data,
+                               writer->values_buffer.size);
+    }
 
     *uncompressed_size = (int32_t)uncompressed.size;
 
@@ -607,9 +674,13 @@ carquet_status_t carquet_page_writer_finalize(
 
 size_t carquet_page_writer_estimated_size(const carquet_page_writer_t* writer) {
     if (!writer) return 0;
+    /* Levels are buffered raw; count them at their bit-packed width */
+    size_t def_count = writer->def_levels_buffer.size / sizeof(int16_t);
+    size_t rep_count = writer->rep_levels_buffer.size / sizeof(int16_t);
     return writer->values_buffer.size +
-           writer->def_levels_buffer.size +
-           writer->rep_levels_buffer.size + 64;  /* Header overhead */
+           (def_count * (size_t)bit_width_for_max(writer->max_def_level) + 7) / 8 +
+           (rep_count * (size_t)bit_width_for_max(writer->max_rep_level) + 7) / 8 +
+           64;  /* Header overhead */
 }
 
 int64_t carquet_page_writer_num_values(const carquet_page_writer_t* writer) {
@@ -45,6 +45,24 @@ extern carquet_status_t carquet_column_writer_finalize(
 
 extern int64_t carquet_column_writer_num_values(const carquet_column_writer_internal_t* writer);
 
+extern carquet_status_t carquet_column_writer_enable_page_index(
+    carquet_column_writer_internal_t* writer);
+
+extern carquet_status_t carquet_column_writer_serialize_page_index(
+    carquet_column_writer_internal_t* writer,
+    int64_t chunk_offset,
+    carquet_buffer_t* column_index_out,
+    carquet_buffer_t* offset_index_out,
+    bool* has_column_index);
+
+extern carquet_status_t carquet_column_writer_enable_bloom_filter(
+    carquet_column_writer_internal_t* writer);
+
+extern carquet_status_t carquet_column_writer_serialize_bloom_filter(
+    carquet_column_writer_internal_t* writer,
+    carquet_buffer_t* out,
+    bool* has_filter);
+
 /* ============================================================================
  * Column Chunk Metadata
  * ============================================================================
@@ -77,6 +95,8 @@ typedef struct carquet_row_group_writer {
     /* Configuration */
     carquet_compression_t compression;
     size_t target_page_size;
+    bool write_page_index;
+    bool write_bloom_filters;
     int64_t num_rows;
 
     /* State */
@@ -132,6 +152,28 @@ void carquet_row_group_writer_destroy(carquet_row_group_writer_t* writer) {
     }
 }
 
+/**
+ * Collect page indexes for columns added from now on.
+ */
+void carquet_row_group_writer_set_page_index(
+    carquet_row_group_writer_t* writer,
+    bool enabled) {
+    if (writer) {
+        writer->write_page_index = enabled;
+    }
+}
+
+/**
+ * Build bloom filters for columns added from now on.
+ */
+void carquet_row_group_writer_set_bloom_filters(
+    carquet_row_group_writer_t* writer,
+    bool enabled) {
+    if (writer) {
+        writer->write_bloom_filters = enabled;
+    }
+}
+
 /* ============================================================================
  * Column Management
  * ============================================================================
@@ -143,7 +185,8 @@ carquet_status_t carquet_row_group_writer_add_column(
     carquet_physical_type_t type,
     int16_t max_def_level,
     int16_t max_rep_level,
-    int32_t type_length) {
+    int32_t type_length,
+    carquet_encoding_t encoding) {
 
     if (!writer || !name) {
         return CARQUET_ERROR_INVALID_ARGUMENT;
@@ -172,7 +215,7 @@ carquet_status_t carquet_row_group_writer_add_column(
     /* Create column writer */
     carquet_column_writer_internal_t* col_writer = carquet_column_writer_create(
         type,
-        CARQUET_ENCODING_PLAIN,
+        encoding,
         writer->compression,
         max_def_level,
         max_rep_level,
@@ -183,12 +226,22 @@ carquet_status_t carquet_row_group_writer_add_column(
         return CARQUET_ERROR_OUT_OF_MEMORY;
     }
 
+    if (writer->write_page_index &&
+        carquet_column_writer_enable_page_index(col_writer) != CARQUET_OK) {
+        carquet_column_writer_destroy(col_writer);
+        return CARQUET_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (writer->write_bloom_filters) {
+        carquet_column_writer_enable_bloom_filter(col_writer);
+    }
+
     writer->column_writers[writer->num_columns] = col_writer;
 
     /* Initialize column info */
     memset(&writer->column_infos[writer->num_columns], 0, sizeof(column_chunk_info_t));
     writer->column_infos[writer->num_columns].type = type;
-    writer->column_infos[writer->num_columns].encoding = CARQUET_ENCODING_PLAIN;
+    writer->column_infos[writer->num_columns].encoding = encoding;
     writer->column_infos[writer->num_columns].compression = writer->compression;
     writer->column_infos[writer->num_columns].type_length = type_length;
     writer->column_infos[writer->num_columns].path = strdup(name);
@@ -292,3 +345,42 @@ const column_chunk_info_t* carquet_row_group_writer_get_column_info(
     }
     return &writer->column_infos[index];
 }
+
+/**
+ * Serialize the page index of a column after finalization (see
+ * carquet_column_writer_serialize_page_index).
+ */
+carquet_status_t carquet_row_group_writer_serialize_page_index(
+    carquet_row_group_writer_t* writer,
+    int index,
+    carquet_buffer_t* column_index_out,
+    carquet_buffer_t* offset_index_out,
+    bool* has_column_index) {
+
+    if (!writer || index < 0 || index >= writer->num_columns) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    return carquet_column_writer_serialize_page_index(
+        writer->column_writers[index],
+        writer->column_infos[index].file_offset,
+        column_index_out, offset_index_out, has_column_index);
+}
+
+/**
+ * Serialize the bloom filter of a column after finalization (see
+ * carquet_column_writer_serialize_bloom_filter).
+ */
+carquet_status_t carquet_row_group_writer_serialize_bloom_filter(
+    carquet_row_group_writer_t* writer,
+    int index,
+    carquet_buffer_t* out,
+    bool* has_filter) {
+
+    if (!writer || index < 0 || index >= writer->num_columns) {
+        return CARQUET_ERROR_INVALID_ARGUMENT;
+    }
+
+    return carquet_column_writer_serialize_bloom_filter(
+        writer->column_writers[index], out, has_filter);
+}
@@ -13,6 +13,14 @@
 #include "core/endian.h"
 #include "core/bitpack.h"
 
+/* From simd/dispatch.c */
+extern void carquet_dispatch_bitunpack_32(const uint8_t* input, int64_t count, int bit_width,
+                                          uint32_t* values);
+extern void carquet_dispatch_expand_spaced_i32(uint32_t* values, const uint8_t* validity,
+                                               int64_t offset, int64_t count, int64_t present);
+extern void carquet_dispatch_expand_spaced_i64(uint64_t* values, const uint8_t* validity,
+                                               int64_t offset, int64_t count, int64_t present);
+
 #define TEST_PASS(name) printf("[PASS] %s\n", name)
 #define TEST_FAIL(name, msg) do { printf("[FAIL] %s: %s\n", name, msg); return 1; } while(0)
 
@@ -344,6 +352,119 @@ static int test_bitpack_roundtrip(void) {
     return 0;
 }
 
+static int test_bitunpack_bulk(void) {
+    /* Odd counts leave a partial trailing group */
+    static const int64_t counts[] = {8, 24, 64, 1000, 13, 1};
+    uint32_t original[1000];
+    uint32_t unpacked[1000];
+
+    for (int bit_width = 0; bit_width <= 32; bit_width++) {
+        uint32_t mask = bit_width == 32 ? ~0U : (1U << bit_width) - 1;
+        uint32_t state = 0x12345678U + (uint32_t)bit_width;
+        for (int i = 0; i < 1000; i++) {
+            state = state * 1664525U + 1013904223U;
+            original[i] = (state ^ (state >> 13)) & mask;
+        }
+
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+            int64_t count = counts[c];
+
+            /* Exact-size buffer so an over-read shows up under ASan */
+            size_t packed_size = carquet_packed_size((size_t)count, bit_width);
+            uint8_t* packed = malloc(packed_size > 0 ? packed_size : 1);
+            uint8_t* scratch = malloc(packed_size + 32);
+            carquet_bitpack_32(original, (size_t)count, bit_width, scratch);
+            memcpy(packed, scratch, packed_size);
+            free(scratch);
+
+            memset(unpacked, 0xAB, sizeof(unpacked));
+            carquet_dispatch_bitunpack_32(packed, count, bit_width, unpacked);
+            free(packed);
+
+            for (int64_t i = 0; i < count; i++) {
+                if (unpacked[i] != original[i]) {
+                    printf("  width %d, count %lld, index %lld: got %u, expected %u\n",
+                           bit_width, (long long)count, (long long)i,
+                           unpacked[i], original[i]);
+                    TEST_FAIL("bitunpack_bulk", "value mismatch");
+                }
+            }
+            if (count < 1000 && unpacked[count] != 0xABABABABU) {
+                TEST_FAIL("bitunpack_bulk", "wrote past count");
+            }
+        }
+    }
+
+    TEST_PASS("bitunpack_bulk");
+    return 0;
+}
+
+static int test_expand_spaced(void) {
+    /* Counts around the 4-, 8- and 16-lane blocks, at unaligned bit offsets */
+    static const int64_t counts[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 64, 257, 1000};
+    static const int64_t offsets[] = {0, 3, 8, 13};
+    static const uint32_t densities[] = {0, 10, 50, 90, 100};  /* percent present */
+    uint32_t state = 0x9E3779B9U;
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+            for (size_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+                int64_t count = counts[c];
+                int64_t offset = offsets[o];
+
+                /* Exact-size buffers so an over-read shows up under ASan */
+                size_t bitmap_size = (size_t)((offset + count + 7) / 8);
+                uint8_t* validity = calloc(bitmap_size > 0 ? bitmap_size : 1, 1);
+                uint32_t* v32 = malloc((size_t)(count > 0 ? count : 1) * sizeof(uint32_t));
+                uint64_t* v64 = malloc((size_t)(count > 0 ? count : 1) * sizeof(uint64_t));
+                int64_t present = 0;
+                for (int64_t i = 0; i < count; i++) {
+                    state = state * 1664525U + 1013904223U;
+                    if ((state >> 8) % 100 < densities[d]) {
+                        validity[(offset + i) / 8] |= (uint8_t)(1 << ((offset + i) % 8));
+                        present++;
+                    }
+                }
+                /* Bits around the range must not be looked at */
+                if (offset % 8) {
+                    validity[0] |= (uint8_t)((1 << (offset % 8)) - 1);
+                }
+                for (int64_t i = 0; i < count; i++) {
+                    v32[i] = i < present ? 1000U + (uint32_t)i : 0xDEADBEEFU;
+                    v64[i] = i < present ? ((uint64_t)(i + 1) << 33) | (uint64_t)i
+                                         : 0xDEADBEEFDEADBEEFULL;
+                }
+
+                carquet_dispatch_expand_spaced_i32(v32, validity, offset, count, present);
+                carquet_dispatch_expand_spaced_i64(v64, validity, offset, count, present);
+
+                int64_t rank = 0;
+                int bad = 0;
+                for (int64_t i = 0; i < count && !bad; i++) {
+                    int set = (validity[(offset + i) / 8] >> ((offset + i) % 8)) & 1;
+                    uint32_t want32 = set ? 1000U + (uint32_t)rank : 0;
+                    uint64_t want64 = set ? ((uint64_t)(rank + 1) << 33) | (uint64_t)rank : 0;
+                    if (v32[i] != want32 || v64[i] != want64) {
+                        printf("  count %lld, offset %lld, density %u, slot %lld\n",
+                               (long long)count, (long long)offset, densities[d], (long long)i);
+                        bad = 1;
+                    }
+                    rank += set;
+                }
+                free(validity);
+                free(v32);
+                free(v64);
+                if (bad) {
+                    TEST_FAIL("expand_spaced", "value mismatch");
+                }
+            }
+        }
+    }
+
+    TEST_PASS("expand_spaced");
+    return 0;
+}
+
 static int test_bit_reader(void) {
     uint8_t data[] = {0xD2, 0xB4};  /* 0b11010010, 0b10110100, LSB first */
     carquet_bit_reader_t reader;
@@ -393,6 +514,8 @@ int main(void) {
     failures += test_bitpack_1bit();
     failures += test_bitpack_4bit();
     failures += test_bitpack_roundtrip();
+    failures += test_bitunpack_bulk();
+    failures += test_expand_spaced();
     failures += test_bit_reader();
 
     printf("\n");
@@ -20,9 +20,8 @@
 #endif
 
 #include <carquet/carquet.h>
-
-#define TEST_PASS(name) printf("[PASS] %s\n", name)
-#define TEST_FAIL(name, msg) do { printf("[FAIL] %s: %s\n", name, msg); return 1; } while(0)
+#include "reader/reader_internal.h"
+#include "test_helpers.h"
 
 /* Temporary file helper - portable across platforms */
 static const char* get_temp_dir(void) {
@@ -358,6 +357,850 @@ static int test_roundtrip_single_row(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Positional I/O (non-mmap path)
+ * ============================================================================
+ */
+
+static bool two_column_a(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int64_t*)value = row;
+    return true;
+}
+
+static bool two_column_b(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int64_t*)value = -(int64_t)row * 7;
+    return true;
+}
+
+static int write_two_column_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "a", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, two_column_a },
+        { "b", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, two_column_b },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_ZSTD;
+    opts.page_size = 4096;  /* Many pages per column chunk */
+
+    carquet_test_file_t file = { columns, 2, num_rows, 0, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+static int test_reader_pread_interleaved(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("pread_interleaved");
+    const int32_t num_rows = 20000;
+
+    if (write_two_column_file(path, num_rows) != 0) {
+        cleanup_file(path);
+        TEST_FAIL("reader_pread_interleaved", "Failed to write file");
+    }
+
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.use_mmap = false;
+    carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+    if (!reader) {
+        cleanup_file(path);
+        TEST_FAIL("reader_pread_interleaved", "Failed to open reader");
+    }
+
+    /* Two column readers share one file reader; interleave their reads so
+     * each page fetch of one column lands between fetches of the other. */
+    carquet_column_reader_t* ca = carquet_reader_get_column(reader, 0, 0, &err);
+    carquet_column_reader_t* cb = carquet_reader_get_column(reader, 0, 1, &err);
+    if (!ca || !cb) {
+        carquet_column_reader_free(ca);
+        carquet_column_reader_free(cb);
+        carquet_reader_close(reader);
+        cleanup_file(path);
+        TEST_FAIL("reader_pread_interleaved", "Failed to get column readers");
+    }
+
+    int64_t va[333], vb[333];
+    int64_t pos = 0;
+    int ok = 1;
+    while (pos < num_rows && ok) {
+        int64_t na = carquet_column_read_batch(ca, va, 333, NULL, NULL);
+        int64_t nb = carquet_column_read_batch(cb, vb, 333, NULL, NULL);
+        if (na <= 0 || na != nb) {
+            ok = 0;
+            break;
+        }
+        for (int64_t i = 0; i < na; i++) {
+            if (va[i] != pos + i || vb[i] != -(pos + i) * 7) {
+                ok = 0;
+                break;
+            }
+        }
+        pos += na;
+    }
+
+    carquet_column_reader_free(ca);
+    carquet_column_reader_free(cb);
+
+    if (!ok || pos != num_rows) {
+        carquet_reader_close(reader);
+        cleanup_file(path);
+        TEST_FAIL("reader_pread_interleaved", "Interleaved column values mismatch");
+    }
+
+    /* Parallel batch reading over the same non-mmap reader */
+    carquet_batch_reader_config_t config;
+    carquet_batch_reader_config_init(&config);
+    config.batch_size = 5000;
+    config.num_threads = 4;
+    carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+    if (!br) {
+        carquet_reader_close(reader);
+        cleanup_file(path);
+        TEST_FAIL("reader_pread_interleaved", "Failed to create batch reader");
+    }
+
+    int64_t total = 0;
+    carquet_row_batch_t* batch = NULL;
+    while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+        const void* da; const void* db;
+        const uint8_t* nulls;
+        int64_t n;
+        if (carquet_row_batch_column(batch, 0, &da, &nulls, &n) != CARQUET_OK ||
+            carquet_row_batch_column(batch, 1, &db, &nulls, &n) != CARQUET_OK) {
+            ok = 0;
+        }
+        for (int64_t i = 0; ok && i < n; i++) {
+            if (((const int64_t*)da)[i] != total + i ||
+                ((const int64_t*)db)[i] != -(total + i) * 7) {
+                ok = 0;
+            }
+        }
+        total += carquet_row_batch_num_rows(batch);
+        carquet_row_batch_free(batch);
+        batch = NULL;
+    }
+
+    carquet_batch_reader_free(br);
+    carquet_reader_close(reader);
+    cleanup_file(path);
+
+    if (!ok || total != num_rows) {
+        TEST_FAIL("reader_pread_interleaved", "Parallel batch values mismatch");
+    }
+
+    TEST_PASS("reader_pread_interleaved");
+    return 0;
+}
+
+static int test_io_plan_ranges(void) {
+    /* Deliberately unsorted, with one overlap and one far-away range */
+    carquet_io_range_t ranges[4] = {
+        { .offset = 1000, .length = 100 },
+        { .offset = 4,    .length = 96 },
+        { .offset = 100,  .length = 50 },
+        { .offset = 1050, .length = 100 },
+    };
+    carquet_io_range_t merged[4];
+    int32_t num_merged = 0;
+    int64_t total = 0;
+
+    if (carquet_io_plan_ranges(ranges, 4, 16, merged, &num_merged, &total) != CARQUET_OK) {
+        TEST_FAIL("io_plan_ranges", "Planning failed");
+    }
+
+    /* [4,150) and [1000,1150) */
+    if (num_merged != 2 || total != 146 + 150) {
+        TEST_FAIL("io_plan_ranges", "Wrong merged ranges");
+    }
+    if (merged[0].offset != 4 || merged[0].length != 146 ||
+        merged[1].offset != 1000 || merged[1].length != 150) {
+        TEST_FAIL("io_plan_ranges", "Wrong merged extents");
+    }
+    if (ranges[1].buffer_offset != 0 || ranges[2].buffer_offset != 96 ||
+        ranges[0].buffer_offset != 146 || ranges[3].buffer_offset != 196) {
+        TEST_FAIL("io_plan_ranges", "Wrong buffer offsets");
+    }
+
+    /* Negative gap disables merging */
+    if (carquet_io_plan_ranges(ranges, 4, -1, merged, &num_merged, &total) != CARQUET_OK ||
+        num_merged != 4 || total != 346) {
+        TEST_FAIL("io_plan_ranges", "Merging should be disabled");
+    }
+
+    TEST_PASS("io_plan_ranges");
+    return 0;
+}
+
+static int test_reader_coalesced_projection(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("coalesced_projection");
+    const int32_t rows_per_group = 3000;
+    const int32_t num_groups = 3;
+
+    carquet_schema_t* schema = carquet_schema_create(&err);
+    for (int c = 0; c < 4; c++) {
+        char name[8];
+        snprintf(name, sizeof(name), "c%d", c);
+        carquet_schema_add_column(schema, name, CARQUET_PHYSICAL_INT32, NULL,
+                                  CARQUET_REPETITION_REQUIRED, 0);
+    }
+
+    carquet_writer_options_t wopts;
+    carquet_writer_options_init(&wopts);
+    wopts.compression = CARQUET_COMPRESSION_SNAPPY;
+    wopts.page_size = 2048;
+
+    carquet_writer_t* writer = carquet_writer_create(path, schema, &wopts, &err);
+    if (!writer) {
+        carquet_schema_free(schema);
+        TEST_FAIL("reader_coalesced_projection", "Failed to create writer");
+    }
+
+    int32_t* vals = malloc(sizeof(int32_t) * rows_per_group);
+    for (int32_t g = 0; g < num_groups; g++) {
+        for (int c = 0; c < 4; c++) {
+            for (int32_t i = 0; i < rows_per_group; i++) {
+                vals[i] = (g * rows_per_group + i) * 10 + c;
+            }
+            carquet_writer_write_batch(writer, c, vals, rows_per_group, NULL, NULL);
+        }
+        if (g + 1 < num_groups) {
+            carquet_writer_new_row_group(writer);
+        }
+    }
+    free(vals);
+    carquet_writer_close(writer);
+    carquet_schema_free(schema);
+
+    /* Columns 0 and 2 are separated by column 1's chunk: merged with the
+     * default gap, read separately with a negative gap. */
+    const int64_t gaps[2] = { 1024 * 1024, -1 };
+    const int32_t proj[2] = { 2, 0 };
+
+    for (int t = 0; t < 2; t++) {
+        carquet_reader_options_t ropts;
+        carquet_reader_options_init(&ropts);
+        ropts.coalesce_gap = gaps[t];
+
+        carquet_reader_t* reader = carquet_reader_open(path, &ropts, &err);
+        if (!reader) {
+            cleanup_file(path);
+            TEST_FAIL("reader_coalesced_projection", "Failed to open reader");
+        }
+
+        carquet_batch_reader_config_t config;
+        carquet_batch_reader_config_init(&config);
+        config.column_indices = proj;
+        config.num_columns = 2;
+        config.batch_size = 1000;
+
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+        int64_t row = 0;
+        int ok = br != NULL;
+        carquet_row_batch_t* batch = NULL;
+        while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+            for (int32_t k = 0; k < 2 && ok; k++) {
+                const void* data;
+                const uint8_t* nulls;
+                int64_t n;
+                if (carquet_row_batch_column(batch, k, &data, &nulls, &n) != CARQUET_OK) {
+                    ok = 0;
+                    break;
+                }
+                for (int64_t i = 0; i < n; i++) {
+                    if (((const int32_t*)data)[i] != (int32_t)((row + i) * 10 + proj[k])) {
+                        ok = 0;
+                        break;
+                    }
+                }
+            }
+            row += carquet_row_batch_num_rows(batch);
+            carquet_row_batch_free(batch);
+            batch = NULL;
+        }
+
+        carquet_batch_reader_free(br);
+        carquet_reader_close(reader);
+
+        if (!ok || row != (int64_t)rows_per_group * num_groups) {
+            cleanup_file(path);
+            TEST_FAIL("reader_coalesced_projection", "Projected values mismatch");
+        }
+    }
+
+    cleanup_file(path);
+    TEST_PASS("reader_coalesced_projection");
+    return 0;
+}
+
+static int test_reader_io_uring(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("io_uring");
+    const int32_t num_rows = 200000;
+
+    if (write_two_column_file(path, num_rows) != 0) {
+        cleanup_file(path);
+        TEST_FAIL("reader_io_uring", "Failed to write file");
+    }
+
+    /* Falls back to pread where io_uring is unavailable; values must match
+     * either way. A shallow queue forces slot reuse. */
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.use_mmap = true;
+    opts.io_backend = CARQUET_IO_BACKEND_IO_URING;
+    opts.io_queue_depth = 2;
+    carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+    if (!reader) {
+        cleanup_file(path);
+        TEST_FAIL("reader_io_uring", "Failed to open reader");
+    }
+    if (carquet_reader_is_io_uring(reader) && carquet_reader_is_mmap(reader)) {
+        carquet_reader_close(reader);
+        cleanup_file(path);
+        TEST_FAIL("reader_io_uring", "io_uring should take precedence over mmap");
+    }
+
+    int ok = 1;
+    carquet_column_reader_t* cb = carquet_reader_get_column(reader, 0, 1, &err);
+    int64_t vb[1000];
+    int64_t pos = 0;
+    while (cb && ok && pos < num_rows) {
+        int64_t n = carquet_column_read_batch(cb, vb, 1000, NULL, NULL);
+        if (n <= 0) {
+            ok = 0;
+            break;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            if (vb[i] != -(pos + i) * 7) {
+                ok = 0;
+                break;
+            }
+        }
+        pos += n;
+    }
+    carquet_column_reader_free(cb);
+
+    carquet_batch_reader_config_t config;
+    carquet_batch_reader_config_init(&config);
+    config.batch_size = 30000;
+    config.prefetch_depth = 1;
+    carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+
+    int64_t total = 0;
+    carquet_row_batch_t* batch = NULL;
+    while (br && ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+        const void* da;
+        const uint8_t* nulls;
+        int64_t n;
+        if (carquet_row_batch_column(batch, 0, &da, &nulls, &n) != CARQUET_OK) {
+            ok = 0;
+        }
+        for (int64_t i = 0; ok && i < n; i++) {
+            if (((const int64_t*)da)[i] != total + i) {
+                ok = 0;
+            }
+        }
+        total += carquet_row_batch_num_rows(batch);
+        carquet_row_batch_free(batch);
+        batch = NULL;
+    }
+
+    carquet_batch_reader_free(br);
+    carquet_reader_close(reader);
+    cleanup_file(path);
+
+    if (!ok || pos != num_rows || total != num_rows) {
+        TEST_FAIL("reader_io_uring", "Values mismatch");
+    }
+
+    TEST_PASS("reader_io_uring");
+    return 0;
+}
+
+/* Memory-backed input source that counts the requests it serves */
+typedef struct {
+    uint8_t* data;
+    int64_t size;
+    int reads;
+    int async_reads;
+    int releases;
+} mem_source_t;
+
+static int64_t mem_source_size(void* ctx) {
+    return ((mem_source_t*)ctx)->size;
+}
+
+static carquet_status_t mem_source_read_at(void* ctx, int64_t offset, void* buffer, size_t length) {
+    mem_source_t* src = (mem_source_t*)ctx;
+    if (offset < 0 || offset + (int64_t)length > src->size) {
+        return CARQUET_ERROR_FILE_READ;
+    }
+    memcpy(buffer, src->data + offset, length);
+    src->reads++;
+    return CARQUET_OK;
+}
+
+static carquet_status_t mem_source_read_at_async(void* ctx, int64_t offset, void* buffer, size_t length,
+                                                 carquet_read_callback_t callback, void* user_data) {
+    mem_source_t* src = (mem_source_t*)ctx;
+    src->async_reads++;
+    callback(user_data, mem_source_read_at(ctx, offset, buffer, length));
+    return CARQUET_OK;
+}
+
+static void mem_source_release(void* ctx) {
+    ((mem_source_t*)ctx)->releases++;
+}
+
+static int test_reader_input_source(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("input_source");
+    const int32_t num_rows = 20000;
+
+    if (write_two_column_file(path, num_rows) != 0) {
+        cleanup_file(path);
+        TEST_FAIL("reader_input_source", "Failed to write file");
+    }
+
+    FILE* f = fopen(path, "rb");
+    fseek(f, 0, SEEK_END);
+    mem_source_t mem = {0};
+    mem.size = ftell(f);
+    mem.data = malloc((size_t)mem.size);
+    fseek(f, 0, SEEK_SET);
+    size_t got = fread(mem.data, 1, (size_t)mem.size, f);
+    fclose(f);
+    cleanup_file(path);
+    if (got != (size_t)mem.size) {
+        free(mem.data);
+        TEST_FAIL("reader_input_source", "Failed to load file");
+    }
+
+    /* Synchronous reads only, then with read_at_async */
+    for (int use_async = 0; use_async < 2; use_async++) {
+        mem.reads = mem.async_reads = mem.releases = 0;
+
+        carquet_input_source_t source = {0};
+        source.ctx = &mem;
+        source.size = mem_source_size;
+        source.read_at = mem_source_read_at;
+        source.read_at_async = use_async ? mem_source_read_at_async : NULL;
+        source.release = mem_source_release;
+
+        /* Never merge, so the two chunks are separate requests */
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.coalesce_gap = -1;
+
+        carquet_reader_t* reader = carquet_reader_open_source(&source, &opts, &err);
+        if (!reader) {
+            free(mem.data);
+            TEST_FAIL("reader_input_source", "Failed to open source");
+        }
+        int footer_reads = mem.reads;
+
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, NULL, &err);
+        int64_t total = 0;
+        int ok = br != NULL;
+        carquet_row_batch_t* batch = NULL;
+        while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+            const void* da; const void* db;
+            const uint8_t* nulls;
+            int64_t n;
+            if (carquet_row_batch_column(batch, 0, &da, &nulls, &n) != CARQUET_OK ||
+                carquet_row_batch_column(batch, 1, &db, &nulls, &n) != CARQUET_OK) {
+                ok = 0;
+            }
+            for (int64_t i = 0; ok && i < n; i++) {
+                if (((const int64_t*)da)[i] != total + i ||
+                    ((const int64_t*)db)[i] != -(total + i) * 7) {
+                    ok = 0;
+                }
+            }
+            total += carquet_row_batch_num_rows(batch);
+            carquet_row_batch_free(batch);
+            batch = NULL;
+        }
+        carquet_batch_reader_free(br);
+
+        /* One request per column chunk, however many pages it holds */
+        int chunk_reads = mem.reads - footer_reads;
+        int expected_async = use_async ? 2 : 0;
+        carquet_reader_close(reader);
+
+        if (!ok || total != num_rows) {
+            free(mem.data);
+            TEST_FAIL("reader_input_source", "Values mismatch");
+        }
+        if (chunk_reads != 2 || mem.async_reads != expected_async) {
+            free(mem.data);
+            TEST_FAIL("reader_input_source", "Unexpected number of source reads");
+        }
+        if (mem.releases != 1) {
+            free(mem.data);
+            TEST_FAIL("reader_input_source", "release should be called once on close");
+        }
+    }
+
+    /* Failed open releases the source too */
+    mem.releases = 0;
+    mem.size = 4;
+    carquet_input_source_t bad = {0};
+    bad.ctx = &mem;
+    bad.size = mem_source_size;
+    bad.read_at = mem_source_read_at;
+    bad.release = mem_source_release;
+    carquet_reader_t* reader = carquet_reader_open_source(&bad, NULL, &err);
+    free(mem.data);
+    if (reader || mem.releases != 1) {
+        carquet_reader_close(reader);
+        TEST_FAIL("reader_input_source", "Failed open should release the source");
+    }
+
+    TEST_PASS("reader_input_source");
+    return 0;
+}
+
+static int test_reader_footer_single_read(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("footer_single_read");
+
+    if (write_two_column_file(path, 1000) != 0) {
+        cleanup_file(path);
+        TEST_FAIL("reader_footer_single_read", "Failed to write file");
+    }
+
+    FILE* f = fopen(path, "rb");
+    fseek(f, 0, SEEK_END);
+    mem_source_t mem = {0};
+    mem.size = ftell(f);
+    mem.data = malloc((size_t)mem.size);
+    fseek(f, 0, SEEK_SET);
+    size_t got = fread(mem.data, 1, (size_t)mem.size, f);
+    fclose(f);
+    cleanup_file(path);
+    if (got != (size_t)mem.size) {
+        free(mem.data);
+        TEST_FAIL("reader_footer_single_read", "Failed to load file");
+    }
+
+    /* Default tail covers the footer; a tiny tail needs a second read */
+    const size_t tail_sizes[3] = { 64 * 1024, 16, 0 };
+    const int expected_reads[3] = { 1, 2, 2 };
+    for (int t = 0; t < 3; t++) {
+        carquet_input_source_t source = {0};
+        source.ctx = &mem;
+        source.size = mem_source_size;
+        source.read_at = mem_source_read_at;
+
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.footer_read_size = tail_sizes[t];
+
+        mem.reads = 0;
+        carquet_reader_t* reader = carquet_reader_open_source(&source, &opts, &err);
+        int reads = mem.reads;
+        int64_t rows = reader ? carquet_reader_num_rows(reader) : -1;
+        carquet_reader_close(reader);
+
+        if (rows != 1000 || reads != expected_reads[t]) {
+            free(mem.data);
+            TEST_FAIL("reader_footer_single_read", "Unexpected footer reads");
+        }
+    }
+
+    free(mem.data);
+    TEST_PASS("reader_footer_single_read");
+    return 0;
+}
+
+static int test_reader_open_file_handle(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("open_file_handle");
+    const int32_t num_rows = 5000;
+
+    if (write_two_column_file(path, num_rows) != 0) {
+        cleanup_file(path);
+        TEST_FAIL("reader_open_file_handle", "Failed to write file");
+    }
+
+    FILE* f = fopen(path, "rb");
+    carquet_reader_t* reader = f ? carquet_reader_open_file(f, NULL, &err) : NULL;
+    if (!reader) {
+        if (f) fclose(f);
+        cleanup_file(path);
+        TEST_FAIL("reader_open_file_handle", "Failed to open reader from FILE*");
+    }
+
+    int64_t values[5000];
+    carquet_column_reader_t* col = carquet_reader_get_column(reader, 0, 1, &err);
+    int64_t n = col ? carquet_column_read_batch(col, values, num_rows, NULL, NULL) : -1;
+    int ok = n == num_rows;
+    for (int64_t i = 0; ok && i < n; i++) {
+        ok = values[i] == -i * 7;
+    }
+    carquet_column_reader_free(col);
+    carquet_reader_close(reader);
+
+    /* The caller still owns the handle */
+    int still_open = fseek(f, 0, SEEK_SET) == 0;
+    fclose(f);
+    cleanup_file(path);
+
+    if (!ok || !still_open) {
+        TEST_FAIL("reader_open_file_handle", "Values mismatch or handle closed");
+    }
+
+    TEST_PASS("reader_open_file_handle");
+    return 0;
+}
+
+static int test_reader_metadata_cache(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512], other[512];
+    snprintf(path, sizeof(path), "%s", get_temp_file("metadata_cache"));
+    snprintf(other, sizeof(other), "%s", get_temp_file("metadata_cache_other"));
+    carquet_metadata_cache_stats_t stats;
+
+    if (write_two_column_file(path, 3000) != 0 || write_two_column_file(other, 1000) != 0) {
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Failed to write files");
+    }
+
+    carquet_metadata_cache_t* cache = carquet_metadata_cache_create(16 * 1024 * 1024, &err);
+    if (!cache) {
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Failed to create cache");
+    }
+
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.metadata_cache = cache;
+
+    /* Second open (pread) and third (mmap) share the first one's footer */
+    carquet_reader_t* r1 = carquet_reader_open(path, &opts, &err);
+    carquet_reader_t* r2 = carquet_reader_open(path, &opts, &err);
+    opts.use_mmap = true;
+    carquet_reader_t* r3 = carquet_reader_open(path, &opts, &err);
+    opts.use_mmap = false;
+    carquet_metadata_cache_get_stats(cache, &stats);
+    int shared = r1 && r2 && r3 &&
+                 carquet_reader_schema(r1) == carquet_reader_schema(r2) &&
+                 carquet_reader_schema(r1) == carquet_reader_schema(r3);
+    carquet_reader_close(r1);
+
+    /* Still usable after the reader that parsed the footer is gone */
+    int64_t values[3000];
+    carquet_column_reader_t* col = r2 ? carquet_reader_get_column(r2, 0, 1, &err) : NULL;
+    int64_t n = 0;
+    while (col && n < 3000) {
+        int64_t got = carquet_column_read_batch(col, values + n, 3000 - n, NULL, NULL);
+        if (got <= 0) break;
+        n += got;
+    }
+    int ok = n == 3000 && values[2999] == -2999 * 7;
+    carquet_column_reader_free(col);
+    carquet_reader_close(r2);
+    carquet_reader_close(r3);
+
+    if (!shared || !ok || stats.hits != 2 || stats.misses != 1 || stats.entries != 1) {
+        carquet_metadata_cache_free(cache);
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Reopen should be served from the cache");
+    }
+
+    /* Rewritten file has a new identity */
+    write_two_column_file(path, 2000);
+    r1 = carquet_reader_open(path, &opts, &err);
+    int64_t rows = r1 ? carquet_reader_num_rows(r1) : -1;
+    carquet_reader_close(r1);
+    carquet_metadata_cache_get_stats(cache, &stats);
+    if (rows != 2000 || stats.misses != 2) {
+        carquet_metadata_cache_free(cache);
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Modified file must not hit the cache");
+    }
+
+    /* Caller key: a cached source open does not read the footer at all */
+    FILE* f = fopen(other, "rb");
+    fseek(f, 0, SEEK_END);
+    mem_source_t mem = {0};
+    mem.size = ftell(f);
+    mem.data = malloc((size_t)mem.size);
+    fseek(f, 0, SEEK_SET);
+    size_t got = fread(mem.data, 1, (size_t)mem.size, f);
+    fclose(f);
+
+    carquet_input_source_t source = {0};
+    source.ctx = &mem;
+    source.size = mem_source_size;
+    source.read_at = mem_source_read_at;
+    opts.metadata_cache_key = "s3://bucket/other.parquet#v1";
+
+    int reads[2] = { -1, -1 };
+    for (int i = 0; i < 2 && got == (size_t)mem.size; i++) {
+        mem.reads = 0;
+        carquet_reader_t* r = carquet_reader_open_source(&source, &opts, &err);
+        reads[i] = mem.reads;
+        rows = r ? carquet_reader_num_rows(r) : -1;
+        carquet_reader_close(r);
+    }
+    free(mem.data);
+    opts.metadata_cache_key = NULL;
+
+    if (reads[0] != 1 || reads[1] != 0 || rows != 1000) {
+        carquet_metadata_cache_free(cache);
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Caller key should skip footer reads");
+    }
+
+    /* Clearing keeps entries of open readers alive */
+    r1 = carquet_reader_open(other, &opts, &err);
+    carquet_metadata_cache_clear(cache);
+    carquet_metadata_cache_get_stats(cache, &stats);
+    rows = r1 ? carquet_reader_num_rows(r1) : -1;
+    carquet_reader_close(r1);
+    carquet_metadata_cache_free(cache);
+
+    if (stats.entries != 0 || stats.bytes != 0 || rows != 1000) {
+        cleanup_file(path);
+        cleanup_file(other);
+        TEST_FAIL("reader_metadata_cache", "Clear mismatch");
+    }
+
+    /* A budget of one entry evicts the older file */
+    cache = carquet_metadata_cache_create(100 * 1024, &err);
+    opts.metadata_cache = cache;
+    r1 = carquet_reader_open(path, &opts, &err);
+    r2 = carquet_reader_open(other, &opts, &err);
+    carquet_metadata_cache_get_stats(cache, &stats);
+    rows = r1 ? carquet_reader_num_rows(r1) : -1;
+    carquet_reader_close(r1);
+    carquet_reader_close(r2);
+    carquet_metadata_cache_free(cache);
+    cleanup_file(path);
+    cleanup_file(other);
+
+    if (!r2 || stats.evictions != 1 || stats.entries != 1 || rows != 2000) {
+        TEST_FAIL("reader_metadata_cache", "LRU eviction mismatch");
+    }
+
+    TEST_PASS("reader_metadata_cache");
+    return 0;
+}
+
+static int test_batch_reader_prefetch(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    const char* path = get_temp_file("batch_prefetch");
+    const int32_t rows_per_group = 2000;
+    const int32_t num_groups = 6;
+
+    carquet_schema_t* schema = carquet_schema_create(&err);
+    for (int c = 0; c < 3; c++) {
+        char name[8];
+        snprintf(name, sizeof(name), "c%d", c);
+        carquet_schema_add_column(schema, name, CARQUET_PHYSICAL_INT64, NULL,
+                                  CARQUET_REPETITION_REQUIRED, 0);
+    }
+
+    carquet_writer_options_t wopts;
+    carquet_writer_options_init(&wopts);
+    wopts.compression = CARQUET_COMPRESSION_ZSTD;
+    wopts.page_size = 4096;
+
+    carquet_writer_t* writer = carquet_writer_create(path, schema, &wopts, &err);
+    if (!writer) {
+        carquet_schema_free(schema);
+        TEST_FAIL("batch_reader_prefetch", "Failed to create writer");
+    }
+
+    int64_t* vals = malloc(sizeof(int64_t) * rows_per_group);
+    for (int32_t g = 0; g < num_groups; g++) {
+        for (int c = 0; c < 3; c++) {
+            for (int32_t i = 0; i < rows_per_group; i++) {
+                vals[i] = ((int64_t)g * rows_per_group + i) * 3 + c;
+            }
+            carquet_writer_write_batch(writer, c, vals, rows_per_group, NULL, NULL);
+        }
+        if (g + 1 < num_groups) {
+            carquet_writer_new_row_group(writer);
+        }
+    }
+    free(vals);
+    carquet_writer_close(writer);
+    carquet_schema_free(schema);
+
+    /* Depths below, equal to and above the number of remaining row groups,
+     * with and without mmap; the last case frees the reader mid-file. */
+    const int32_t depths[4] = { 1, 2, 8, 2 };
+    for (int t = 0; t < 8; t++) {
+        int32_t depth = depths[t % 4];
+        bool early_free = (t % 4) == 3;
+
+        carquet_reader_options_t ropts;
+        carquet_reader_options_init(&ropts);
+        ropts.use_mmap = t >= 4;
+
+        carquet_reader_t* reader = carquet_reader_open(path, &ropts, &err);
+        if (!reader) {
+            cleanup_file(path);
+            TEST_FAIL("batch_reader_prefetch", "Failed to open reader");
+        }
+
+        carquet_batch_reader_config_t config;
+        carquet_batch_reader_config_init(&config);
+        config.batch_size = 700;
+        config.prefetch_depth = depth;
+
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+        int64_t row = 0;
+        int ok = br != NULL;
+        carquet_row_batch_t* batch = NULL;
+        while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+            for (int32_t k = 0; k < 3 && ok; k++) {
+                const void* data;
+                const uint8_t* nulls;
+                int64_t n;
+                if (carquet_row_batch_column(batch, k, &data, &nulls, &n) != CARQUET_OK) {
+                    ok = 0;
+                    break;
+                }
+                for (int64_t i = 0; i < n; i++) {
+                    if (((const int64_t*)data)[i] != (row + i) * 3 + k) {
+                        ok = 0;
+                        break;
+                    }
+                }
+            }
+            row += carquet_row_batch_num_rows(batch);
+            carquet_row_batch_free(batch);
+            batch = NULL;
+            if (early_free && row > rows_per_group) {
+                break;
+            }
+        }
+
+        carquet_batch_reader_free(br);
+        carquet_reader_close(reader);
+
+        if (!ok || (!early_free && row != (int64_t)rows_per_group * num_groups)) {
+            cleanup_file(path);
+            TEST_FAIL("batch_reader_prefetch", "Read-ahead values mismatch");
+        }
+    }
+
+    cleanup_file(path);
+    TEST_PASS("batch_reader_prefetch");
+    return 0;
+}
+
 /* ============================================================================
  * Options Edge Cases
  * ============================================================================
@@ -375,6 +1218,22 @@ static int test_reader_options_defaults(void) {
         TEST_FAIL("reader_options_defaults", "use_mmap should default to false");
     }
 
+    if (opts.coalesce_gap != 1024 * 1024) {
+        TEST_FAIL("reader_options_defaults", "coalesce_gap should default to 1 MB");
+    }
+
+    if (opts.footer_read_size != 64 * 1024) {
+        TEST_FAIL("reader_options_defaults", "footer_read_size should default to 64 KB");
+    }
+
+    if (opts.io_backend != CARQUET_IO_BACKEND_DEFAULT) {
+        TEST_FAIL("reader_options_defaults", "io_backend should default to DEFAULT");
+    }
+
+    if (opts.metadata_cache != NULL || opts.metadata_cache_key != NULL) {
+        TEST_FAIL("reader_options_defaults", "metadata cache should be off by default");
+    }
+
     TEST_PASS("reader_options_defaults");
     return 0;
 }
@@ -422,6 +1281,17 @@ int main(void) {
     printf("\n--- Roundtrip Edge Cases ---\n");
     failures += test_roundtrip_single_row();
 
+    printf("\n--- Positional I/O ---\n");
+    failures += test_reader_pread_interleaved();
+    failures += test_io_plan_ranges();
+    failures += test_reader_coalesced_projection();
+    failures += test_batch_reader_prefetch();
+    failures += test_reader_io_uring();
+    failures += test_reader_input_source();
+    failures += test_reader_footer_single_read();
+    failures += test_reader_open_file_handle();
+    failures += test_reader_metadata_cache();
+
     printf("\n--- Options Edge Cases ---\n");
     failures += test_reader_options_defaults();
     failures += test_writer_options_defaults();
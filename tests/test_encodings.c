@@ -231,6 +231,63 @@ static int test_rle_decoder_skip(void) {
     return 0;
 }
 
+static int test_rle_decoder_skip_bitpacked(void) {
+    /* Distinct values force bit-packed runs */
+    uint32_t input[200];
+    for (int i = 0; i < 200; i++) {
+        input[i] = (uint32_t)((i * 37) % 29);
+    }
+
+    carquet_buffer_t buf;
+    carquet_buffer_init(&buf);
+
+    carquet_status_t status = carquet_rle_encode_all(input, 200, 5, &buf);
+    assert(status == CARQUET_OK);
+    (void)status;
+
+    /* Skip across group boundaries, then mid-group */
+    const int64_t skips[] = { 3, 21, 64, 1, 50 };
+    carquet_rle_decoder_t dec;
+    carquet_rle_decoder_init(&dec,
+        carquet_buffer_data_const(&buf), carquet_buffer_size(&buf), 5);
+
+    int64_t pos = 0;
+    for (int s = 0; s < 5; s++) {
+        int64_t skipped = carquet_rle_decoder_skip(&dec, skips[s]);
+        if (skipped != skips[s]) {
+            carquet_buffer_destroy(&buf);
+            TEST_FAIL("rle_decoder_skip_bitpacked", "short skip");
+        }
+        pos += skipped;
+
+        uint32_t value = carquet_rle_decoder_get(&dec);
+        if (value != input[pos]) {
+            carquet_buffer_destroy(&buf);
+            TEST_FAIL("rle_decoder_skip_bitpacked", "wrong value after skip");
+        }
+        pos++;
+    }
+
+    /* Counting skip reports how many skipped values matched */
+    carquet_rle_decoder_init(&dec,
+        carquet_buffer_data_const(&buf), carquet_buffer_size(&buf), 5);
+    int64_t matches = -1;
+    int64_t expected = 0;
+    for (int i = 0; i < 150; i++) {
+        expected += input[i] == 7;
+    }
+    int64_t skipped = carquet_rle_decoder_skip_count(&dec, 150, 7, &matches);
+    uint32_t next = carquet_rle_decoder_get(&dec);
+    carquet_buffer_destroy(&buf);
+
+    if (skipped != 150 || matches != expected || next != input[150]) {
+        TEST_FAIL("rle_decoder_skip_bitpacked", "counting skip mismatch");
+    }
+
+    TEST_PASS("rle_decoder_skip_bitpacked");
+    return 0;
+}
+
 static int test_rle_levels(void) {
     int16_t input[] = {0, 0, 1, 0, 1, 1, 0, 0, 1, 0};
     int count = sizeof(input) / sizeof(input[0]);
@@ -276,6 +333,7 @@ int main(void) {
     failures += test_rle_repeated_values();
     failures += test_rle_alternating();
     failures += test_rle_decoder_skip();
+    failures += test_rle_decoder_skip_bitpacked();
     failures += test_rle_levels();
 
     printf("\n");
@@ -6,20 +6,23 @@
  * - DELTA_BINARY_PACKED encoding
  * - Dictionary encoding
  * - BYTE_STREAM_SPLIT encoding
+ * - Decoding these encodings from data pages
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <assert.h>
 #include <math.h>
 
 #include <carquet/error.h>
 #include <carquet/types.h>
 #include "core/buffer.h"
+#include "encoding/rle.h"
+#include "reader/reader_internal.h"
+#include "test_helpers.h"
 
-#define TEST_PASS(name) printf("[PASS] %s\n", name)
-#define TEST_FAIL(name, msg) do { printf("[FAIL] %s: %s\n", name, msg); return 1; } while(0)
 
 /* ============================================================================
  * Delta Encoding Function Declarations
@@ -54,6 +57,16 @@ carquet_status_t carquet_delta_decode_int64(
     int32_t num_values,
     size_t* bytes_consumed);
 
+carquet_status_t carquet_delta_length_encode(
+    const carquet_byte_array_t* values,
+    int32_t num_values,
+    carquet_buffer_t* output);
+
+carquet_status_t carquet_delta_strings_encode(
+    const carquet_byte_array_t* values,
+    int32_t num_values,
+    carquet_buffer_t* output);
+
 /* ============================================================================
  * Dictionary Encoding Function Declarations
  * ============================================================================
@@ -165,6 +178,60 @@ carquet_status_t carquet_byte_stream_split_decode(
     uint8_t* values,
     int64_t count);
 
+/* ============================================================================
+ * Page Reader Function Declarations
+ * ============================================================================
+ */
+
+carquet_status_t carquet_read_data_page_v1(
+    carquet_column_reader_t* reader,
+    const uint8_t* page_data,
+    size_t page_size,
+    const parquet_data_page_header_t* header,
+    void* values,
+    int64_t max_values,
+    int32_t first_value,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    carquet_error_t* error);
+
+carquet_status_t carquet_read_data_page_v2(
+    carquet_column_reader_t* reader,
+    const uint8_t* page_data,
+    size_t page_size,
+    const parquet_page_header_t* header,
+    carquet_compression_t codec,
+    void* values,
+    int64_t max_values,
+    int32_t first_value,
+    int16_t* def_levels,
+    int16_t* rep_levels,
+    int64_t* values_read,
+    uint8_t** values_buffer,
+    carquet_error_t* error);
+
+/* ============================================================================
+ * Snappy Function Declarations
+ * ============================================================================
+ */
+
+carquet_status_t carquet_snappy_compress(
+    const uint8_t* src,
+    size_t src_size,
+    uint8_t* dst,
+    size_t dst_capacity,
+    size_t* dst_size);
+
+carquet_status_t carquet_snappy_decompress(
+    const uint8_t* src,
+    size_t src_size,
+    uint8_t* dst,
+    size_t dst_capacity,
+    size_t* dst_size);
+
+size_t carquet_snappy_compress_bound(size_t src_size);
+
 /* ============================================================================
  * Delta Encoding Tests
  * ============================================================================
@@ -372,6 +439,136 @@ static int test_delta_single_value(void) {
     return 0;
 }
 
+static int test_delta_int32_wrapping(void) {
+    /* Consecutive deltas span the whole int32 range */
+    int32_t input[200];
+    for (int i = 0; i < 200; i++) {
+        input[i] = (i % 2) ? INT32_MAX - i : INT32_MIN + i * 3;
+    }
+
+    uint8_t encoded[8192];
+    size_t bytes_written;
+    carquet_status_t status = carquet_delta_encode_int32(
+        input, 200, encoded, sizeof(encoded), &bytes_written);
+    if (status != CARQUET_OK) {
+        TEST_FAIL("delta_int32_wrapping", "encode failed");
+    }
+
+    int32_t output[200];
+    size_t bytes_consumed;
+    status = carquet_delta_decode_int32(
+        encoded, bytes_written, output, 200, &bytes_consumed);
+    if (status != CARQUET_OK) {
+        TEST_FAIL("delta_int32_wrapping", "decode failed");
+    }
+    if (bytes_consumed != bytes_written) {
+        TEST_FAIL("delta_int32_wrapping", "consumed size mismatch");
+    }
+
+    for (int i = 0; i < 200; i++) {
+        if (output[i] != input[i]) {
+            TEST_FAIL("delta_int32_wrapping", "value mismatch");
+        }
+    }
+
+    TEST_PASS("delta_int32_wrapping");
+    return 0;
+}
+
+static int test_delta_int64_wide_deltas(void) {
+    /* Deltas need more than 32 bits; 1000 values end mid mini-block */
+    int64_t input[1000];
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 1000; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        input[i] = (int64_t)(state >> (i % 24));
+    }
+
+    size_t capacity = 1000 * 9 + 1024;
+    uint8_t* encoded = malloc(capacity);
+    size_t bytes_written;
+    carquet_status_t status = carquet_delta_encode_int64(
+        input, 1000, encoded, capacity, &bytes_written);
+    if (status != CARQUET_OK) {
+        free(encoded);
+        TEST_FAIL("delta_int64_wide_deltas", "encode failed");
+    }
+
+    /* Full decode, then a prefix that stops inside a mini-block */
+    int64_t output[1000];
+    size_t bytes_consumed;
+    int32_t counts[] = {1000, 517};
+    for (int c = 0; c < 2; c++) {
+        memset(output, 0, sizeof(output));
+        status = carquet_delta_decode_int64(
+            encoded, bytes_written, output, counts[c], &bytes_consumed);
+        if (status != CARQUET_OK) {
+            free(encoded);
+            TEST_FAIL("delta_int64_wide_deltas", "decode failed");
+        }
+        for (int i = 0; i < counts[c]; i++) {
+            if (output[i] != input[i]) {
+                free(encoded);
+                TEST_FAIL("delta_int64_wide_deltas", "value mismatch");
+            }
+        }
+    }
+
+    free(encoded);
+    TEST_PASS("delta_int64_wide_deltas");
+    return 0;
+}
+
+static int test_delta_int64_bitpacked_40bit(void) {
+    /* Hand-built stream: one block of 32 values in a single mini-block whose
+     * deltas are bit-packed at 40 bits, LSB first, as the spec lays out */
+    uint8_t stream[64 + 32 * 5] = {0};
+    size_t pos = 0;
+    stream[pos++] = 32;           /* block size */
+    stream[pos++] = 1;            /* mini-blocks per block */
+    stream[pos++] = 33;           /* total values */
+    stream[pos++] = 10;           /* first value 5, zigzag */
+    stream[pos++] = 3;            /* min delta -2, zigzag */
+    stream[pos++] = 40;           /* bit width */
+
+    uint64_t adjusted[32];
+    for (int i = 0; i < 32; i++) {
+        adjusted[i] = ((uint64_t)i << 33) | (uint64_t)(i * 7);
+        for (int b = 0; b < 40; b++) {
+            size_t bit = (size_t)i * 40 + (size_t)b;
+            if ((adjusted[i] >> b) & 1) {
+                stream[pos + bit / 8] |= (uint8_t)(1 << (bit % 8));
+            }
+        }
+    }
+    pos += 32 * 5;
+
+    int64_t output[33];
+    size_t bytes_consumed;
+    carquet_status_t status = carquet_delta_decode_int64(
+        stream, pos, output, 33, &bytes_consumed);
+    if (status != CARQUET_OK) {
+        TEST_FAIL("delta_int64_bitpacked_40bit", "decode failed");
+    }
+    if (bytes_consumed != pos) {
+        TEST_FAIL("delta_int64_bitpacked_40bit", "consumed size mismatch");
+    }
+
+    int64_t expected = 5;
+    if (output[0] != expected) {
+        TEST_FAIL("delta_int64_bitpacked_40bit", "first value mismatch");
+    }
+    for (int i = 0; i < 32; i++) {
+        expected += (int64_t)adjusted[i] - 2;
+        if (output[i + 1] != expected) {
+            TEST_FAIL("delta_int64_bitpacked_40bit", "value mismatch");
+        }
+    }
+
+    TEST_PASS("delta_int64_bitpacked_40bit");
+    return 0;
+}
+
 /* ============================================================================
  * Dictionary Encoding Tests
  * ============================================================================
@@ -756,6 +953,688 @@ static int test_byte_stream_split_special_floats(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Page Reader Tests
+ * ============================================================================
+ */
+
+/* An optional INT64 page of timestamps with occasional large jumps, so
+ * some mini-blocks pack deltas wider than 32 bits */
+static int test_page_reader_delta(void) {
+    enum { N = 600 };
+    int16_t levels[N];
+    int64_t stream[N];
+    int64_t non_null = 0;
+    int64_t ts = 1700000000000LL;
+    for (int i = 0; i < N; i++) {
+        levels[i] = (i % 7 == 3) ? 0 : 1;
+        if (levels[i]) {
+            ts += 1000 + (i * 37) % 101;
+            if (i % 97 == 0) ts -= (int64_t)1 << 41;
+            stream[non_null++] = ts;
+        }
+    }
+
+    carquet_buffer_t defs;
+    carquet_buffer_init(&defs);
+    size_t page_capacity = (size_t)N * 9 + 4096;
+    uint8_t* page = malloc(page_capacity);
+    int64_t* values = malloc(N * sizeof(int64_t));
+    int16_t* def_out = malloc(N * sizeof(int16_t));
+    if (!page || !values || !def_out ||
+        carquet_rle_encode_levels(levels, N, 1, &defs) != CARQUET_OK) {
+        free(page); free(values); free(def_out);
+        carquet_buffer_destroy(&defs);
+        TEST_FAIL("page_reader_delta", "setup failed");
+    }
+
+    uint32_t def_size = (uint32_t)carquet_buffer_size(&defs);
+    memcpy(page, &def_size, 4);
+    memcpy(page + 4, carquet_buffer_data(&defs), def_size);
+    size_t page_size = 4 + def_size;
+    size_t delta_size = 0;
+    carquet_status_t status = carquet_delta_encode_int64(
+        stream, (int32_t)non_null, page + page_size, page_capacity - page_size, &delta_size);
+    page_size += delta_size;
+    carquet_buffer_destroy(&defs);
+
+    carquet_column_reader_t reader;
+    memset(&reader, 0, sizeof(reader));
+    reader.type = CARQUET_PHYSICAL_INT64;
+    reader.max_def_level = 1;
+
+    parquet_data_page_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.num_values = N;
+    header.encoding = CARQUET_ENCODING_DELTA_BINARY_PACKED;
+    header.definition_level_encoding = CARQUET_ENCODING_RLE;
+
+    /* Full page, then entered part-way through as a page-index skip would */
+    int32_t firsts[] = {0, 250};
+    for (int f = 0; f < 2 && status == CARQUET_OK; f++) {
+        carquet_error_t err = CARQUET_ERROR_INIT;
+        int64_t values_read = 0;
+        status = carquet_read_data_page_v1(&reader, page, page_size, &header,
+                                           values, N, firsts[f], def_out, NULL,
+                                           &values_read, &err);
+        if (status != CARQUET_OK) break;
+        for (int i = firsts[f]; i < N; i++) {
+            if (def_out[i] != levels[i]) status = CARQUET_ERROR_DECODE;
+        }
+        for (int64_t i = firsts[f]; i < non_null; i++) {
+            if (values[i] != stream[i]) status = CARQUET_ERROR_DECODE;
+        }
+    }
+
+    /* Delta encoding is only defined for integer columns */
+    bool rejected = false;
+    if (status == CARQUET_OK) {
+        carquet_error_t err = CARQUET_ERROR_INIT;
+        int64_t values_read = 0;
+        reader.type = CARQUET_PHYSICAL_DOUBLE;
+        rejected = carquet_read_data_page_v1(&reader, page, page_size, &header,
+                                             values, N, 0, def_out, NULL,
+                                             &values_read, &err) == CARQUET_ERROR_INVALID_ENCODING;
+    }
+
+    free(page);
+    free(values);
+    free(def_out);
+    if (status != CARQUET_OK) {
+        TEST_FAIL("page_reader_delta", "decoded page mismatch");
+    }
+    if (!rejected) {
+        TEST_FAIL("page_reader_delta", "non-integer delta page accepted");
+    }
+
+    TEST_PASS("page_reader_delta");
+    return 0;
+}
+
+/* Required BYTE_ARRAY pages of sorted, prefix-sharing keys in both delta
+ * string encodings: every value must come back as a view into one
+ * contiguous run of page strings */
+static int test_page_reader_delta_strings(void) {
+    enum { N = 500 };
+    char text[N][24];
+    carquet_byte_array_t strings[N];
+    for (int i = 0; i < N; i++) {
+        snprintf(text[i], sizeof(text[0]), "sensor/%04d/%s", i / 3, i % 3 ? "temp" : "");
+        strings[i].data = (uint8_t*)text[i];
+        strings[i].length = (int32_t)strlen(text[i]);
+    }
+
+    carquet_byte_array_t* values = malloc(N * sizeof(carquet_byte_array_t));
+    carquet_column_reader_t reader;
+    memset(&reader, 0, sizeof(reader));
+    reader.type = CARQUET_PHYSICAL_BYTE_ARRAY;
+
+    parquet_data_page_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.num_values = N;
+
+    const carquet_encoding_t encodings[] = {
+        CARQUET_ENCODING_DELTA_LENGTH_BYTE_ARRAY, CARQUET_ENCODING_DELTA_BYTE_ARRAY
+    };
+    const int32_t firsts[] = {0, 123};
+    int ok = values != NULL;
+    for (int e = 0; e < 2 && ok; e++) {
+        carquet_buffer_t page;
+        carquet_buffer_init(&page);
+        carquet_status_t status = e == 0 ? carquet_delta_length_encode(strings, N, &page)
+                                         : carquet_delta_strings_encode(strings, N, &page);
+        header.encoding = encodings[e];
+        for (int f = 0; f < 2 && status == CARQUET_OK && ok; f++) {
+            carquet_error_t err = CARQUET_ERROR_INIT;
+            int64_t values_read = 0;
+            status = carquet_read_data_page_v1(&reader, carquet_buffer_data(&page),
+                                               carquet_buffer_size(&page), &header,
+                                               values, N, firsts[f], NULL, NULL,
+                                               &values_read, &err);
+            for (int i = firsts[f]; status == CARQUET_OK && ok && i < N; i++) {
+                ok = values[i].length == strings[i].length &&
+                     memcmp(values[i].data, strings[i].data, (size_t)strings[i].length) == 0 &&
+                     values[i].data == reader.string_data + reader.string_offsets[i] &&
+                     (i == firsts[f] || values[i].data == values[i - 1].data + values[i - 1].length);
+            }
+        }
+        ok = ok && status == CARQUET_OK;
+
+        /* Truncated string bytes are caught, not read past */
+        if (ok) {
+            carquet_error_t err = CARQUET_ERROR_INIT;
+            int64_t values_read = 0;
+            ok = carquet_read_data_page_v1(&reader, carquet_buffer_data(&page),
+                                           carquet_buffer_size(&page) - 5, &header,
+                                           values, N, 0, NULL, NULL,
+                                           &values_read, &err) != CARQUET_OK;
+        }
+        carquet_buffer_destroy(&page);
+    }
+
+    carquet_column_reader_release_batch(&reader);
+    free(reader.retired_buffers);
+    free(reader.string_offsets);
+    free(reader.string_buffer);
+    free(values);
+    if (!ok) {
+        TEST_FAIL("page_reader_delta_strings", "decoded strings mismatch");
+    }
+
+    TEST_PASS("page_reader_delta_strings");
+    return 0;
+}
+
+/* A V2 page whose entries past the first half are all null: reading from
+ * there needs only the levels, so the (corrupt) compressed values section
+ * is never touched */
+static int test_page_reader_v2_levels_only(void) {
+    int16_t levels[64];
+    for (int i = 0; i < 64; i++) {
+        levels[i] = i < 32 ? 1 : 0;
+    }
+
+    carquet_buffer_t page;
+    carquet_buffer_init(&page);
+    if (carquet_rle_encode_levels(levels, 64, 1, &page) != CARQUET_OK) {
+        carquet_buffer_destroy(&page);
+        TEST_FAIL("page_reader_v2_levels_only", "setup failed");
+    }
+    int32_t def_size = (int32_t)carquet_buffer_size(&page);
+    (void)carquet_buffer_append_fill(&page, 0xFF, 64);
+
+    carquet_column_reader_t reader;
+    memset(&reader, 0, sizeof(reader));
+    reader.type = CARQUET_PHYSICAL_INT32;
+    reader.max_def_level = 1;
+
+    parquet_page_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.type = CARQUET_PAGE_DATA_V2;
+    header.uncompressed_page_size = def_size + 32 * 4;
+    header.compressed_page_size = (int32_t)carquet_buffer_size(&page);
+    header.data_page_header_v2.num_values = 64;
+    header.data_page_header_v2.num_nulls = 32;
+    header.data_page_header_v2.num_rows = 64;
+    header.data_page_header_v2.encoding = CARQUET_ENCODING_PLAIN;
+    header.data_page_header_v2.definition_levels_byte_length = def_size;
+    header.data_page_header_v2.is_compressed = true;
+
+    int32_t values[64];
+    int16_t def_out[64];
+    int64_t values_read = 0;
+    uint8_t* values_buffer = NULL;
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_status_t status = carquet_read_data_page_v2(
+        &reader, carquet_buffer_data(&page), carquet_buffer_size(&page), &header,
+        CARQUET_COMPRESSION_SNAPPY, values, 64, 40, def_out, NULL,
+        &values_read, &values_buffer, &err);
+    carquet_buffer_destroy(&page);
+
+    if (status != CARQUET_OK || values_read != 64 || values_buffer != NULL) {
+        free(values_buffer);
+        TEST_FAIL("page_reader_v2_levels_only", "values section was decoded");
+    }
+    for (int i = 40; i < 64; i++) {
+        if (def_out[i] != 0) {
+            TEST_FAIL("page_reader_v2_levels_only", "def level mismatch");
+        }
+    }
+
+    TEST_PASS("page_reader_v2_levels_only");
+    return 0;
+}
+
+static bool v1_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static int32_t v1_tag_count(int32_t row) {
+    return row % 3 + 1;
+}
+
+static bool v1_tag(int32_t row, int32_t index, void* value) {
+    *(int32_t*)value = row * 10 + index;
+    return true;
+}
+
+static bool v1_name(int32_t row, int32_t index, void* value) {
+    (void)index;
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "name-%d", row);
+    return true;
+}
+
+/* An id, a list of tags (1-3 per row) and a name per row; pages are cut at
+ * batch boundaries, so every page starts on a row */
+static int write_v1_source_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, v1_id },
+        { "tags", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REPEATED, v1_tag_count, v1_tag },
+        { "name", CARQUET_PHYSICAL_BYTE_ARRAY, NULL, CARQUET_REPETITION_REQUIRED, NULL, v1_name },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.page_size = 1024;
+    opts.compression = CARQUET_COMPRESSION_SNAPPY;
+
+    carquet_test_file_t file = { columns, 3, num_rows, 100, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+/* Re-encode one V1 data page of a SNAPPY chunk as a DATA_PAGE_V2: levels
+ * move ahead of the values without length prefixes, and the values are
+ * compressed on their own unless store_raw is set */
+static int append_v2_page(carquet_buffer_t* out, const parquet_page_header_t* v1,
+                          const uint8_t* data, int16_t max_rep, int16_t max_def,
+                          bool store_raw) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    int32_t num_values = v1->data_page_header.num_values;
+    uint8_t* page = malloc((size_t)v1->uncompressed_page_size);
+    int16_t* levels = malloc((size_t)num_values * sizeof(int16_t));
+    size_t page_size = 0;
+    if (!page || !levels ||
+        carquet_snappy_decompress(data, (size_t)v1->compressed_page_size, page,
+                                  (size_t)v1->uncompressed_page_size, &page_size) != CARQUET_OK) {
+        free(page);
+        free(levels);
+        return 1;
+    }
+
+    parquet_page_header_t v2;
+    memset(&v2, 0, sizeof(v2));
+    v2.type = CARQUET_PAGE_DATA_V2;
+    v2.data_page_header_v2.num_values = num_values;
+    v2.data_page_header_v2.num_rows = num_values;
+    v2.data_page_header_v2.encoding = v1->data_page_header.encoding;
+    v2.data_page_header_v2.is_compressed = !store_raw;
+
+    /* Level streams: [4-byte length][RLE] each, repetition levels first */
+    size_t pos = 0;
+    const uint8_t* rep = NULL;
+    const uint8_t* def = NULL;
+    uint32_t rep_len = 0;
+    uint32_t def_len = 0;
+    if (max_rep > 0) {
+        memcpy(&rep_len, page + pos, 4);
+        rep = page + pos + 4;
+        pos += 4 + rep_len;
+        carquet_rle_decode_levels(rep, rep_len, 1, levels, num_values);
+        v2.data_page_header_v2.num_rows = 0;
+        for (int32_t i = 0; i < num_values; i++) {
+            v2.data_page_header_v2.num_rows += levels[i] == 0;
+        }
+    }
+    if (max_def > 0) {
+        memcpy(&def_len, page + pos, 4);
+        def = page + pos + 4;
+        pos += 4 + def_len;
+        carquet_rle_decode_levels(def, def_len, 1, levels, num_values);
+        for (int32_t i = 0; i < num_values; i++) {
+            v2.data_page_header_v2.num_nulls += levels[i] < max_def;
+        }
+    }
+    v2.data_page_header_v2.repetition_levels_byte_length = (int32_t)rep_len;
+    v2.data_page_header_v2.definition_levels_byte_length = (int32_t)def_len;
+
+    const uint8_t* values = page + pos;
+    size_t values_size = page_size - pos;
+    uint8_t* packed = malloc(carquet_snappy_compress_bound(values_size));
+    size_t packed_size = values_size;
+    int failed = !packed;
+    if (!failed && !store_raw) {
+        failed = carquet_snappy_compress(values, values_size, packed,
+                                         carquet_snappy_compress_bound(values_size),
+                                         &packed_size) != CARQUET_OK;
+    }
+
+    v2.uncompressed_page_size = (int32_t)(rep_len + def_len + values_size);
+    v2.compressed_page_size = (int32_t)(rep_len + def_len + packed_size);
+    if (!failed) {
+        failed = parquet_write_page_header(&v2, out, &err) != CARQUET_OK ||
+                 carquet_buffer_append(out, rep, rep_len) != CARQUET_OK ||
+                 carquet_buffer_append(out, def, def_len) != CARQUET_OK ||
+                 carquet_buffer_append(out, store_raw ? values : packed, packed_size) != CARQUET_OK;
+    }
+
+    free(packed);
+    free(page);
+    free(levels);
+    return failed;
+}
+
+/* Rewrite every data page of a carquet file (SNAPPY, V1 pages) as a
+ * DATA_PAGE_V2, storing every other page's values uncompressed */
+static uint8_t* convert_to_data_page_v2(const uint8_t* file, size_t size,
+                                        const int16_t* max_rep, const int16_t* max_def,
+                                        size_t* out_size) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    uint32_t footer_len;
+    memcpy(&footer_len, file + size - 8, 4);
+
+    carquet_arena_t arena;
+    parquet_file_metadata_t meta;
+    if (carquet_arena_init(&arena) != CARQUET_OK) return NULL;
+    if (parquet_parse_file_metadata(file + size - 8 - footer_len, footer_len,
+                                    &arena, &meta, &err) != CARQUET_OK) {
+        carquet_arena_destroy(&arena);
+        return NULL;
+    }
+
+    carquet_buffer_t out;
+    carquet_buffer_init(&out);
+    int failed = carquet_buffer_append(&out, "PAR1", 4) != CARQUET_OK;
+
+    int32_t page_no = 0;
+    for (int32_t rg = 0; rg < meta.num_row_groups && !failed; rg++) {
+        parquet_row_group_t* group = &meta.row_groups[rg];
+        for (int32_t c = 0; c < group->num_columns && !failed; c++) {
+            parquet_column_metadata_t* md = &group->columns[c].metadata;
+            int64_t pos = md->data_page_offset;
+            int64_t end = pos + md->total_compressed_size;
+            int64_t start = (int64_t)out.size;
+
+            while (pos < end && !failed) {
+                parquet_page_header_t header;
+                size_t header_size;
+                failed = parquet_parse_page_header(file + pos, (size_t)(end - pos),
+                                                   &header, &header_size, &err) != CARQUET_OK ||
+                         header.type != CARQUET_PAGE_DATA ||
+                         append_v2_page(&out, &header, file + pos + (int64_t)header_size,
+                                        max_rep[c], max_def[c], page_no++ % 2 == 1);
+                pos += (int64_t)header_size + header.compressed_page_size;
+            }
+
+            md->data_page_offset = start;
+            md->total_compressed_size = (int64_t)out.size - start;
+            md->total_uncompressed_size = md->total_compressed_size;
+            group->columns[c].file_offset = start;
+            if (c == 0) {
+                group->file_offset = start;
+            }
+        }
+    }
+
+    carquet_buffer_t footer;
+    carquet_buffer_init(&footer);
+    if (!failed) {
+        failed = parquet_write_file_metadata(&meta, &footer, &err) != CARQUET_OK;
+    }
+    if (!failed) {
+        uint32_t len = (uint32_t)footer.size;
+        failed = carquet_buffer_append(&out, footer.data, footer.size) != CARQUET_OK ||
+                 carquet_buffer_append(&out, &len, 4) != CARQUET_OK ||
+                 carquet_buffer_append(&out, "PAR1", 4) != CARQUET_OK;
+    }
+    carquet_buffer_destroy(&footer);
+    parquet_file_metadata_free(&meta);
+    carquet_arena_destroy(&arena);
+
+    if (failed) {
+        carquet_buffer_destroy(&out);
+        return NULL;
+    }
+    *out_size = out.size;
+    return out.data;  /* Owned by the caller */
+}
+
+/* Read up to count entries from both readers and compare them. Byte
+ * array views of a batch stay valid across the pages it spans. */
+static int same_batch(carquet_column_reader_t* a, carquet_column_reader_t* b,
+                      bool byte_array, int64_t count) {
+    uint8_t va[256 * sizeof(carquet_byte_array_t)];
+    uint8_t vb[256 * sizeof(carquet_byte_array_t)];
+    int16_t da[256], db[256], ra[256], rb[256];
+    while (count > 0) {
+        int64_t want = count < 256 ? count : 256;
+        int64_t na = carquet_column_read_batch(a, va, want, da, ra);
+        int64_t nb = carquet_column_read_batch(b, vb, want, db, rb);
+        if (na != nb || na < 0) return 0;
+        if (na == 0) return 1;
+        for (int64_t i = 0; i < na; i++) {
+            if (da[i] != db[i] || ra[i] != rb[i]) return 0;
+            if (byte_array) {
+                const carquet_byte_array_t* x = (const carquet_byte_array_t*)va + i;
+                const carquet_byte_array_t* y = (const carquet_byte_array_t*)vb + i;
+                if (x->length != y->length || memcmp(x->data, y->data, (size_t)x->length) != 0) {
+                    return 0;
+                }
+            } else if (((const int32_t*)va)[i] != ((const int32_t*)vb)[i]) {
+                return 0;
+            }
+        }
+        count -= na;
+    }
+    return 1;
+}
+
+static int test_reader_data_page_v2(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char v1_path[512];
+    char v2_path[512];
+    carquet_test_temp_path(v1_path, sizeof(v1_path), "page_v1");
+    carquet_test_temp_path(v2_path, sizeof(v2_path), "page_v2");
+    const int32_t num_rows = 3000;
+    int16_t max_rep[3] = {0};
+    int16_t max_def[3] = {0};
+
+    if (write_v1_source_file(v1_path, num_rows) != 0) {
+        carquet_test_cleanup(v1_path);
+        TEST_FAIL("reader_data_page_v2", "Failed to write file");
+    }
+
+    uint8_t* v1 = NULL;
+    uint8_t* v2 = NULL;
+    size_t v1_size = 0;
+    size_t v2_size = 0;
+    FILE* f = fopen(v1_path, "rb");
+    if (f && fseek(f, 0, SEEK_END) == 0) {
+        v1_size = (size_t)ftell(f);
+        v1 = malloc(v1_size);
+        rewind(f);
+        carquet_reader_t* ref = v1 && fread(v1, 1, v1_size, f) == v1_size
+            ? carquet_reader_open_buffer(v1, v1_size, NULL, &err) : NULL;
+        for (int32_t c = 0; ref && c < 3; c++) {
+            carquet_column_reader_t* col = carquet_reader_get_column(ref, 0, c, &err);
+            if (col) {
+                max_rep[c] = col->max_rep_level;
+                max_def[c] = col->max_def_level;
+                carquet_column_reader_free(col);
+            }
+        }
+        if (ref) {
+            v2 = convert_to_data_page_v2(v1, v1_size, max_rep, max_def, &v2_size);
+            carquet_reader_close(ref);
+        }
+    }
+    if (f) fclose(f);
+    f = v2 ? fopen(v2_path, "wb") : NULL;
+    int ok = f && fwrite(v2, 1, v2_size, f) == v2_size;
+    if (f) fclose(f);
+
+    /* From a buffer (in-memory pages) and from a file without mmap */
+    for (int source = 0; source < 2 && ok; source++) {
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.use_mmap = false;
+        carquet_reader_t* ref = carquet_reader_open_buffer(v1, v1_size, NULL, &err);
+        carquet_reader_t* reader = source == 0
+            ? carquet_reader_open_buffer(v2, v2_size, NULL, &err)
+            : carquet_reader_open(v2_path, &opts, &err);
+        if (!ref || !reader) {
+            ok = 0;
+        }
+
+        for (int32_t c = 0; c < 3 && ok; c++) {
+            carquet_column_reader_t* a = carquet_reader_get_column(ref, 0, c, &err);
+            carquet_column_reader_t* b = carquet_reader_get_column(reader, 0, c, &err);
+            ok = a && b && same_batch(a, b, c == 2, INT64_MAX);
+
+            /* Skips within and across pages, and row seeks, which step over
+             * whole V2 pages of the repeated column by their row count */
+            const int64_t rows[] = { 1234, 7, 2999, 0, 2100 };
+            for (size_t i = 0; ok && i < sizeof(rows) / sizeof(rows[0]); i++) {
+                ok = carquet_column_seek_row(a, rows[i], &err) == CARQUET_OK &&
+                     carquet_column_seek_row(b, rows[i], &err) == CARQUET_OK &&
+                     same_batch(a, b, c == 2, 50) &&
+                     carquet_column_skip(a, 400) == carquet_column_skip(b, 400) &&
+                     same_batch(a, b, c == 2, 50);
+            }
+            carquet_column_reader_free(a);
+            carquet_column_reader_free(b);
+        }
+        carquet_reader_close(ref);
+        carquet_reader_close(reader);
+    }
+
+    free(v1);
+    free(v2);
+    carquet_test_cleanup(v1_path);
+    carquet_test_cleanup(v2_path);
+    if (!ok) {
+        TEST_FAIL("reader_data_page_v2", "V2 pages read differently from V1 pages");
+    }
+
+    TEST_PASS("reader_data_page_v2");
+    return 0;
+}
+
+/* Sensor-like float and double columns written BYTE_STREAM_SPLIT over
+ * several ZSTD pages, next to a PLAIN int column */
+static float bss_float_value(int32_t row) {
+    return 20.0f + (float)(row % 97) * 0.125f;
+}
+
+static double bss_double_value(int32_t row) {
+    return 1013.25 + (double)row * 0.001;
+}
+
+static bool bss_temp(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(float*)value = bss_float_value(row);
+    return true;
+}
+
+static bool bss_pressure(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(double*)value = bss_double_value(row);
+    return true;
+}
+
+static bool bss_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+/* Only floating point columns take BYTE_STREAM_SPLIT */
+static carquet_status_t bss_set_encodings(carquet_writer_t* writer) {
+    if (carquet_writer_set_column_encoding(writer, 0, CARQUET_ENCODING_BYTE_STREAM_SPLIT) != CARQUET_OK ||
+        carquet_writer_set_column_encoding(writer, 1, CARQUET_ENCODING_BYTE_STREAM_SPLIT) != CARQUET_OK ||
+        carquet_writer_set_column_encoding(writer, 2, CARQUET_ENCODING_BYTE_STREAM_SPLIT) !=
+            CARQUET_ERROR_INVALID_ENCODING ||
+        carquet_writer_set_column_encoding(writer, 3, CARQUET_ENCODING_PLAIN) !=
+            CARQUET_ERROR_INVALID_ARGUMENT) {
+        return CARQUET_ERROR_INTERNAL;
+    }
+    return CARQUET_OK;
+}
+
+static int write_bss_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "temp", CARQUET_PHYSICAL_FLOAT, NULL, CARQUET_REPETITION_REQUIRED, NULL, bss_temp },
+        { "pressure", CARQUET_PHYSICAL_DOUBLE, NULL, CARQUET_REPETITION_REQUIRED, NULL, bss_pressure },
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, bss_id },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_ZSTD;
+    opts.page_size = 2048;
+
+    carquet_test_file_t file = { columns, 3, num_rows, 250, 0, 0, &opts, bss_set_encodings };
+    return carquet_test_write_file(path, &file);
+}
+
+static int test_reader_byte_stream_split(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "byte_stream_split");
+    const int32_t num_rows = 5000;
+
+    if (write_bss_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("reader_byte_stream_split", "Failed to write file");
+    }
+
+    int ok = 1;
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    carquet_column_reader_t* temp = reader ? carquet_reader_get_column(reader, 0, 0, &err) : NULL;
+    carquet_column_reader_t* pressure = reader ? carquet_reader_get_column(reader, 0, 1, &err) : NULL;
+    carquet_column_reader_t* ids = reader ? carquet_reader_get_column(reader, 0, 2, &err) : NULL;
+    if (!temp || !pressure || !ids) {
+        ok = 0;
+    }
+
+    /* The chunk metadata names the value encoding */
+    ok = ok && temp->col_meta->encodings[0] == CARQUET_ENCODING_BYTE_STREAM_SPLIT &&
+         pressure->col_meta->encodings[0] == CARQUET_ENCODING_BYTE_STREAM_SPLIT &&
+         ids->col_meta->encodings[0] == CARQUET_ENCODING_PLAIN;
+
+    float tv[100];
+    double pv[100];
+    int32_t row = 0;
+    while (ok && row < num_rows) {
+        int64_t nt = carquet_column_read_batch(temp, tv, 100, NULL, NULL);
+        int64_t np = carquet_column_read_batch(pressure, pv, 100, NULL, NULL);
+        if (nt <= 0 || nt != np) {
+            ok = 0;
+            break;
+        }
+        for (int64_t i = 0; i < nt; i++, row++) {
+            if (tv[i] != bss_float_value(row) || pv[i] != bss_double_value(row)) {
+                ok = 0;
+                break;
+            }
+        }
+    }
+    ok = ok && row == num_rows;
+
+    /* Skipping into the middle of a page still decodes the streams from
+     * the page start */
+    carquet_column_reader_free(temp);
+    carquet_column_reader_free(pressure);
+    temp = reader ? carquet_reader_get_column(reader, 0, 0, &err) : NULL;
+    pressure = reader ? carquet_reader_get_column(reader, 0, 1, &err) : NULL;
+    if (ok && temp && pressure) {
+        const int32_t target = 3001;
+        float t = 0.0f;
+        double p = 0.0;
+        ok = carquet_column_skip(temp, target) == target &&
+             carquet_column_skip(pressure, target) == target &&
+             carquet_column_read_batch(temp, &t, 1, NULL, NULL) == 1 &&
+             carquet_column_read_batch(pressure, &p, 1, NULL, NULL) == 1 &&
+             t == bss_float_value(target) && p == bss_double_value(target);
+    } else {
+        ok = 0;
+    }
+
+    carquet_column_reader_free(temp);
+    carquet_column_reader_free(pressure);
+    carquet_column_reader_free(ids);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+
+    if (!ok) {
+        TEST_FAIL("reader_byte_stream_split", "BYTE_STREAM_SPLIT values did not round trip");
+    }
+
+    TEST_PASS("reader_byte_stream_split");
+    return 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================
@@ -773,6 +1652,9 @@ int main(void) {
     failures += test_delta_int64_sequential();
     failures += test_delta_int64_timestamps();
     failures += test_delta_single_value();
+    failures += test_delta_int32_wrapping();
+    failures += test_delta_int64_wide_deltas();
+    failures += test_delta_int64_bitpacked_40bit();
 
     printf("\n--- Dictionary Encoding Tests ---\n");
     failures += test_dictionary_int32_unique();
@@ -788,6 +1670,13 @@ int main(void) {
     failures += test_byte_stream_split_generic();
     failures += test_byte_stream_split_special_floats();
 
+    printf("\n--- Page Reader Tests ---\n");
+    failures += test_page_reader_delta();
+    failures += test_page_reader_delta_strings();
+    failures += test_page_reader_v2_levels_only();
+    failures += test_reader_data_page_v2();
+    failures += test_reader_byte_stream_split();
+
     printf("\n");
     if (failures == 0) {
         printf("All tests passed!\n");
@@ -2,16 +2,21 @@
  * @file test_helpers.h
  * @brief Portable test helper utilities for carquet tests
  *
- * Provides cross-platform utilities for test file paths and common test macros.
+ * Provides cross-platform utilities for test file paths, common test macros
+ * and a writer for generated test files.
  */
 
 #ifndef CARQUET_TEST_HELPERS_H
 #define CARQUET_TEST_HELPERS_H
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <carquet/carquet.h>
+
 /* Platform-specific includes */
 #ifdef _WIN32
 #include <process.h>
@@ -73,4 +78,198 @@ static inline void carquet_test_cleanup(const char* path) {
     remove(path);
 }
 
+/* ============================================================================
+ * Generated Test Files
+ * ============================================================================
+ */
+
+/* Room for one BYTE_ARRAY value written by a column's value function */
+#define CARQUET_TEST_TEXT_SIZE 32
+
+/**
+ * A column of a generated test file.
+ */
+typedef struct carquet_test_column {
+    const char* name;
+    carquet_physical_type_t type;
+    const carquet_logical_type_t* logical_type;  /* May be NULL */
+    carquet_field_repetition_t repetition;
+
+    /**
+     * REPEATED columns only: number of entries of a row; 0 writes an empty
+     * list (one entry with definition level 0).
+     */
+    int32_t (*count)(int32_t row);
+
+    /**
+     * Store entry index of row into value (a CARQUET_TEST_TEXT_SIZE char
+     * buffer for BYTE_ARRAY, taken up to its NUL). Return false for a null
+     * entry of an OPTIONAL column.
+     */
+    bool (*value)(int32_t row, int32_t index, void* value);
+} carquet_test_column_t;
+
+/**
+ * A generated test file. Rows are written batch_rows at a time, one
+ * column after the other; the writer cuts pages at batch boundaries, so
+ * batches also decide where pages may end.
+ */
+typedef struct carquet_test_file {
+    const carquet_test_column_t* columns;
+    int32_t num_columns;
+    int32_t num_rows;
+    int32_t batch_rows;     /* 0: all rows (of a row group) at once */
+    int32_t batch_entries;  /* REPEATED columns: entries per write, 0: the whole batch */
+    int32_t group_rows;     /* Start a new row group every group_rows rows, 0: one group */
+    const carquet_writer_options_t* options;  /* May be NULL */
+
+    /* Called after the writer is created; a failure fails the write */
+    carquet_status_t (*setup)(carquet_writer_t* writer);
+} carquet_test_file_t;
+
+static inline size_t carquet_test_value_size(carquet_physical_type_t type) {
+    switch (type) {
+        case CARQUET_PHYSICAL_BOOLEAN: return sizeof(uint8_t);
+        case CARQUET_PHYSICAL_INT32: return sizeof(int32_t);
+        case CARQUET_PHYSICAL_INT64: return sizeof(int64_t);
+        case CARQUET_PHYSICAL_FLOAT: return sizeof(float);
+        case CARQUET_PHYSICAL_DOUBLE: return sizeof(double);
+        case CARQUET_PHYSICAL_BYTE_ARRAY: return sizeof(carquet_byte_array_t);
+        default: return 0;
+    }
+}
+
+/**
+ * Write the rows [start, start + num_rows) of one column. Values are
+ * packed: null entries and empty lists only have levels.
+ */
+static inline carquet_status_t carquet_test_write_column(
+    carquet_writer_t* writer,
+    const carquet_test_file_t* file,
+    int32_t column_index,
+    int32_t start,
+    int32_t num_rows) {
+
+    const carquet_test_column_t* column = &file->columns[column_index];
+    bool repeated = column->repetition == CARQUET_REPETITION_REPEATED;
+    size_t value_size = carquet_test_value_size(column->type);
+    if (value_size == 0) {
+        return CARQUET_ERROR_NOT_IMPLEMENTED;
+    }
+
+    int64_t num_entries = 0;
+    for (int32_t row = start; row < start + num_rows; row++) {
+        int32_t count = repeated ? column->count(row) : 1;
+        num_entries += count > 0 ? count : 1;
+    }
+
+    uint8_t* values = malloc((size_t)num_entries * value_size);
+    char* text = malloc((size_t)num_entries * CARQUET_TEST_TEXT_SIZE);
+    int16_t* def_levels = malloc((size_t)num_entries * sizeof(int16_t));
+    int16_t* rep_levels = malloc((size_t)num_entries * sizeof(int16_t));
+    carquet_status_t status = values && text && def_levels && rep_levels
+        ? CARQUET_OK : CARQUET_ERROR_OUT_OF_MEMORY;
+
+    int64_t entry = 0;
+    int64_t present = 0;
+    for (int32_t row = start; status == CARQUET_OK && row < start + num_rows; row++) {
+        int32_t count = repeated ? column->count(row) : 1;
+        if (count == 0) {
+            def_levels[entry] = 0;
+            rep_levels[entry] = 0;
+            entry++;
+        }
+        for (int32_t index = 0; index < count; index++, entry++) {
+            char* slot = text + present * CARQUET_TEST_TEXT_SIZE;
+            void* value = column->type == CARQUET_PHYSICAL_BYTE_ARRAY
+                ? (void*)slot : (void*)(values + (size_t)present * value_size);
+            def_levels[entry] = column->value(row, index, value) ? 1 : 0;
+            rep_levels[entry] = index > 0 ? 1 : 0;
+            if (!def_levels[entry]) {
+                continue;
+            }
+            if (column->type == CARQUET_PHYSICAL_BYTE_ARRAY) {
+                carquet_byte_array_t* array = (carquet_byte_array_t*)values + present;
+                array->data = (uint8_t*)slot;
+                array->length = (int32_t)strlen(slot);
+            }
+            present++;
+        }
+    }
+
+    int64_t chunk = repeated && file->batch_entries > 0 ? file->batch_entries : num_entries;
+    int64_t packed = 0;
+    for (int64_t first = 0; status == CARQUET_OK && first < num_entries; first += chunk) {
+        int64_t n = num_entries - first < chunk ? num_entries - first : chunk;
+        status = carquet_writer_write_batch(
+            writer, column_index, values + (size_t)packed * value_size, n,
+            column->repetition != CARQUET_REPETITION_REQUIRED ? def_levels + first : NULL,
+            repeated ? rep_levels + first : NULL);
+        for (int64_t i = first; i < first + n; i++) {
+            packed += def_levels[i];
+        }
+    }
+
+    free(values);
+    free(text);
+    free(def_levels);
+    free(rep_levels);
+    return status;
+}
+
+/**
+ * Write a generated test file to path.
+ *
+ * @return 0 on success, 1 on failure
+ */
+static inline int carquet_test_write_file(const char* path, const carquet_test_file_t* file) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_schema_t* schema = carquet_schema_create(&err);
+    if (!schema) return 1;
+
+    carquet_status_t status = CARQUET_OK;
+    for (int32_t c = 0; c < file->num_columns && status == CARQUET_OK; c++) {
+        const carquet_test_column_t* column = &file->columns[c];
+        status = carquet_schema_add_column(schema, column->name, column->type,
+                                           column->logical_type, column->repetition, 0);
+    }
+
+    carquet_writer_t* writer = status == CARQUET_OK
+        ? carquet_writer_create(path, schema, file->options, &err) : NULL;
+    if (!writer) {
+        carquet_schema_free(schema);
+        return 1;
+    }
+    if (file->setup) {
+        status = file->setup(writer);
+    }
+
+    int32_t group_rows = file->group_rows > 0 ? file->group_rows : file->num_rows;
+    int32_t batch_rows = file->batch_rows > 0 ? file->batch_rows : group_rows;
+    for (int32_t start = 0; start < file->num_rows && status == CARQUET_OK; ) {
+        if (start > 0 && start % group_rows == 0) {
+            status = carquet_writer_new_row_group(writer);
+        }
+
+        int32_t end = start + batch_rows;
+        int32_t group_end = (start / group_rows + 1) * group_rows;
+        if (end > group_end) end = group_end;
+        if (end > file->num_rows) end = file->num_rows;
+
+        for (int32_t c = 0; c < file->num_columns && status == CARQUET_OK; c++) {
+            status = carquet_test_write_column(writer, file, c, start, end - start);
+        }
+        start = end;
+    }
+
+    if (status != CARQUET_OK) {
+        carquet_writer_abort(writer);
+        carquet_schema_free(schema);
+        return 1;
+    }
+    status = carquet_writer_close(writer);
+    carquet_schema_free(schema);
+    return status == CARQUET_OK ? 0 : 1;
+}
+
 #endif /* CARQUET_TEST_HELPERS_H */
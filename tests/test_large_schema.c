@@ -262,6 +262,145 @@ static int test_large_schema_read(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: Lazy metadata decoding with a narrow projection
+ * ============================================================================ */
+
+static size_t cached_footer_bytes(carquet_metadata_cache_t* cache, bool lazy) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.metadata_cache = cache;
+    opts.lazy_metadata = lazy;
+
+    carquet_metadata_cache_clear(cache);
+    carquet_reader_t* reader = carquet_reader_open(TEST_FILE, &opts, &err);
+    if (!reader) {
+        return 0;
+    }
+    carquet_reader_close(reader);
+
+    carquet_metadata_cache_stats_t stats;
+    carquet_metadata_cache_get_stats(cache, &stats);
+    return stats.bytes;
+}
+
+/* Decode every chunk of a lazy cached footer; returns the cache stats */
+static int decode_cached_chunks(carquet_metadata_cache_t* cache,
+                                carquet_metadata_cache_stats_t* stats) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.metadata_cache = cache;
+    opts.lazy_metadata = true;
+
+    carquet_metadata_cache_clear(cache);
+    carquet_reader_t* reader = carquet_reader_open(TEST_FILE, &opts, &err);
+    if (!reader) {
+        return 0;
+    }
+
+    int ok = 1;
+    for (int32_t col = 0; ok && col < NUM_COLUMNS; col++) {
+        carquet_column_statistics_t col_stats;
+        ok = carquet_reader_column_statistics(reader, 0, col, &col_stats) == CARQUET_OK;
+    }
+    carquet_reader_close(reader);
+
+    carquet_metadata_cache_get_stats(cache, stats);
+    return ok;
+}
+
+static int test_large_schema_lazy_metadata(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+
+    printf("Reading with lazy metadata...\n");
+
+    /* Footer memory as accounted by a metadata cache */
+    carquet_metadata_cache_t* cache = carquet_metadata_cache_create(256 * 1024 * 1024, &err);
+    size_t eager_bytes = cache ? cached_footer_bytes(cache, false) : 0;
+    size_t lazy_bytes = cache ? cached_footer_bytes(cache, true) : 0;
+
+    /* Chunks decoded after insert are charged to the cache */
+    carquet_metadata_cache_stats_t decoded;
+    int decoded_ok = cache && decode_cached_chunks(cache, &decoded);
+    carquet_metadata_cache_free(cache);
+
+    printf("  Footer memory: eager %zu bytes, lazy %zu bytes\n", eager_bytes, lazy_bytes);
+    if (eager_bytes == 0 || lazy_bytes == 0 || lazy_bytes * 2 > eager_bytes) {
+        TEST_FAIL("large_schema_lazy_metadata", "lazy footer should need far less memory");
+    }
+    if (!decoded_ok || decoded.entries != 1 || decoded.bytes <= lazy_bytes) {
+        TEST_FAIL("large_schema_lazy_metadata", "decoded chunks not charged to the cache");
+    }
+
+    /* ... and evict the entry once it outgrows the limit */
+    cache = carquet_metadata_cache_create(lazy_bytes + (eager_bytes - lazy_bytes) / 4, &err);
+    decoded_ok = cache && decode_cached_chunks(cache, &decoded);
+    carquet_metadata_cache_free(cache);
+    if (!decoded_ok || decoded.entries != 0 || decoded.bytes != 0 || decoded.evictions != 1) {
+        TEST_FAIL("large_schema_lazy_metadata", "cache limit not enforced for lazy entries");
+    }
+
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.lazy_metadata = true;
+
+    carquet_reader_t* reader = carquet_reader_open(TEST_FILE, &opts, &err);
+    if (!reader) {
+        printf("  Failed to open file: %s\n", err.message);
+        TEST_FAIL("large_schema_lazy_metadata", "failed to open file");
+    }
+
+    /* Statistics decode their chunk on demand */
+    carquet_column_statistics_t stats;
+    if (carquet_reader_column_statistics(reader, 0, 1000, &stats) != CARQUET_OK ||
+        stats.num_values != NUM_ROWS) {
+        carquet_reader_close(reader);
+        TEST_FAIL("large_schema_lazy_metadata", "statistics mismatch");
+    }
+
+    carquet_batch_reader_config_t config;
+    carquet_batch_reader_config_init(&config);
+    int32_t proj_cols[] = {1500, 1598};  /* INT32, FLOAT */
+    config.column_indices = proj_cols;
+    config.num_columns = 2;
+    config.batch_size = NUM_ROWS;
+
+    carquet_batch_reader_t* batch_reader = carquet_batch_reader_create(reader, &config, &err);
+    carquet_row_batch_t* batch = NULL;
+    int64_t total_rows = 0;
+    int ok = batch_reader != NULL;
+
+    while (ok && carquet_batch_reader_next(batch_reader, &batch) == CARQUET_OK && batch) {
+        const void* ints;
+        const void* floats;
+        const uint8_t* nulls;
+        int64_t n;
+        if (carquet_row_batch_column(batch, 0, &ints, &nulls, &n) != CARQUET_OK ||
+            carquet_row_batch_column(batch, 1, &floats, &nulls, &n) != CARQUET_OK) {
+            ok = 0;
+        }
+        for (int64_t i = 0; ok && i < n; i++) {
+            ok = ((const int32_t*)ints)[i] == (int32_t)(total_rows + i) * 100 &&
+                 ((const float*)floats)[i] == (float)(total_rows + i) * 0.5f;
+        }
+        total_rows += carquet_row_batch_num_rows(batch);
+        carquet_row_batch_free(batch);
+        batch = NULL;
+    }
+
+    carquet_batch_reader_free(batch_reader);
+    carquet_reader_close(reader);
+
+    if (!ok || total_rows != NUM_ROWS) {
+        TEST_FAIL("large_schema_lazy_metadata", "projected values mismatch");
+    }
+
+    TEST_PASS("large_schema_lazy_metadata");
+    return 0;
+}
+
 /* ============================================================================
  * Test: Verify file with external tool (if available)
  * ============================================================================ */
@@ -428,12 +567,17 @@ int main(void) {
         failures += test_large_schema_read();
     }
 
-    /* Test 3: Verify with PyArrow if available */
+    /* Test 3: Lazy metadata with a narrow projection */
+    if (failures == 0) {
+        failures += test_large_schema_lazy_metadata();
+    }
+
+    /* Test 4: Verify with PyArrow if available */
     if (failures == 0) {
         failures += test_verify_with_pyarrow();
     }
 
-    /* Test 4: Very large schema (5000 columns) */
+    /* Test 5: Very large schema (5000 columns) */
     printf("\n");
     failures += test_very_large_schema();
 
@@ -9,8 +9,8 @@
 #include <string.h>
 #include <math.h>
 
-#define TEST_PASS(name) printf("[PASS] %s\n", name)
-#define TEST_FAIL(name, msg) do { printf("[FAIL] %s: %s\n", name, msg); return 1; } while(0)
+#include "reader/reader_internal.h"
+#include "test_helpers.h"
 
 /* ============================================================================
  * Helper: Create a test file with uncompressed data
@@ -407,6 +407,172 @@ static int test_fread_fallback(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: Per-chunk residency accounting and the resident cap
+ * ============================================================================
+ */
+
+static bool residency_a(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int64_t*)value = (int64_t)row * 2;
+    return true;
+}
+
+static bool residency_b(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int64_t*)value = (int64_t)row * 2 + 1;
+    return true;
+}
+
+static int test_mmap_residency(void) {
+    const char* name = "mmap_residency";
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "mmap_residency");
+    const int32_t num_rows = 600000;
+
+    /* Uncompressed so chunks span several MB and pages are zero-copy views */
+    static const carquet_test_column_t columns[] = {
+        { "a", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, residency_a },
+        { "b", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, residency_b },
+    };
+    carquet_test_file_t file = { columns, 2, num_rows, 0, 0, 0, NULL, NULL };
+    if (carquet_test_write_file(path, &file) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL(name, "Failed to write file");
+    }
+
+    const size_t caps[2] = { 0, 1024 * 1024 };
+    for (int t = 0; t < 2; t++) {
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.use_mmap = true;
+        opts.mmap_max_resident = caps[t];
+
+        carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+        if (!reader || !carquet_reader_is_mmap(reader)) {
+            carquet_reader_close(reader);
+            carquet_test_cleanup(path);
+            TEST_FAIL(name, "Failed to open mmap reader");
+        }
+
+        carquet_batch_reader_config_t config;
+        carquet_batch_reader_config_init(&config);
+        config.batch_size = 50000;
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+
+        int64_t total = 0;
+        int ok = br != NULL;
+        carquet_row_batch_t* batch = NULL;
+        while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+            for (int32_t k = 0; k < 2 && ok; k++) {
+                const void* data;
+                const uint8_t* nulls;
+                int64_t n;
+                if (carquet_row_batch_column(batch, k, &data, &nulls, &n) != CARQUET_OK) {
+                    ok = 0;
+                    break;
+                }
+                for (int64_t i = 0; i < n; i++) {
+                    if (((const int64_t*)data)[i] != (total + i) * 2 + k) {
+                        ok = 0;
+                        break;
+                    }
+                }
+            }
+            if (caps[t] > 0 && reader->mmap_info->resident > (int64_t)caps[t]) {
+                ok = 0;
+            }
+            total += carquet_row_batch_num_rows(batch);
+            carquet_row_batch_free(batch);
+            batch = NULL;
+        }
+        carquet_batch_reader_free(br);
+
+        /* Freed column readers hand their whole window back */
+        int64_t resident = reader->mmap_info->resident;
+        carquet_reader_close(reader);
+
+        if (!ok || total != num_rows || resident != 0) {
+            carquet_test_cleanup(path);
+            TEST_FAIL(name, "Values or residency accounting mismatch");
+        }
+    }
+
+    carquet_test_cleanup(path);
+    TEST_PASS(name);
+    return 0;
+}
+
+/* Drive two chunk windows by hand under a 1 MB cap so that one window runs
+ * out of budget and the next page starts past its read-ahead: the bytes
+ * skipped over were never charged and must not be released either */
+static int test_mmap_residency_budget(void) {
+    const char* name = "mmap_residency_budget";
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "mmap_residency_budget");
+    const int64_t cap = 1024 * 1024;
+
+    static const carquet_test_column_t columns[] = {
+        { "a", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, residency_a },
+        { "b", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_REQUIRED, NULL, residency_b },
+    };
+    carquet_test_file_t file = { columns, 2, 600000, 0, 0, 0, NULL, NULL };
+    if (carquet_test_write_file(path, &file) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL(name, "Failed to write file");
+    }
+
+    carquet_reader_options_t opts;
+    carquet_reader_options_init(&opts);
+    opts.use_mmap = true;
+    opts.mmap_max_resident = (size_t)cap;
+    carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+    carquet_column_reader_t* a = reader ? carquet_reader_get_column(reader, 0, 0, &err) : NULL;
+    carquet_column_reader_t* b = reader ? carquet_reader_get_column(reader, 0, 1, &err) : NULL;
+    if (!a || !b || !carquet_reader_is_mmap(reader)) {
+        carquet_column_reader_free(a);
+        carquet_column_reader_free(b);
+        carquet_reader_close(reader);
+        carquet_test_cleanup(path);
+        TEST_FAIL(name, "Failed to open mmap reader");
+    }
+    const int64_t* resident = &reader->mmap_info->resident;
+    int64_t a_start, b_start, b_end, length;
+    int ok = carquet_io_chunk_range(reader, a->col_meta, &a_start, &length) &&
+             carquet_io_chunk_range(reader, b->col_meta, &b_start, &length);
+    b_end = b_start + length;
+
+    /* b holds the last 300 KB of its chunk, a takes the other 700 KB */
+    carquet_mmap_chunk_advance(b, b_start);
+    carquet_mmap_chunk_advance(b, b_end - 300 * 1024);
+    ok = ok && *resident >= 0 && *resident <= cap;
+    carquet_mmap_chunk_advance(a, a_start);
+    ok = ok && *resident == cap;
+
+    /* With b done, a's next page lies past its read-ahead */
+    carquet_mmap_chunk_end(b);
+    ok = ok && *resident >= 0 && *resident <= cap;
+    carquet_mmap_chunk_advance(a, a_start + 800 * 1024);
+    ok = ok && *resident >= 0 && *resident <= cap;
+    carquet_mmap_chunk_advance(a, a_start + 1500 * 1024);
+    ok = ok && *resident >= 0 && *resident <= cap;
+    carquet_mmap_chunk_end(a);
+    ok = ok && *resident == 0;
+
+    carquet_column_reader_free(a);
+    carquet_column_reader_free(b);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL(name, "Resident bytes left the [0, cap] range");
+    }
+
+    TEST_PASS(name);
+    return 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================
@@ -423,6 +589,8 @@ int main(void) {
     failures += test_mmap_batch_reader();
     failures += test_mmap_vs_fread();
     failures += test_fread_fallback();
+    failures += test_mmap_residency();
+    failures += test_mmap_residency_budget();
 
     /* Cleanup */
     remove(TEST_FILE);
@@ -9,6 +9,8 @@
 #include <assert.h>
 
 #include <carquet/carquet.h>
+#include "reader/reader_internal.h"
+#include "encoding/rle.h"
 #include "test_helpers.h"
 
 static int test_version(void) {
@@ -383,6 +385,1742 @@ static int test_write_simple_file(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: Packed values across partial reads of a page
+ * ============================================================================ */
+
+static int test_column_read_packed_resume(void) {
+    char test_file[512];
+    carquet_test_temp_path(test_file, sizeof(test_file), "packed_resume");
+    carquet_error_t err = CARQUET_ERROR_INIT;
+
+    /* OPTIONAL INT32 with every third row null, all in one page */
+    carquet_schema_t* schema = carquet_schema_create(&err);
+    assert(schema);
+    carquet_status_t status = carquet_schema_add_column(
+        schema, "v", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_OPTIONAL, 0);
+    assert(status == CARQUET_OK);
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_UNCOMPRESSED;
+    carquet_writer_t* writer = carquet_writer_create(test_file, schema, &opts, &err);
+    assert(writer);
+
+    const int num_rows = 60;
+    int32_t values[60];
+    int16_t def_levels[60];
+    int num_values = 0;
+    for (int i = 0; i < num_rows; i++) {
+        def_levels[i] = i % 3 != 0;
+        if (def_levels[i]) {
+            values[num_values++] = i;
+        }
+    }
+    status = carquet_writer_write_batch(writer, 0, values, num_rows, def_levels, NULL);
+    assert(status == CARQUET_OK);
+    status = carquet_writer_close(writer);
+    carquet_schema_free(schema);
+    if (status != CARQUET_OK) {
+        TEST_FAIL("column_read_packed_resume", "writer close failed");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(test_file, NULL, &err);
+    carquet_column_reader_t* col = reader ? carquet_reader_get_column(reader, 0, 0, &err) : NULL;
+    if (!col) {
+        carquet_reader_close(reader);
+        remove(test_file);
+        TEST_FAIL("column_read_packed_resume", "failed to open column");
+    }
+
+    /* Read 10 entries, 10 more, skip 5, then the rest: each read returns
+     * the values of its own entries, packed */
+    const int64_t steps[] = {10, 10, -5, 35};
+    int64_t row = 0;
+    int ok = 1;
+    for (size_t s = 0; ok && s < sizeof(steps) / sizeof(steps[0]); s++) {
+        if (steps[s] < 0) {
+            ok = carquet_column_skip(col, -steps[s]) == -steps[s];
+            row += -steps[s];
+            continue;
+        }
+
+        int32_t out[60];
+        int16_t defs[60];
+        int64_t n = carquet_column_read_batch(col, out, steps[s], defs, NULL);
+        ok = n == steps[s];
+        int32_t k = 0;
+        for (int64_t i = 0; ok && i < n; i++, row++) {
+            ok = defs[i] == (row % 3 != 0);
+            if (ok && defs[i]) {
+                ok = out[k++] == (int32_t)row;
+            }
+        }
+    }
+
+    carquet_column_reader_free(col);
+    carquet_reader_close(reader);
+    remove(test_file);
+
+    if (!ok || row != num_rows) {
+        TEST_FAIL("column_read_packed_resume", "values do not follow their entries");
+    }
+    TEST_PASS("column_read_packed_resume");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Page index filtering and row seeks
+ * ============================================================================ */
+
+static bool sorted_value(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static int write_sorted_int32_file(const char* path, int32_t num_rows, bool page_index) {
+    static const carquet_test_column_t columns[] = {
+        { "v", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, sorted_value },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.page_size = 4096;
+    opts.write_page_index = page_index;
+
+    /* Pages are cut at batch boundaries, so write in small batches */
+    carquet_test_file_t file = { columns, 1, num_rows, 500, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+/* Seek to row and check the next few values */
+static int seek_and_check(carquet_column_reader_t* col, int64_t row, int32_t num_rows) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    if (carquet_column_seek_row(col, row, &err) != CARQUET_OK) return 0;
+
+    int32_t values[64];
+    int64_t expected = row;
+    while (expected < row + 1200 && expected < num_rows) {
+        int64_t n = carquet_column_read_batch(col, values, 64, NULL, NULL);
+        if (n <= 0) return 0;
+        for (int64_t i = 0; i < n; i++) {
+            if (values[i] != expected + i) return 0;
+        }
+        expected += n;
+    }
+    return 1;
+}
+
+static int test_reader_page_index(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    char plain[512];
+    carquet_test_temp_path(path, sizeof(path), "page_index");
+    carquet_test_temp_path(plain, sizeof(plain), "page_index_plain");
+    const int32_t num_rows = 50000;
+
+    if (write_sorted_int32_file(path, num_rows, true) != 0 ||
+        write_sorted_int32_file(plain, num_rows, false) != 0) {
+        carquet_test_cleanup(path);
+        carquet_test_cleanup(plain);
+        TEST_FAIL("reader_page_index", "Failed to write file");
+    }
+
+    int ok = 1;
+    for (int use_mmap = 0; use_mmap < 2 && ok; use_mmap++) {
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.use_mmap = use_mmap != 0;
+        carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+        if (!reader) {
+            ok = 0;
+            break;
+        }
+
+        /* A point lookup narrows to the single page holding the key */
+        carquet_row_range_t ranges[16];
+        int32_t key = 30000;
+        int32_t n = carquet_reader_filter_pages(reader, 0, 0, CARQUET_COMPARE_EQ,
+                                                &key, sizeof(key), ranges, 16);
+        if (n != 1 || ranges[0].first_row > key ||
+            ranges[0].first_row + ranges[0].num_rows <= key ||
+            ranges[0].num_rows >= num_rows / 4) {
+            ok = 0;
+        }
+
+        /* A range predicate keeps the tail of the chunk */
+        key = 45000;
+        n = carquet_reader_filter_pages(reader, 0, 0, CARQUET_COMPARE_GT,
+                                        &key, sizeof(key), ranges, 16);
+        if (n != 1 || ranges[0].first_row > key || ranges[0].first_row < 40000 ||
+            ranges[0].first_row + ranges[0].num_rows != num_rows) {
+            ok = 0;
+        }
+
+        key = num_rows;
+        n = carquet_reader_filter_pages(reader, 0, 0, CARQUET_COMPARE_GE,
+                                        &key, sizeof(key), ranges, 16);
+        if (n != 0) {
+            ok = 0;
+        }
+
+        /* Forward, backward and in-page seeks */
+        carquet_column_reader_t* col = carquet_reader_get_column(reader, 0, 0, &err);
+        if (!col) {
+            ok = 0;
+        } else {
+            const int64_t rows[] = { 30000, 30500, 123, 49990, 0, 17001 };
+            for (size_t i = 0; ok && i < sizeof(rows) / sizeof(rows[0]); i++) {
+                ok = seek_and_check(col, rows[i], num_rows);
+            }
+            if (ok && (carquet_column_seek_row(col, num_rows, &err) != CARQUET_OK ||
+                       carquet_column_has_next(col))) {
+                ok = 0;
+            }
+            if (ok && carquet_column_seek_row(col, num_rows + 1, &err) == CARQUET_OK) {
+                ok = 0;
+            }
+            carquet_column_reader_free(col);
+        }
+        carquet_reader_close(reader);
+    }
+
+    /* Without a page index the whole chunk is one range and seeks skip */
+    carquet_reader_t* reader = ok ? carquet_reader_open(plain, NULL, &err) : NULL;
+    if (reader) {
+        carquet_row_range_t range;
+        int32_t key = 30000;
+        int32_t n = carquet_reader_filter_pages(reader, 0, 0, CARQUET_COMPARE_EQ,
+                                                &key, sizeof(key), &range, 1);
+        if (n != 1 || range.first_row != 0 || range.num_rows != num_rows) {
+            ok = 0;
+        }
+        carquet_column_reader_t* col = carquet_reader_get_column(reader, 0, 0, &err);
+        if (!col || !seek_and_check(col, 30000, num_rows) || !seek_and_check(col, 123, num_rows)) {
+            ok = 0;
+        }
+        carquet_column_reader_free(col);
+        carquet_reader_close(reader);
+    } else {
+        ok = 0;
+    }
+
+    carquet_test_cleanup(path);
+    carquet_test_cleanup(plain);
+
+    if (!ok) {
+        TEST_FAIL("reader_page_index", "Page index filtering or seeking mismatch");
+    }
+
+    TEST_PASS("reader_page_index");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Skipping values without decoding them
+ * ============================================================================ */
+
+static bool skip_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static bool skip_name(int32_t row, int32_t index, void* value) {
+    (void)index;
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "n%d", row * (row % 5));
+    return true;
+}
+
+static bool skip_flag(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(uint8_t*)value = (uint8_t)((row * 7) % 3 == 0);
+    return true;
+}
+
+static bool skip_score(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return row % 3 != 0;
+}
+
+static int write_skip_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, skip_id },
+        { "name", CARQUET_PHYSICAL_BYTE_ARRAY, NULL, CARQUET_REPETITION_REQUIRED, NULL, skip_name },
+        { "flag", CARQUET_PHYSICAL_BOOLEAN, NULL, CARQUET_REPETITION_REQUIRED, NULL, skip_flag },
+        { "score", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_OPTIONAL, NULL, skip_score },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_UNCOMPRESSED;  /* Keeps string views valid across pages */
+    opts.page_size = 2048;
+
+    carquet_test_file_t file = { columns, 4, num_rows, 250, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+/* Skipping must leave a column exactly where reading the same number of
+ * values would. Compares one reader that skips with one that reads; for
+ * the nullable column only the levels are compared. */
+static int check_skip_matches_read(carquet_reader_t* reader, int32_t col) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_column_reader_t* a = carquet_reader_get_column(reader, 0, col, &err);
+    carquet_column_reader_t* b = carquet_reader_get_column(reader, 0, col, &err);
+    int ok = a && b;
+
+    const int64_t skips[] = { 3, 1, 0, 700, 37, 4000, 251, 9, 2500 };
+    carquet_byte_array_t va[64], vb[64];  /* Large enough for every type */
+    int16_t da[64], db[64];
+    for (size_t s = 0; ok && s < sizeof(skips) / sizeof(skips[0]); s++) {
+        int64_t skipped = carquet_column_skip(a, skips[s]);
+        int64_t discarded = 0;
+        while (discarded < skips[s]) {
+            int64_t want = skips[s] - discarded < 64 ? skips[s] - discarded : 64;
+            int64_t n = carquet_column_read_batch(b, vb, want, db, NULL);
+            if (n <= 0) break;
+            discarded += n;
+        }
+        if (skipped != discarded) {
+            ok = 0;
+            break;
+        }
+
+        int64_t na = carquet_column_read_batch(a, va, 64, da, NULL);
+        int64_t nb = carquet_column_read_batch(b, vb, 64, db, NULL);
+        if (na != nb || na < 0) {
+            ok = 0;
+            break;
+        }
+        for (int64_t i = 0; i < na; i++) {
+            if (da[i] != db[i]) {
+                ok = 0;
+            }
+        }
+        if (col == 0) {
+            ok = ok && memcmp(va, vb, (size_t)na * sizeof(int32_t)) == 0;
+        } else if (col == 1) {
+            for (int64_t i = 0; ok && i < na; i++) {
+                ok = va[i].length == vb[i].length &&
+                     memcmp(va[i].data, vb[i].data, (size_t)va[i].length) == 0;
+            }
+        } else if (col == 2) {
+            ok = ok && memcmp(va, vb, (size_t)na) == 0;
+        }
+    }
+
+    /* Skipping past the end stops at the end */
+    if (ok) {
+        int64_t left = 0;
+        while (carquet_column_has_next(b)) {
+            int64_t n = carquet_column_read_batch(b, vb, 64, db, NULL);
+            if (n <= 0) break;
+            left += n;
+        }
+        ok = carquet_column_skip(a, left + 1000) == left && !carquet_column_has_next(a);
+    }
+
+    carquet_column_reader_free(a);
+    carquet_column_reader_free(b);
+    return ok;
+}
+
+static int test_column_skip(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "column_skip");
+    const int32_t num_rows = 12000;
+
+    if (write_skip_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("column_skip", "Failed to write file");
+    }
+
+    int ok = 1;
+    for (int use_mmap = 0; use_mmap < 2 && ok; use_mmap++) {
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.use_mmap = use_mmap != 0;
+        carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+        if (!reader) {
+            ok = 0;
+            break;
+        }
+        for (int32_t col = 0; col < 4 && ok; col++) {
+            ok = check_skip_matches_read(reader, col);
+        }
+
+        /* Skip then read on the sorted column lands on the right value */
+        carquet_column_reader_t* ids = ok ? carquet_reader_get_column(reader, 0, 0, &err) : NULL;
+        if (ids) {
+            int32_t value = -1;
+            ok = carquet_column_skip(ids, 5555) == 5555 &&
+                 carquet_column_read_batch(ids, &value, 1, NULL, NULL) == 1 &&
+                 value == 5555;
+            carquet_column_reader_free(ids);
+        }
+        carquet_reader_close(reader);
+    }
+
+    carquet_test_cleanup(path);
+
+    if (!ok) {
+        TEST_FAIL("column_skip", "Skipped position differs from read position");
+    }
+
+    TEST_PASS("column_skip");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Bloom filters and row group pruning
+ * ============================================================================ */
+
+/* Two row groups over the same key range: multiples of 4 in the first,
+ * 2 mod 4 in the second, so min/max statistics cannot tell them apart */
+#define BLOOM_GROUP_ROWS 5000
+
+static bool bloom_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = (row % BLOOM_GROUP_ROWS) * 4 + (row / BLOOM_GROUP_ROWS) * 2;
+    return true;
+}
+
+static bool bloom_name(int32_t row, int32_t index, void* value) {
+    int32_t id;
+    bloom_id(row, index, &id);
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "key-%d", id);
+    return true;
+}
+
+static int write_bloom_file(const char* path, bool bloom) {
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, bloom_id },
+        { "name", CARQUET_PHYSICAL_BYTE_ARRAY, NULL, CARQUET_REPETITION_REQUIRED, NULL, bloom_name },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.write_bloom_filters = bloom;
+
+    carquet_test_file_t file = { columns, 2, 2 * BLOOM_GROUP_ROWS, 0, 0, BLOOM_GROUP_ROWS, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+static bool bloom_contains_name(carquet_reader_t* reader, int32_t rg, int32_t id) {
+    char name[16];
+    int len = snprintf(name, sizeof(name), "key-%d", id);
+    bool might_contain = true;
+    if (carquet_reader_bloom_filter_check(reader, rg, 1, name, len, &might_contain) != CARQUET_OK) {
+        return true;
+    }
+    return might_contain;
+}
+
+static int test_reader_bloom_filter(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    char plain[512];
+    carquet_test_temp_path(path, sizeof(path), "bloom");
+    carquet_test_temp_path(plain, sizeof(plain), "bloom_plain");
+    const int32_t rows = BLOOM_GROUP_ROWS;
+
+    if (write_bloom_file(path, true) != 0 || write_bloom_file(plain, false) != 0) {
+        carquet_test_cleanup(path);
+        carquet_test_cleanup(plain);
+        TEST_FAIL("reader_bloom_filter", "Failed to write file");
+    }
+
+    int ok = 1;
+    for (int use_mmap = 0; use_mmap < 2 && ok; use_mmap++) {
+        carquet_reader_options_t opts;
+        carquet_reader_options_init(&opts);
+        opts.use_mmap = use_mmap != 0;
+        carquet_reader_t* reader = carquet_reader_open(path, &opts, &err);
+        if (!reader) {
+            ok = 0;
+            break;
+        }
+
+        /* No false negatives; few false positives on the other group's keys */
+        int false_positives = 0;
+        for (int32_t i = 0; i < rows && ok; i++) {
+            int32_t present = i * 4;
+            int32_t absent = i * 4 + 2;
+            bool might_contain = false;
+            if (carquet_reader_bloom_filter_check(reader, 0, 0, &present, sizeof(present),
+                                                  &might_contain) != CARQUET_OK ||
+                !might_contain || !bloom_contains_name(reader, 0, present)) {
+                ok = 0;
+            }
+            if (carquet_reader_bloom_filter_check(reader, 0, 0, &absent, sizeof(absent),
+                                                  &might_contain) != CARQUET_OK) {
+                ok = 0;
+            }
+            false_positives += might_contain;
+            false_positives += bloom_contains_name(reader, 0, absent);
+        }
+        if (false_positives > rows * 2 / 20) {
+            ok = 0;
+        }
+
+        /* Equality pushdown picks the one group holding the key */
+        int32_t matches[4];
+        int32_t key = 1000 * 4 + 2;
+        int32_t n = carquet_reader_filter_row_groups(reader, 0, CARQUET_COMPARE_EQ,
+                                                     &key, sizeof(key), matches, 4);
+        if (n != 1 || matches[0] != 1) {
+            ok = 0;
+        }
+        const char* name = "key-4000";
+        n = carquet_reader_filter_row_groups(reader, 1, CARQUET_COMPARE_EQ,
+                                             name, (int32_t)strlen(name), matches, 4);
+        if (n != 1 || matches[0] != 0) {
+            ok = 0;
+        }
+
+        /* Range predicates are left to the statistics */
+        n = carquet_reader_filter_row_groups(reader, 0, CARQUET_COMPARE_GE,
+                                             &key, sizeof(key), matches, 4);
+        if (n != 2) {
+            ok = 0;
+        }
+
+        bool might_contain;
+        if (carquet_reader_bloom_filter_check(reader, 2, 0, &key, sizeof(key),
+                                              &might_contain) == CARQUET_OK) {
+            ok = 0;
+        }
+        carquet_reader_close(reader);
+    }
+
+    /* Without filters nothing can be ruled out */
+    carquet_reader_t* reader = ok ? carquet_reader_open(plain, NULL, &err) : NULL;
+    if (reader) {
+        int32_t key = 1000 * 4 + 2;
+        bool might_contain = false;
+        int32_t matches[4];
+        if (carquet_reader_bloom_filter_check(reader, 0, 0, &key, sizeof(key),
+                                              &might_contain) != CARQUET_OK || !might_contain ||
+            carquet_reader_filter_row_groups(reader, 0, CARQUET_COMPARE_EQ,
+                                             &key, sizeof(key), matches, 4) != 2) {
+            ok = 0;
+        }
+        carquet_reader_close(reader);
+    } else {
+        ok = 0;
+    }
+
+    carquet_test_cleanup(path);
+    carquet_test_cleanup(plain);
+
+    if (!ok) {
+        TEST_FAIL("reader_bloom_filter", "Bloom filter check or pruning mismatch");
+    }
+
+    TEST_PASS("reader_bloom_filter");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Dictionary-encoded chunks in the batch reader
+ * ============================================================================ */
+
+/* A low-cardinality code and city per row over two row groups of small
+ * uncompressed pages, for rewriting into dictionary-encoded chunks */
+static const char* const dict_cities[5] = { "Lyon", "Oslo", "Porto", "Quebec", "Nagoya" };
+
+static int32_t dict_code_value(int32_t row) {
+    return 100 + (row * 7) % 13;
+}
+
+static bool dict_code(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = dict_code_value(row);
+    return true;
+}
+
+static bool dict_city(int32_t row, int32_t index, void* value) {
+    (void)index;
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "%s", dict_cities[row % 5]);
+    return true;
+}
+
+static int write_dictionary_source_file(const char* path, int32_t rows_per_group) {
+    static const carquet_test_column_t columns[] = {
+        { "code", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, dict_code },
+        { "city", CARQUET_PHYSICAL_BYTE_ARRAY, NULL, CARQUET_REPETITION_REQUIRED, NULL, dict_city },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_UNCOMPRESSED;
+    opts.page_size = 1024;
+
+    carquet_test_file_t file = { columns, 2, 2 * rows_per_group, 250, 0, rows_per_group, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+/* Index of the PLAIN value at *pos in dict (appending it if new) */
+static uint32_t dictionary_index(const uint8_t* data, size_t* pos, bool byte_array,
+                                 const uint8_t** dict, uint32_t* dict_size) {
+    uint32_t length = 4;
+    if (byte_array) {
+        memcpy(&length, data + *pos, 4);
+        *pos += 4;
+    }
+    const uint8_t* value = data + *pos;
+    *pos += length;
+
+    for (uint32_t i = 0; i < *dict_size; i++) {
+        uint32_t dict_length = 4;
+        if (byte_array) {
+            memcpy(&dict_length, dict[i] - 4, 4);
+        }
+        if (dict_length == length && memcmp(dict[i], value, length) == 0) {
+            return i;
+        }
+    }
+    dict[*dict_size] = value;
+    return (*dict_size)++;
+}
+
+/* Rewrite every chunk of an uncompressed file of REQUIRED columns as a
+ * PLAIN dictionary page followed by RLE_DICTIONARY data pages. The last
+ * page of column 0 in the last row group stays PLAIN, as a writer falling
+ * back from a dictionary that grew too large would leave it. */
+static uint8_t* convert_to_dictionary(const uint8_t* file, size_t size,
+                                      const bool* byte_array, size_t* out_size) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    uint32_t footer_len;
+    memcpy(&footer_len, file + size - 8, 4);
+
+    carquet_arena_t arena;
+    parquet_file_metadata_t meta;
+    if (carquet_arena_init(&arena) != CARQUET_OK) return NULL;
+    if (parquet_parse_file_metadata(file + size - 8 - footer_len, footer_len,
+                                    &arena, &meta, &err) != CARQUET_OK) {
+        carquet_arena_destroy(&arena);
+        return NULL;
+    }
+
+    carquet_buffer_t out;
+    carquet_buffer_t body;
+    carquet_buffer_init(&out);
+    carquet_buffer_init(&body);
+    int failed = carquet_buffer_append(&out, "PAR1", 4) != CARQUET_OK;
+
+    for (int32_t rg = 0; rg < meta.num_row_groups && !failed; rg++) {
+        parquet_row_group_t* group = &meta.row_groups[rg];
+        for (int32_t c = 0; c < group->num_columns && !failed; c++) {
+            parquet_column_chunk_t* chunk = &group->columns[c];
+            parquet_column_metadata_t* md = &chunk->metadata;
+            int64_t end = md->data_page_offset + md->total_compressed_size;
+            int64_t start = (int64_t)out.size;
+            const uint8_t* dict[64];
+            uint32_t dict_size = 0;
+
+            /* First pass: collect the dictionary */
+            for (int64_t pos = md->data_page_offset; pos < end && !failed;) {
+                parquet_page_header_t header;
+                size_t header_size;
+                failed = parquet_parse_page_header(file + pos, (size_t)(end - pos),
+                                                   &header, &header_size, &err) != CARQUET_OK ||
+                         header.type != CARQUET_PAGE_DATA;
+                const uint8_t* data = file + pos + (int64_t)header_size;
+                size_t at = 0;
+                for (int32_t i = 0; !failed && i < header.data_page_header.num_values; i++) {
+                    dictionary_index(data, &at, byte_array[c], dict, &dict_size);
+                    failed = dict_size >= 64;
+                }
+                pos += (int64_t)header_size + header.compressed_page_size;
+            }
+
+            carquet_buffer_clear(&body);
+            for (uint32_t i = 0; i < dict_size && !failed; i++) {
+                uint32_t length = 4;
+                if (byte_array[c]) {
+                    memcpy(&length, dict[i] - 4, 4);
+                }
+                failed = carquet_buffer_append(&body, byte_array[c] ? dict[i] - 4 : dict[i],
+                                               byte_array[c] ? length + 4 : length) != CARQUET_OK;
+            }
+            parquet_page_header_t dict_header;
+            memset(&dict_header, 0, sizeof(dict_header));
+            dict_header.type = CARQUET_PAGE_DICTIONARY;
+            dict_header.uncompressed_page_size = (int32_t)body.size;
+            dict_header.compressed_page_size = (int32_t)body.size;
+            dict_header.dictionary_page_header.num_values = (int32_t)dict_size;
+            dict_header.dictionary_page_header.encoding = CARQUET_ENCODING_PLAIN;
+            if (!failed) {
+                failed = parquet_write_page_header(&dict_header, &out, &err) != CARQUET_OK ||
+                         carquet_buffer_append(&out, body.data, body.size) != CARQUET_OK;
+            }
+            int64_t data_start = (int64_t)out.size;
+
+            /* Second pass: re-encode each page as indices */
+            for (int64_t pos = md->data_page_offset; pos < end && !failed;) {
+                parquet_page_header_t header;
+                size_t header_size;
+                failed = parquet_parse_page_header(file + pos, (size_t)(end - pos),
+                                                   &header, &header_size, &err) != CARQUET_OK;
+                const uint8_t* data = file + pos + (int64_t)header_size;
+                int64_t next = pos + (int64_t)header_size + header.compressed_page_size;
+
+                if (!failed && c == 0 && rg == meta.num_row_groups - 1 && next >= end) {
+                    failed = carquet_buffer_append(&out, file + pos,
+                                                   (size_t)(next - pos)) != CARQUET_OK;
+                    break;
+                }
+
+                int32_t num_values = header.data_page_header.num_values;
+                uint32_t* indices = malloc((size_t)num_values * sizeof(uint32_t));
+                size_t at = 0;
+                for (int32_t i = 0; indices && i < num_values; i++) {
+                    indices[i] = dictionary_index(data, &at, byte_array[c], dict, &dict_size);
+                }
+                uint8_t bit_width = 1;
+                while ((1u << bit_width) < dict_size) {
+                    bit_width++;
+                }
+                carquet_buffer_clear(&body);
+                failed = !indices ||
+                         carquet_buffer_append(&body, &bit_width, 1) != CARQUET_OK ||
+                         carquet_rle_encode_all(indices, num_values, bit_width, &body) != CARQUET_OK;
+                free(indices);
+
+                header.data_page_header.encoding = CARQUET_ENCODING_RLE_DICTIONARY;
+                header.uncompressed_page_size = (int32_t)body.size;
+                header.compressed_page_size = (int32_t)body.size;
+                header.has_crc = false;
+                if (!failed) {
+                    failed = parquet_write_page_header(&header, &out, &err) != CARQUET_OK ||
+                             carquet_buffer_append(&out, body.data, body.size) != CARQUET_OK;
+                }
+                pos = next;
+            }
+
+            md->has_dictionary_page_offset = true;
+            md->dictionary_page_offset = start;
+            md->data_page_offset = data_start;
+            md->total_compressed_size = (int64_t)out.size - start;
+            md->total_uncompressed_size = md->total_compressed_size;
+            chunk->file_offset = start;
+            chunk->has_offset_index_offset = false;
+            chunk->has_offset_index_length = false;
+            chunk->has_column_index_offset = false;
+            chunk->has_column_index_length = false;
+            if (c == 0) {
+                group->file_offset = start;
+            }
+        }
+    }
+
+    carquet_buffer_t footer;
+    carquet_buffer_init(&footer);
+    if (!failed) {
+        failed = parquet_write_file_metadata(&meta, &footer, &err) != CARQUET_OK;
+    }
+    if (!failed) {
+        uint32_t len = (uint32_t)footer.size;
+        failed = carquet_buffer_append(&out, footer.data, footer.size) != CARQUET_OK ||
+                 carquet_buffer_append(&out, &len, 4) != CARQUET_OK ||
+                 carquet_buffer_append(&out, "PAR1", 4) != CARQUET_OK;
+    }
+    carquet_buffer_destroy(&footer);
+    carquet_buffer_destroy(&body);
+    parquet_file_metadata_free(&meta);
+    carquet_arena_destroy(&arena);
+
+    if (failed) {
+        carquet_buffer_destroy(&out);
+        return NULL;
+    }
+    *out_size = out.size;
+    return out.data;  /* Owned by the caller */
+}
+
+static int test_batch_reader_dictionary(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "batch_dictionary");
+    const int32_t rows_per_group = 2000;
+    const bool byte_array[2] = { false, true };
+
+    if (write_dictionary_source_file(path, rows_per_group) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("batch_reader_dictionary", "Failed to write file");
+    }
+
+    uint8_t* plain = NULL;
+    uint8_t* file = NULL;
+    size_t plain_size = 0;
+    size_t file_size = 0;
+    FILE* f = fopen(path, "rb");
+    if (f && fseek(f, 0, SEEK_END) == 0) {
+        plain_size = (size_t)ftell(f);
+        plain = malloc(plain_size);
+        rewind(f);
+        if (plain && fread(plain, 1, plain_size, f) == plain_size) {
+            file = convert_to_dictionary(plain, plain_size, byte_array, &file_size);
+        }
+    }
+    if (f) fclose(f);
+    free(plain);
+    carquet_test_cleanup(path);
+
+    carquet_reader_t* reader = file
+        ? carquet_reader_open_buffer(file, file_size, NULL, &err) : NULL;
+    carquet_batch_reader_config_t config;
+    carquet_batch_reader_config_init(&config);
+    config.batch_size = 700;
+    carquet_batch_reader_t* values_br = reader
+        ? carquet_batch_reader_create(reader, &config, &err) : NULL;
+    config.read_dictionary = true;
+    carquet_batch_reader_t* dict_br = reader
+        ? carquet_batch_reader_create(reader, &config, &err) : NULL;
+
+    /* Indices must resolve to the values the default mode materializes;
+     * column 0 falls back to values for the batch that reaches its PLAIN
+     * page, and each row group hands out a new dictionary */
+    int ok = values_br && dict_br;
+    int64_t row = 0;
+    int32_t index_batches[2] = { 0, 0 };
+    int32_t changes[2] = { 0, 0 };
+    int32_t materialized = 0;
+    carquet_row_batch_t* a = NULL;
+    carquet_row_batch_t* b = NULL;
+    while (ok && carquet_batch_reader_next(values_br, &a) == CARQUET_OK && a) {
+        ok = carquet_batch_reader_next(dict_br, &b) == CARQUET_OK && b &&
+             carquet_row_batch_num_rows(a) == carquet_row_batch_num_rows(b);
+        for (int32_t k = 0; k < 2 && ok; k++) {
+            const void* va;
+            const void* vb;
+            const uint8_t* nulls;
+            const void* dict;
+            int32_t dict_size;
+            bool changed;
+            int64_t na, nb;
+            ok = carquet_row_batch_column(a, k, &va, &nulls, &na) == CARQUET_OK &&
+                 carquet_row_batch_column(b, k, &vb, &nulls, &nb) == CARQUET_OK &&
+                 carquet_row_batch_column_dictionary(b, k, &dict, &dict_size, &changed) == CARQUET_OK &&
+                 na == nb;
+            if (dict) {
+                index_batches[k]++;
+                changes[k] += changed;
+            } else {
+                materialized++;
+            }
+            for (int64_t i = 0; ok && i < na; i++) {
+                int32_t index = ((const int32_t*)vb)[i];
+                if (dict && (index < 0 || index >= dict_size)) {
+                    ok = 0;
+                } else if (byte_array[k]) {
+                    const carquet_byte_array_t* x = (const carquet_byte_array_t*)va + i;
+                    const carquet_byte_array_t* y = dict
+                        ? (const carquet_byte_array_t*)dict + index
+                        : (const carquet_byte_array_t*)vb + i;
+                    ok = x->length == y->length &&
+                         memcmp(x->data, y->data, (size_t)x->length) == 0 &&
+                         x->length == (int32_t)strlen(dict_cities[(row + i) % 5]);
+                } else {
+                    int32_t y = dict ? ((const int32_t*)dict)[index] : ((const int32_t*)vb)[i];
+                    ok = ((const int32_t*)va)[i] == y && y == dict_code_value((int32_t)(row + i));
+                }
+            }
+        }
+        row += carquet_row_batch_num_rows(a);
+        carquet_row_batch_free(a);
+        carquet_row_batch_free(b);
+        a = NULL;
+        b = NULL;
+    }
+
+    carquet_batch_reader_free(values_br);
+    carquet_batch_reader_free(dict_br);
+    carquet_reader_close(reader);
+    free(file);
+
+    if (!ok || row != 2 * rows_per_group) {
+        TEST_FAIL("batch_reader_dictionary", "Indices do not resolve to the column values");
+    }
+    if (materialized != 1 || index_batches[1] == 0 || changes[0] != 2 || changes[1] != 2) {
+        TEST_FAIL("batch_reader_dictionary", "Unexpected dictionary output per batch");
+    }
+
+    TEST_PASS("batch_reader_dictionary");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Decoding whole pages in place
+ * ============================================================================ */
+
+static bool in_place_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static int32_t in_place_tag_count(int32_t row) {
+    return row % 3 + 1;
+}
+
+static bool in_place_tag(int32_t row, int32_t index, void* value) {
+    *(int32_t*)value = row * 10 + index;
+    return true;
+}
+
+static bool in_place_name(int32_t row, int32_t index, void* value) {
+    (void)index;
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "name-%d", row);
+    return true;
+}
+
+/* An id, a list of tags (1-3 per row) and a name per row; pages are cut at
+ * batch boundaries, so every page starts on a row */
+static int write_in_place_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, in_place_id },
+        { "tags", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REPEATED, in_place_tag_count, in_place_tag },
+        { "name", CARQUET_PHYSICAL_BYTE_ARRAY, NULL, CARQUET_REPETITION_REQUIRED, NULL, in_place_name },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.page_size = 1024;
+    opts.compression = CARQUET_COMPRESSION_SNAPPY;
+
+    carquet_test_file_t file = { columns, 3, num_rows, 100, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+/* Whole pages decode straight into the caller's arrays and must read the
+ * same as pages staged in decoded_values for partial reads */
+static int test_reader_decode_in_place(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "decode_in_place");
+    const int64_t capacity = 16384;
+
+    if (write_in_place_file(path, 3000) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("reader_decode_in_place", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    uint8_t* whole = malloc((size_t)capacity * sizeof(carquet_byte_array_t));
+    uint8_t* parts = malloc((size_t)capacity * sizeof(carquet_byte_array_t));
+    int16_t* levels = malloc((size_t)capacity * 4 * sizeof(int16_t));
+    int ok = reader && whole && parts && levels;
+
+    for (int32_t c = 0; c < 3 && ok; c++) {
+        size_t value_size = c == 2 ? sizeof(carquet_byte_array_t) : sizeof(int32_t);
+        int16_t* def_a = levels;
+        int16_t* rep_a = levels + capacity;
+        int16_t* def_b = levels + 2 * capacity;
+        int16_t* rep_b = levels + 3 * capacity;
+        carquet_column_reader_t* a = carquet_reader_get_column(reader, 0, c, &err);
+        carquet_column_reader_t* b = carquet_reader_get_column(reader, 0, c, &err);
+        ok = a && b;
+
+        /* The peek stages the first page; once it is passed, poison
+         * staging so that any later page decoded through it shows */
+        int64_t first = 0;
+        int64_t total = 0;
+        if (ok) {
+            ok = carquet_column_read_batch(a, whole, 0, NULL, NULL) == 0 && a->page_loaded;
+        }
+        if (ok) {
+            first = a->page_num_values;
+            ok = carquet_column_skip(a, first) == first &&
+                 carquet_column_skip(b, first) == first;
+        }
+        if (ok) {
+            memset(a->decoded_values, 0xEE, a->decoded_capacity * value_size);
+            total = carquet_column_read_batch(a, whole, capacity, def_a, rep_a);
+            ok = total > 0 && (first + total > 3000 || (c != 1 && first + total == 3000));
+        }
+        for (size_t i = 0; ok && i < a->decoded_capacity * value_size; i++) {
+            ok = a->decoded_values[i] == 0xEE;
+        }
+
+        /* Byte array views of b last until its next read, so each chunk
+         * is checked as it comes */
+        int64_t read = 0;
+        while (ok && read < total) {
+            int64_t n = carquet_column_read_batch(
+                b, parts + (size_t)read * value_size, 37, def_b + read, rep_b + read);
+            ok = n > 0;
+            for (int64_t i = read; ok && i < read + n; i++) {
+                if (c == 2) {
+                    const carquet_byte_array_t* x = (const carquet_byte_array_t*)whole + i;
+                    const carquet_byte_array_t* y = (const carquet_byte_array_t*)parts + i;
+                    char expected[16];
+                    snprintf(expected, sizeof(expected), "name-%d", (int)(first + i));
+                    ok = x->length == y->length && x->length == (int32_t)strlen(expected) &&
+                         memcmp(x->data, expected, (size_t)x->length) == 0 &&
+                         memcmp(y->data, expected, (size_t)y->length) == 0;
+                } else {
+                    ok = ((const int32_t*)whole)[i] == ((const int32_t*)parts)[i];
+                }
+            }
+            read += n;
+        }
+        ok = ok && read == total &&
+             memcmp(def_a, def_b, (size_t)total * sizeof(int16_t)) == 0 &&
+             memcmp(rep_a, rep_b, (size_t)total * sizeof(int16_t)) == 0;
+        carquet_column_reader_free(a);
+        carquet_column_reader_free(b);
+    }
+
+    free(whole);
+    free(parts);
+    free(levels);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("reader_decode_in_place", "Whole-page reads differ from staged reads");
+    }
+
+    TEST_PASS("reader_decode_in_place");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Arrow export
+ * ============================================================================ */
+
+static bool arrow_score_null(int32_t row) { return row % 4 == 0; }
+static bool arrow_label_null(int32_t row) { return row % 3 == 1; }
+
+static bool arrow_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static bool arrow_score(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(double*)value = row * 0.5;
+    return !arrow_score_null(row);
+}
+
+static bool arrow_label(int32_t row, int32_t index, void* value) {
+    (void)index;
+    snprintf(value, CARQUET_TEST_TEXT_SIZE, "L%d", row);
+    return !arrow_label_null(row);
+}
+
+static bool arrow_flag(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(uint8_t*)value = (uint8_t)(row % 3 == 0);
+    return true;
+}
+
+static int write_arrow_source_file(const char* path, int32_t num_rows) {
+    static const carquet_logical_type_t string_type = { .id = CARQUET_LOGICAL_STRING };
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, arrow_id },
+        { "score", CARQUET_PHYSICAL_DOUBLE, NULL, CARQUET_REPETITION_OPTIONAL, NULL, arrow_score },
+        { "label", CARQUET_PHYSICAL_BYTE_ARRAY, &string_type, CARQUET_REPETITION_OPTIONAL, NULL, arrow_label },
+        { "flag", CARQUET_PHYSICAL_BOOLEAN, NULL, CARQUET_REPETITION_REQUIRED, NULL, arrow_flag },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.compression = CARQUET_COMPRESSION_ZSTD;
+    opts.page_size = 1024;
+
+    /* Whole bytes of booleans per write: the writer pads each call's bits */
+    carquet_test_file_t file = { columns, 4, num_rows, 200, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+static bool arrow_bit(const void* buffer, int64_t i) {
+    return (((const uint8_t*)buffer)[i / 8] >> (i % 8)) & 1;
+}
+
+/* The exported label column must hold the strings of rows first.. */
+static int check_arrow_labels(const struct ArrowArray* labels, int64_t first) {
+    const int32_t* offsets = labels->buffers[1];
+    const char* chars = labels->buffers[2];
+    char expected[16];
+    if (labels->n_buffers != 3 || labels->null_count == 0 || !labels->buffers[0]) {
+        return 0;
+    }
+    for (int64_t i = 0; i < labels->length; i++) {
+        int32_t row = (int32_t)(first + i);
+        if (arrow_bit(labels->buffers[0], i) == arrow_label_null(row)) {
+            return 0;
+        }
+        if (arrow_label_null(row)) {
+            expected[0] = '\0';
+        } else {
+            snprintf(expected, sizeof(expected), "L%d", row);
+        }
+        if (offsets[i + 1] - offsets[i] != (int32_t)strlen(expected) ||
+            memcmp(chars + offsets[i], expected, strlen(expected)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_arrow_batch(struct ArrowArray* array, struct ArrowSchema* schema,
+                             int64_t first) {
+    static const char* const formats[4] = { "i", "g", "u", "b" };
+    int ok = strcmp(schema->format, "+s") == 0 && schema->n_children == 4 &&
+             array->n_children == 4 && array->null_count == 0;
+    for (int32_t k = 0; ok && k < 4; k++) {
+        const struct ArrowSchema* field = schema->children[k];
+        ok = strcmp(field->format, formats[k]) == 0 &&
+             ((field->flags & ARROW_FLAG_NULLABLE) != 0) == (k == 1 || k == 2) &&
+             array->children[k]->length == array->length;
+    }
+    if (!ok) {
+        return 0;
+    }
+
+    const struct ArrowArray* ids = array->children[0];
+    const struct ArrowArray* scores = array->children[1];
+    const struct ArrowArray* flags = array->children[3];
+    int64_t score_nulls = 0;
+    for (int64_t i = 0; ok && i < array->length; i++) {
+        int32_t row = (int32_t)(first + i);
+        bool present = !arrow_score_null(row);
+        score_nulls += !present;
+        ok = ((const int32_t*)ids->buffers[1])[i] == row &&
+             arrow_bit(scores->buffers[0], i) == present &&
+             (!present || ((const double*)scores->buffers[1])[i] == row * 0.5) &&
+             arrow_bit(flags->buffers[1], i) == (row % 3 == 0);
+    }
+    return ok && ids->null_count == 0 && ids->buffers[0] == NULL &&
+           scores->null_count == score_nulls &&
+           check_arrow_labels(array->children[2], first);
+}
+
+static int test_batch_reader_arrow_export(void) {
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "arrow_export");
+    const int32_t num_rows = 3000;
+
+    if (write_arrow_source_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("batch_reader_arrow_export", "Failed to write file");
+    }
+
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    int ok = reader != NULL;
+    int exported = 0;
+    for (int mode = 0; ok && mode < 2; mode++) {
+        carquet_batch_reader_config_t config;
+        carquet_batch_reader_config_init(&config);
+        config.batch_size = 700;
+        config.arrow_layout = mode == 1;
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+        ok = br != NULL;
+
+        /* Values sit at their row's slot; the bitmap's polarity follows
+         * the layout */
+        int64_t first = 0;
+        carquet_row_batch_t* batch = NULL;
+        while (ok && carquet_batch_reader_next(br, &batch) == CARQUET_OK && batch) {
+            const void* data;
+            const uint8_t* bitmap;
+            int64_t count;
+            ok = carquet_row_batch_column(batch, 1, &data, &bitmap, &count) == CARQUET_OK &&
+                 bitmap != NULL;
+            for (int64_t i = 0; ok && i < count; i++) {
+                int32_t row = (int32_t)(first + i);
+                bool set = arrow_bit(bitmap, i);
+                double value = ((const double*)data)[i];
+                ok = set == (config.arrow_layout ? !arrow_score_null(row) : arrow_score_null(row)) &&
+                     value == (arrow_score_null(row) ? 0.0 : row * 0.5);
+            }
+
+            struct ArrowArray array;
+            struct ArrowSchema schema;
+            if (!ok || carquet_row_batch_export_arrow(batch, &array, &schema) != CARQUET_OK) {
+                carquet_row_batch_free(batch);
+                ok = 0;
+                break;
+            }
+            ok = check_arrow_batch(&array, &schema, first);
+
+            /* A child moved out keeps its buffers after the parent goes */
+            struct ArrowArray labels = *array.children[2];
+            array.children[2]->release = NULL;
+            array.release(&array);
+            ok = ok && array.release == NULL && check_arrow_labels(&labels, first);
+            labels.release(&labels);
+            schema.release(&schema);
+
+            first += count;
+            exported++;
+            batch = NULL;
+        }
+        ok = ok && first == num_rows;
+        carquet_batch_reader_free(br);
+    }
+
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+
+    if (!ok || exported != 2 * ((num_rows + 699) / 700)) {
+        TEST_FAIL("batch_reader_arrow_export", "Exported batches do not match the file");
+    }
+
+    TEST_PASS("batch_reader_arrow_export");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Validity bits from definition levels
+ * ============================================================================ */
+
+/* Def levels of max 1 read as validity bits, staged in chunks and decoded
+ * in place, at a bit offset that is not byte aligned */
+static int test_reader_validity_levels(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "validity_levels");
+    const int32_t num_rows = 3000;
+    const int64_t shift = 5;
+
+    if (write_arrow_source_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("reader_validity_levels", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    uint8_t* validity = malloc(((size_t)num_rows + (size_t)shift + 7) / 8);
+    carquet_byte_array_t* values = malloc((size_t)num_rows * sizeof(carquet_byte_array_t));
+    int ok = reader && validity && values;
+
+    for (int32_t pass = 0; pass < 4 && ok; pass++) {
+        int32_t col = pass < 2 ? 1 : 2;
+        int64_t chunk = pass % 2 == 0 ? 37 : num_rows;
+        carquet_column_reader_t* r = carquet_reader_get_column(reader, 0, col, &err);
+        ok = r != NULL;
+        if (!ok) break;
+        r->spaced_values = true;
+        r->validity_levels = true;
+        memset(validity, 0xA5, ((size_t)num_rows + (size_t)shift + 7) / 8);
+
+        int64_t total = 0;
+        while (ok && total < num_rows) {
+            void* out = col == 1 ? (void*)((double*)values + total)
+                                 : (void*)(values + total);
+            int64_t n = carquet_column_read_validity(r, out, chunk, validity,
+                                                     shift + total, false);
+            ok = n > 0;
+            for (int64_t i = total; ok && col == 2 && i < total + n; i++) {
+                char expected[16];
+                snprintf(expected, sizeof(expected), "L%d", (int)i);
+                ok = arrow_label_null((int32_t)i)
+                    ? values[i].length == 0
+                    : values[i].length == (int32_t)strlen(expected) &&
+                      memcmp(values[i].data, expected, strlen(expected)) == 0;
+            }
+            total += n;
+        }
+
+        ok = ok && total == num_rows && r->decoded_def_levels == NULL &&
+             (validity[0] & 0x1F) == (0xA5 & 0x1F);
+        for (int32_t i = 0; ok && i < num_rows; i++) {
+            bool null = col == 1 ? arrow_score_null(i) : arrow_label_null(i);
+            ok = arrow_bit(validity, shift + i) == !null &&
+                 (col == 2 || ((const double*)values)[i] == (null ? 0.0 : i * 0.5));
+        }
+        carquet_column_reader_free(r);
+    }
+
+    free(validity);
+    free(values);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("reader_validity_levels", "Validity bits do not match the def levels");
+    }
+
+    TEST_PASS("reader_validity_levels");
+    return 0;
+}
+
+static bool partial_group_value(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int64_t*)value = (int64_t)row * 3;
+    return row % 3 != 1;
+}
+
+/* An optional INT64 column in pages of 11 entries, so every page ends
+ * part-way through a bit-packed group of def levels */
+static int write_partial_group_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "value", CARQUET_PHYSICAL_INT64, NULL, CARQUET_REPETITION_OPTIONAL, NULL, partial_group_value },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.page_size = 64;
+
+    carquet_test_file_t file = { columns, 1, num_rows, 11, 0, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+static int test_reader_validity_partial_group(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "validity_partial_group");
+    enum { num_rows = 121 };
+
+    if (write_partial_group_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("reader_validity_partial_group", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    uint8_t validity[(num_rows + 7) / 8];
+    int64_t values[num_rows];
+    int ok = reader != NULL;
+
+    /* Chunks ending inside and across the last group of each page */
+    const int64_t chunks[] = { 5, 11, num_rows };
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]) && ok; c++) {
+        carquet_column_reader_t* r = carquet_reader_get_column(reader, 0, 0, &err);
+        ok = r != NULL;
+        if (!ok) break;
+        r->spaced_values = true;
+        r->validity_levels = true;
+        memset(validity, 0, sizeof(validity));
+
+        int64_t total = 0;
+        while (ok && total < num_rows) {
+            int64_t n = carquet_column_read_validity(r, values + total, chunks[c], validity,
+                                                     total, false);
+            ok = n > 0 && r->page_num_values == 11;
+            total += n;
+        }
+
+        ok = ok && total == num_rows;
+        for (int32_t i = 0; ok && i < num_rows; i++) {
+            bool null = i % 3 == 1;
+            ok = arrow_bit(validity, i) == !null && (null || values[i] == (int64_t)i * 3);
+        }
+        carquet_column_reader_free(r);
+    }
+
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("reader_validity_partial_group", "Validity bits do not match the def levels");
+    }
+
+    TEST_PASS("reader_validity_partial_group");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Spaced column reads
+ * ============================================================================ */
+
+static int test_column_read_spaced(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "read_spaced");
+    const int32_t num_rows = 3000;
+    const int32_t packed_rows = 10;
+
+    if (write_arrow_source_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("column_read_spaced", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    uint8_t* validity = malloc(((size_t)num_rows + 7) / 8);
+    double* values = malloc((size_t)num_rows * sizeof(double));
+    int16_t def_levels[16];
+    int ok = reader && validity && values;
+
+    /* Required id and optional score, in chunks of 37 after a few rows read
+     * packed (the page is decoded again spaced) and all at once */
+    for (int32_t pass = 0; pass < 4 && ok; pass++) {
+        int32_t col = pass < 2 ? 0 : 1;
+        bool chunked = pass % 2 == 0;
+        carquet_column_reader_t* r = carquet_reader_get_column(reader, 0, col, &err);
+        ok = r != NULL;
+        if (!ok) break;
+
+        int32_t first = 0;
+        if (chunked) {
+            first = (int32_t)carquet_column_read_batch(r, values, packed_rows, def_levels, NULL);
+            ok = first == packed_rows;
+        }
+
+        int32_t row = first;
+        while (ok && row < num_rows) {
+            int64_t want = chunked ? 37 : num_rows;
+            int64_t null_count = -1;
+            memset(values, 0xA5, (size_t)want * sizeof(double));
+            int64_t n = carquet_column_read_spaced(r, values, want, validity, &null_count);
+            ok = n > 0;
+            int64_t nulls = 0;
+            for (int64_t i = 0; ok && i < n; i++, row++) {
+                bool null = col == 1 && arrow_score_null(row);
+                nulls += null;
+                ok = arrow_bit(validity, i) == !null &&
+                     (col == 0 ? ((const int32_t*)values)[i] == row
+                               : values[i] == (null ? 0.0 : row * 0.5));
+            }
+            ok = ok && null_count == nulls;
+        }
+
+        int64_t ignored = 0;
+        ok = ok && row == num_rows &&
+             carquet_column_read_spaced(r, values, 16, validity, &ignored) == 0;
+        carquet_column_reader_free(r);
+    }
+
+    free(validity);
+    free(values);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("column_read_spaced", "Spaced values or validity do not match");
+    }
+
+    TEST_PASS("column_read_spaced");
+    return 0;
+}
+
+/* Pages of 11 entries: each ends part-way through a group of validity bits
+ * that the value expand is driven by */
+static int test_column_read_spaced_partial_group(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "read_spaced_partial_group");
+    enum { num_rows = 121 };
+
+    if (write_partial_group_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("column_read_spaced_partial_group", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    uint8_t validity[(num_rows + 7) / 8];
+    int64_t values[num_rows];
+    int ok = reader != NULL;
+
+    const int64_t chunks[] = { 3, 37, num_rows };
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]) && ok; c++) {
+        carquet_column_reader_t* r = carquet_reader_get_column(reader, 0, 0, &err);
+        ok = r != NULL;
+
+        int32_t row = 0;
+        while (ok && row < num_rows) {
+            int64_t null_count = -1;
+            int64_t n = carquet_column_read_spaced(r, values, chunks[c], validity, &null_count);
+            ok = n > 0;
+            int64_t nulls = 0;
+            for (int64_t i = 0; ok && i < n; i++, row++) {
+                bool null = row % 3 == 1;
+                nulls += null;
+                ok = arrow_bit(validity, i) == !null &&
+                     values[i] == (null ? 0 : (int64_t)row * 3);
+            }
+            ok = ok && null_count == nulls;
+        }
+        ok = ok && row == num_rows;
+        carquet_column_reader_free(r);
+    }
+
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("column_read_spaced_partial_group", "Spaced values or validity do not match");
+    }
+
+    TEST_PASS("column_read_spaced_partial_group");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Nested list columns
+ * ============================================================================ */
+
+/* optional group a (LIST) {
+ *   repeated group list {
+ *     optional group element (LIST) {
+ *       repeated group list { optional int32 element } } } }
+ * Records: null, [], [null], [[], [1, null], null], [[2]] */
+static int test_list_assembler_levels(void) {
+    static const int16_t def[] = {0, 1, 2, 3, 5, 4, 2, 5};
+    static const int16_t rep[] = {0, 0, 0, 0, 1, 2, 1, 0};
+    static const int16_t rep_def[] = {2, 4};
+    static const int32_t outer_offsets[] = {0, 0, 0, 1, 4, 5};
+    static const int32_t inner_offsets[] = {0, 0, 0, 2, 2, 3};
+    static const bool outer_valid[] = {false, true, true, true, true};
+    static const bool inner_valid[] = {false, true, true, false, true};
+    static const bool value_valid[] = {true, false, true};
+
+    carquet_list_assembler_t assembler;
+    if (carquet_list_assembler_init(&assembler, rep_def, 2, 5) != CARQUET_OK) {
+        TEST_FAIL("list_assembler_levels", "Failed to set up assembler");
+    }
+
+    /* A second run replaces the first */
+    int ok = carquet_list_assembler_run(&assembler, def, rep, 3) == CARQUET_OK &&
+             carquet_list_assembler_run(&assembler, def, rep, 8) == CARQUET_OK;
+    const carquet_list_level_t* outer = &assembler.levels[0];
+    const carquet_list_level_t* inner = &assembler.levels[1];
+    ok = ok && outer->length == 5 && outer->null_count == 1 &&
+         inner->length == 5 && inner->null_count == 2 &&
+         assembler.num_values == 3 && assembler.null_count == 1;
+    for (int i = 0; ok && i <= 5; i++) {
+        ok = outer->offsets[i] == outer_offsets[i] && inner->offsets[i] == inner_offsets[i];
+    }
+    for (int i = 0; ok && i < 5; i++) {
+        ok = arrow_bit(outer->validity, i) == outer_valid[i] &&
+             arrow_bit(inner->validity, i) == inner_valid[i];
+    }
+    for (int i = 0; ok && i < 3; i++) {
+        ok = arrow_bit(assembler.value_validity, i) == value_valid[i];
+    }
+
+    carquet_list_assembler_destroy(&assembler);
+    if (!ok) {
+        TEST_FAIL("list_assembler_levels", "Offsets or validity do not match");
+    }
+
+    TEST_PASS("list_assembler_levels");
+    return 0;
+}
+
+/* Row r has r % 4 tags, r * 10 + t; entries are written 5 at a time into
+ * small pages, so records run across page boundaries */
+static bool tags_id(int32_t row, int32_t index, void* value) {
+    (void)index;
+    *(int32_t*)value = row;
+    return true;
+}
+
+static int32_t tags_count(int32_t row) {
+    return row % 4;
+}
+
+static bool tags_value(int32_t row, int32_t index, void* value) {
+    *(int32_t*)value = row * 10 + index;
+    return true;
+}
+
+static int write_tags_file(const char* path, int32_t num_rows) {
+    static const carquet_test_column_t columns[] = {
+        { "id", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REQUIRED, NULL, tags_id },
+        { "tags", CARQUET_PHYSICAL_INT32, NULL, CARQUET_REPETITION_REPEATED, tags_count, tags_value },
+    };
+
+    carquet_writer_options_t opts;
+    carquet_writer_options_init(&opts);
+    opts.page_size = 64;
+
+    carquet_test_file_t file = { columns, 2, num_rows, 0, 5, 0, &opts, NULL };
+    return carquet_test_write_file(path, &file);
+}
+
+static int test_nested_reader_lists(void) {
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "nested_lists");
+    const int32_t num_rows = 500;
+
+    if (write_tags_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("nested_reader_lists", "Failed to write file");
+    }
+
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    int ok = reader != NULL;
+
+    /* Some page must start inside a record for the test to mean anything */
+    bool split = false;
+    carquet_column_reader_t* col = ok ? carquet_reader_get_column(reader, 0, 1, &err) : NULL;
+    int32_t first_value;
+    int16_t first_def, first_rep;
+    while (col && carquet_column_read_batch(col, &first_value, 1, &first_def, &first_rep) == 1) {
+        split = split || (col->page_values_read == 1 && first_rep != 0);
+        int64_t rest = col->page_num_values - col->page_values_read;
+        if (rest > 0 && carquet_column_skip(col, rest) != rest) break;
+    }
+    carquet_column_reader_free(col);
+    ok = ok && split;
+
+    for (int32_t pass = 0; pass < 2 && ok; pass++) {
+        int64_t max_rows = pass == 0 ? 9 : num_rows;
+        carquet_nested_reader_t* nested = carquet_nested_reader_create(reader, 0, 1, &err);
+        ok = nested != NULL;
+        int32_t row = 0;
+        carquet_nested_batch_t batch;
+        while (ok && carquet_nested_reader_next(nested, max_rows, &batch, &err) == CARQUET_OK &&
+               batch.num_rows > 0) {
+            const carquet_list_level_t* tags = &batch.levels[0];
+            const int32_t* values = batch.values;
+            ok = batch.num_levels == 1 && tags->schema_element == 2 &&
+                 tags->length == batch.num_rows && tags->null_count == 0 &&
+                 batch.null_count == 0 && tags->offsets[0] == 0 &&
+                 tags->offsets[tags->length] == batch.num_values &&
+                 (batch.num_rows == max_rows || row + batch.num_rows == num_rows);
+            for (int64_t r = 0; ok && r < batch.num_rows; r++, row++) {
+                ok = arrow_bit(tags->validity, r) &&
+                     tags->offsets[r + 1] - tags->offsets[r] == row % 4;
+                for (int32_t i = tags->offsets[r]; ok && i < tags->offsets[r + 1]; i++) {
+                    ok = values[i] == row * 10 + (i - tags->offsets[r]) &&
+                         arrow_bit(batch.validity, i);
+                }
+            }
+        }
+        ok = ok && row == num_rows;
+        carquet_nested_reader_free(nested);
+    }
+
+    /* A flat column reads as zero levels, one value per record */
+    carquet_nested_reader_t* ids = ok ? carquet_nested_reader_create(reader, 0, 0, &err) : NULL;
+    carquet_nested_batch_t batch;
+    ok = ok && ids && carquet_nested_reader_next(ids, 1000, &batch, &err) == CARQUET_OK &&
+         batch.num_levels == 0 && batch.num_rows == num_rows && batch.num_values == num_rows;
+    for (int32_t i = 0; ok && i < num_rows; i++) {
+        ok = ((const int32_t*)batch.values)[i] == i && arrow_bit(batch.validity, i);
+    }
+    carquet_nested_reader_free(ids);
+
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+    if (!ok) {
+        TEST_FAIL("nested_reader_lists", "Lists do not match the written records");
+    }
+
+    TEST_PASS("nested_reader_lists");
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Reusing row batches
+ * ============================================================================ */
+
+static bool batch_columns_equal(const carquet_row_batch_t* a, const carquet_row_batch_t* b) {
+    static const size_t value_sizes[] = { sizeof(int32_t), sizeof(double),
+                                          sizeof(carquet_byte_array_t), 1 };
+    bool ok = carquet_row_batch_num_rows(a) == carquet_row_batch_num_rows(b) &&
+              carquet_row_batch_num_columns(a) == 4 && carquet_row_batch_num_columns(b) == 4;
+    for (int32_t k = 0; ok && k < 4; k++) {
+        const void* va;
+        const void* vb;
+        const uint8_t* na;
+        const uint8_t* nb;
+        int64_t ca, cb;
+        ok = carquet_row_batch_column(a, k, &va, &na, &ca) == CARQUET_OK &&
+             carquet_row_batch_column(b, k, &vb, &nb, &cb) == CARQUET_OK &&
+             ca == cb && (na == NULL) == (nb == NULL) &&
+             (!na || memcmp(na, nb, (size_t)(ca + 7) / 8) == 0);
+        if (ok && k == 2) {
+            for (int64_t i = 0; ok && i < ca; i++) {
+                const carquet_byte_array_t* x = (const carquet_byte_array_t*)va + i;
+                const carquet_byte_array_t* y = (const carquet_byte_array_t*)vb + i;
+                ok = x->length == y->length &&
+                     (x->length == 0 || memcmp(x->data, y->data, (size_t)x->length) == 0);
+            }
+        } else if (ok) {
+            ok = memcmp(va, vb, (size_t)ca * value_sizes[k]) == 0;
+        }
+    }
+    return ok;
+}
+
+/* A reused batch must match fresh ones, and once batches have the same
+ * size their buffers must come back from the pool */
+static int test_batch_reader_next_into(void) {
+    char path[512];
+    carquet_test_temp_path(path, sizeof(path), "next_into");
+    const int32_t num_rows = 3000;
+
+    if (write_arrow_source_file(path, num_rows) != 0) {
+        carquet_test_cleanup(path);
+        TEST_FAIL("batch_reader_next_into", "Failed to write file");
+    }
+
+    carquet_error_t err = CARQUET_ERROR_INIT;
+    carquet_reader_t* reader = carquet_reader_open(path, NULL, &err);
+    carquet_row_batch_t* batch = carquet_row_batch_create(&err);
+    int ok = reader && batch;
+    int32_t recycled = 0;
+    for (int mode = 0; ok && mode < 2; mode++) {
+        carquet_batch_reader_config_t config;
+        carquet_batch_reader_config_init(&config);
+        config.batch_size = 700;
+        config.arrow_layout = mode == 1;
+        carquet_batch_reader_t* fresh_br = carquet_batch_reader_create(reader, &config, &err);
+        carquet_batch_reader_t* br = carquet_batch_reader_create(reader, &config, &err);
+        ok = fresh_br && br;
+
+        const void* previous[16] = { NULL };
+        int64_t rows = 0;
+        carquet_row_batch_t* fresh = NULL;
+        while (ok && carquet_batch_reader_next(fresh_br, &fresh) == CARQUET_OK && fresh) {
+            ok = carquet_batch_reader_next_into(br, batch) == CARQUET_OK &&
+                 batch_columns_equal(fresh, batch);
+
+            /* Arrow strings also hold offsets and characters; the size of
+             * the characters varies, so they may need a larger block */
+            const void* buffers[16];
+            bool reused = true;
+            for (int32_t k = 0; ok && k < 4; k++) {
+                int64_t count;
+                ok = carquet_row_batch_column(batch, k, &buffers[4 * k],
+                                              (const uint8_t**)&buffers[4 * k + 1],
+                                              &count) == CARQUET_OK;
+                buffers[4 * k + 2] = batch->columns[k].offsets;
+                buffers[4 * k + 3] = batch->columns[k].chars;
+            }
+            for (int32_t i = 0; ok && i < 16; i++) {
+                bool found = buffers[i] == NULL || i % 4 == 3;
+                for (int32_t j = 0; j < 16 && !found; j++) {
+                    found = buffers[i] == previous[j];
+                }
+                reused = reused && found;
+            }
+            if (rows > 0 && carquet_row_batch_num_rows(batch) == config.batch_size) {
+                ok = ok && reused;
+                recycled++;
+            }
+            memcpy(previous, buffers, sizeof(previous));
+
+            rows += carquet_row_batch_num_rows(fresh);
+            carquet_row_batch_free(fresh);
+            fresh = NULL;
+        }
+        ok = ok && rows == num_rows &&
+             carquet_batch_reader_next_into(br, batch) == CARQUET_ERROR_END_OF_DATA &&
+             carquet_row_batch_num_rows(batch) == 0;
+        carquet_batch_reader_free(fresh_br);
+        carquet_batch_reader_free(br);
+    }
+
+    /* The batch outlives the readers that filled it */
+    carquet_row_batch_free(batch);
+    carquet_reader_close(reader);
+    carquet_test_cleanup(path);
+
+    if (!ok || recycled != 2 * 3) {
+        TEST_FAIL("batch_reader_next_into", "Reused batches do not match fresh ones");
+    }
+
+    TEST_PASS("batch_reader_next_into");
+    return 0;
+}
+
 int main(void) {
     int failures = 0;
 
@@ -397,6 +2135,20 @@ int main(void) {
     failures += test_status_strings();
     failures += test_nested_schema_levels();
     failures += test_write_simple_file();
+    failures += test_column_read_packed_resume();
+    failures += test_reader_page_index();
+    failures += test_column_skip();
+    failures += test_reader_bloom_filter();
+    failures += test_batch_reader_dictionary();
+    failures += test_reader_decode_in_place();
+    failures += test_batch_reader_arrow_export();
+    failures += test_reader_validity_levels();
+    failures += test_reader_validity_partial_group();
+    failures += test_column_read_spaced();
+    failures += test_column_read_spaced_partial_group();
+    failures += test_list_assembler_levels();
+    failures += test_nested_reader_lists();
+    failures += test_batch_reader_next_into();
 
     printf("\n");
     if (failures == 0) {
@@ -5,11 +5,13 @@
  * Tests for:
  * - CRC32 checksum
  * - xxHash64
+ * - Bloom filter batch operations
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include <assert.h>
 
 #include <carquet/error.h>
@@ -26,6 +28,19 @@ uint32_t carquet_crc32(const uint8_t* data, size_t length);
 uint32_t carquet_crc32_update(uint32_t crc, const uint8_t* data, size_t length);
 uint64_t carquet_xxhash64(const void* data, size_t length, uint64_t seed);
 
+typedef struct carquet_bloom_filter carquet_bloom_filter_t;
+carquet_bloom_filter_t* carquet_bloom_filter_create(size_t num_bytes);
+void carquet_bloom_filter_destroy(carquet_bloom_filter_t* filter);
+void carquet_bloom_filter_insert_hash(carquet_bloom_filter_t* filter, uint64_t hash);
+void carquet_bloom_filter_insert_hashes(carquet_bloom_filter_t* filter,
+                                         const uint64_t* hashes, int64_t count);
+bool carquet_bloom_filter_check_hash(const carquet_bloom_filter_t* filter, uint64_t hash);
+void carquet_bloom_filter_check_hashes(const carquet_bloom_filter_t* filter,
+                                        const uint64_t* hashes, int64_t count,
+                                        uint8_t* out_bitmap);
+const uint8_t* carquet_bloom_filter_data(const carquet_bloom_filter_t* filter);
+size_t carquet_bloom_filter_size(const carquet_bloom_filter_t* filter);
+
 /* ============================================================================
  * CRC32 Tests
  * ============================================================================
@@ -316,6 +331,67 @@ static int test_xxhash64_32byte_boundary(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Bloom Filter Tests
+ * ============================================================================
+ */
+
+static int test_bloom_filter_batch(void) {
+    /* 100 blocks: not a power of two, so block selection is exercised */
+    carquet_bloom_filter_t* batch = carquet_bloom_filter_create(3200);
+    carquet_bloom_filter_t* single = carquet_bloom_filter_create(3200);
+    if (!batch || !single) {
+        carquet_bloom_filter_destroy(batch);
+        carquet_bloom_filter_destroy(single);
+        TEST_FAIL("bloom_filter_batch", "Failed to create filters");
+    }
+
+    enum { NUM_INSERTS = 500, NUM_PROBES = 2001 };
+    uint64_t hashes[NUM_PROBES];
+    for (int i = 0; i < NUM_PROBES; i++) {
+        int64_t key = (int64_t)i * 7919;
+        hashes[i] = carquet_xxhash64(&key, sizeof(key), 0);
+    }
+
+    carquet_bloom_filter_insert_hashes(batch, hashes, NUM_INSERTS);
+    for (int i = 0; i < NUM_INSERTS; i++) {
+        carquet_bloom_filter_insert_hash(single, hashes[i]);
+    }
+
+    int ok = memcmp(carquet_bloom_filter_data(batch), carquet_bloom_filter_data(single),
+                    carquet_bloom_filter_size(batch)) == 0;
+
+    /* Odd probe count: the last bitmap byte is partial */
+    uint8_t bitmap[(NUM_PROBES + 7) / 8];
+    memset(bitmap, 0xAA, sizeof(bitmap));
+    carquet_bloom_filter_check_hashes(batch, hashes, NUM_PROBES, bitmap);
+    int positives = 0;
+    for (int i = 0; ok && i < NUM_PROBES; i++) {
+        bool bit = (bitmap[i / 8] >> (i % 8)) & 1;
+        if (bit != carquet_bloom_filter_check_hash(batch, hashes[i]) ||
+            (i < NUM_INSERTS && !bit)) {
+            ok = 0;
+        }
+        positives += bit;
+    }
+    if (bitmap[NUM_PROBES / 8] >> (NUM_PROBES % 8)) {
+        ok = 0;  /* Padding bits must be clear */
+    }
+
+    carquet_bloom_filter_destroy(batch);
+    carquet_bloom_filter_destroy(single);
+
+    if (!ok) {
+        TEST_FAIL("bloom_filter_batch", "Batch results differ from single-key operations");
+    }
+    if (positives >= NUM_PROBES) {
+        TEST_FAIL("bloom_filter_batch", "Every probe reported present");
+    }
+
+    TEST_PASS("bloom_filter_batch");
+    return 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================
@@ -345,6 +421,9 @@ int main(void) {
     failures += test_xxhash64_large_data();
     failures += test_xxhash64_32byte_boundary();
 
+    printf("\n--- Bloom Filter Tests ---\n");
+    failures += test_bloom_filter_batch();
+
     printf("\n");
     if (failures == 0) {
         printf("All tests passed!\n");